@@ -91,6 +91,8 @@ define_pd_global(intx, InlineSmallCode,          1000);
           "Use SIMD instructions in generated memory move code")        \
   product(bool, UseSIMDForArrayEquals, true,                            \
           "Use SIMD instructions in generated array equals code")       \
+  product(bool, UseSIMDForBigIntegerShiftIntrinsics, true,              \
+          "Use SIMD instructions for left/right shift of BigInteger")   \
   product(bool, UseSimpleArrayEquals, false,                            \
           "Use simpliest and shortest implementation for array equals") \
   product(bool, AvoidUnalignedAccesses, false,                          \
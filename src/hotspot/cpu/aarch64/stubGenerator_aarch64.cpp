@@ -3968,6 +3968,213 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Arguments:
+  //
+  // Input:
+  //   c_rarg0   - obja address
+  //   c_rarg1   - objb address
+  //   c_rarg2   - length, in elements
+  //   c_rarg3   - log2 of the array index scale
+  //
+  // Output:
+  //   r0        - index of the first mismatching element, or the bitwise
+  //               complement of the number of trailing elements (fewer than
+  //               8 bytes) left for the caller to compare
+  address generate_vectorizedMismatch() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedMismatch");
+
+    address start = __ pc();
+
+    const Register obja   = c_rarg0;
+    const Register objb   = c_rarg1;
+    const Register length = c_rarg2;
+    const Register scale  = c_rarg3;
+    const Register len    = r4;   // bytes left to compare
+    const Register pos    = r5;   // bytes compared so far
+    const Register tmp1   = r10;
+    const Register tmp2   = r11;
+    const Register tmp3   = r12;
+    const Register tmp4   = r13;
+
+    Label LOOP16, TAIL8, TAIL, DIFF_HI, DIFF_LO;
+
+    BLOCK_COMMENT("Entry:");
+    __ movw(len, length);
+    __ lslv(len, len, scale);
+    __ mov(pos, zr);
+
+    if (UseSVE > 0) {
+      // Skip over equal blocks of one vector length. The first block that
+      // differs is left to the loop below to find the mismatching byte.
+      Label SVE_LOOP, SVE_DONE;
+      const int vl = VM_Version::get_initial_sve_vector_length();
+      __ reinitialize_ptrue();
+      __ subs(tmp1, len, vl);
+      __ br(Assembler::LT, SVE_DONE);
+      __ BIND(SVE_LOOP);
+      __ sve_ld1b(z0, __ B, ptrue, Address(obja));
+      __ sve_ld1b(z1, __ B, ptrue, Address(objb));
+      __ sve_eor(z0, z0, z1);
+      __ sve_orv(v0, __ D, ptrue, z0);
+      __ fmovd(tmp1, v0);
+      __ cbnz(tmp1, SVE_DONE);
+      __ add(obja, obja, vl);
+      __ add(objb, objb, vl);
+      __ add(pos, pos, vl);
+      __ sub(len, len, vl);
+      __ subs(tmp1, len, vl);
+      __ br(Assembler::GE, SVE_LOOP);
+      __ BIND(SVE_DONE);
+    }
+
+    __ cmp(len, (u1)16);
+    __ br(Assembler::LT, TAIL8);
+
+    __ BIND(LOOP16);
+    __ ldp(tmp1, tmp2, Address(__ post(obja, 16)));
+    __ ldp(tmp3, tmp4, Address(__ post(objb, 16)));
+    __ eor(tmp1, tmp1, tmp3);
+    __ cbnz(tmp1, DIFF_LO);
+    __ eor(tmp2, tmp2, tmp4);
+    __ cbnz(tmp2, DIFF_HI);
+    __ add(pos, pos, 16);
+    __ sub(len, len, 16);
+    __ cmp(len, (u1)16);
+    __ br(Assembler::GE, LOOP16);
+
+    __ BIND(TAIL8);
+    __ cmp(len, (u1)8);
+    __ br(Assembler::LT, TAIL);
+    __ ldr(tmp1, Address(__ post(obja, 8)));
+    __ ldr(tmp3, Address(__ post(objb, 8)));
+    __ eor(tmp1, tmp1, tmp3);
+    __ cbnz(tmp1, DIFF_LO);
+    __ sub(len, len, 8);
+
+    __ BIND(TAIL);
+    // Everything compared so far is equal; hand the rest back.
+    __ lsrv(len, len, scale);
+    __ mvnw(r0, len);
+    __ ret(lr);
+
+    __ BIND(DIFF_HI);
+    __ add(pos, pos, 8);
+    __ mov(tmp1, tmp2);
+    __ BIND(DIFF_LO);
+    // Little-endian: the lowest set bit of the xor is in the first
+    // mismatching byte.
+    __ rbit(tmp1, tmp1);
+    __ clz(tmp1, tmp1);
+    __ add(pos, pos, tmp1, Assembler::LSR, 3);
+    __ lsrv(r0, pos, scale);
+    __ ret(lr);
+
+    return start;
+  }
+
+  // Arguments:
+  //
+  // Input:
+  //   c_rarg0   - newArr address
+  //   c_rarg1   - oldArr address
+  //   c_rarg2   - newIdx
+  //   c_rarg3   - shiftCount
+  //   c_rarg4   - numIter
+  //
+  // Both workers compute, for 0 <= i < numIter,
+  //   right shift: newArr[newIdx + i] = (oldArr[i + 1] >>> shiftCount) | (oldArr[i] << (32 - shiftCount))
+  //   left shift:  newArr[newIdx + i] = (oldArr[i] << shiftCount) | (oldArr[i + 1] >>> (32 - shiftCount))
+  // newArr and oldArr never overlap, so the elements can be processed in
+  // ascending order in both cases.
+  address generate_bigIntegerShift(bool is_right_shift) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines",
+                      is_right_shift ? "bigIntegerRightShiftWorker" : "bigIntegerLeftShiftWorker");
+    address start = __ pc();
+
+    Label ShiftSIMDLoop, ShiftOne, ShiftOneLoop, Exit;
+
+    Register newArr        = c_rarg0;
+    Register oldArr        = c_rarg1;
+    Register newIdx        = c_rarg2;
+    Register shiftCount    = c_rarg3;
+    Register numIter       = c_rarg4;
+
+    Register shiftRevCount = rscratch1;
+    Register oldArrNext    = rscratch2;
+    Register oldElem0      = r10;
+    Register oldElem1      = r11;
+
+    FloatRegister oldElemV0 = v0;
+    FloatRegister oldElemV1 = v1;
+    FloatRegister newElemV  = v2;
+    FloatRegister shiftV0   = v3;
+    FloatRegister shiftV1   = v4;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    __ cbzw(numIter, Exit);
+
+    __ add(newArr, newArr, newIdx, ext::uxtw, 2);
+    __ movw(shiftRevCount, 32);
+    __ subw(shiftRevCount, shiftRevCount, shiftCount);
+
+    if (UseSIMDForBigIntegerShiftIntrinsics) {
+      __ cmpw(numIter, 4);
+      __ br(Assembler::LT, ShiftOne);
+
+      // ushl shifts right for negative per-lane counts. oldElemV0 holds
+      // oldArr[i..i+3] and oldElemV1 holds oldArr[i+1..i+4].
+      if (is_right_shift) {
+        __ dup(shiftV0, __ T4S, shiftRevCount);
+        __ negw(oldElem0, shiftCount);
+        __ dup(shiftV1, __ T4S, oldElem0);
+      } else {
+        __ dup(shiftV0, __ T4S, shiftCount);
+        __ negw(oldElem0, shiftRevCount);
+        __ dup(shiftV1, __ T4S, oldElem0);
+      }
+
+      __ BIND(ShiftSIMDLoop);
+      __ add(oldArrNext, oldArr, 4);
+      __ ld1(oldElemV0, __ T4S, __ post(oldArr, 16));
+      __ ld1(oldElemV1, __ T4S, oldArrNext);
+      __ ushl(oldElemV0, __ T4S, oldElemV0, shiftV0);
+      __ ushl(oldElemV1, __ T4S, oldElemV1, shiftV1);
+      __ orr(newElemV, __ T16B, oldElemV0, oldElemV1);
+      __ st1(newElemV, __ T4S, __ post(newArr, 16));
+      __ subw(numIter, numIter, 4);
+      __ cmpw(numIter, 4);
+      __ br(Assembler::GE, ShiftSIMDLoop);
+
+      __ BIND(ShiftOne);
+      __ cbzw(numIter, Exit);
+    }
+
+    __ BIND(ShiftOneLoop);
+    __ ldrw(oldElem1, Address(oldArr, 4));
+    __ ldrw(oldElem0, __ post(oldArr, 4));
+    if (is_right_shift) {
+      __ lsrvw(oldElem1, oldElem1, shiftCount);
+      __ lslvw(oldElem0, oldElem0, shiftRevCount);
+    } else {
+      __ lslvw(oldElem0, oldElem0, shiftCount);
+      __ lsrvw(oldElem1, oldElem1, shiftRevCount);
+    }
+    __ orrw(oldElem0, oldElem0, oldElem1);
+    __ strw(oldElem0, __ post(newArr, 4));
+    __ subw(numIter, numIter, 1);
+    __ cbnzw(numIter, ShiftOneLoop);
+
+    __ BIND(Exit);
+    __ leave();
+    __ ret(lr);
+
+    return start;
+  }
+
   void ghash_multiply(FloatRegister result_lo, FloatRegister result_hi,
                       FloatRegister a, FloatRegister b, FloatRegister a1_xor_a0,
                       FloatRegister tmp1, FloatRegister tmp2, FloatRegister tmp3, FloatRegister tmp4) {
@@ -6224,6 +6431,9 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_mulAdd = generate_mulAdd();
     }
 
+    StubRoutines::_bigIntegerRightShiftWorker = generate_bigIntegerShift(/*is_right_shift*/true);
+    StubRoutines::_bigIntegerLeftShiftWorker = generate_bigIntegerShift(/*is_right_shift*/false);
+
     if (UseMontgomeryMultiplyIntrinsic) {
       StubCodeMark mark(this, "StubRoutines", "montgomeryMultiply");
       MontgomeryMultiplyGenerator g(_masm, /*squaring*/false);
@@ -6277,6 +6487,10 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
     }
 
+    if (UseVectorizedMismatchIntrinsic) {
+      StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
+    }
+
     StubRoutines::aarch64::set_completed();
   }
 
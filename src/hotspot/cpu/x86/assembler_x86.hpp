@@ -1539,6 +1539,9 @@ private:
   void vmovdqu(XMMRegister dst, Address src);
   void vmovdqu(XMMRegister dst, XMMRegister src);
 
+  // Move 256bit Vector Using Non-Temporal Hint
+  void vmovntdq(Address dst, XMMRegister src);
+
    // Move Unaligned 512bit Vector
   void evmovdqub(Address dst, XMMRegister src, bool merge, int vector_len);
   void evmovdqub(XMMRegister dst, Address src, bool merge, int vector_len);
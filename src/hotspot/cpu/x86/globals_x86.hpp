@@ -215,6 +215,11 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(intx, ArrayFillNonTemporalThreshold, 0, DIAGNOSTIC,               \
+             "Minimum array size in bytes for the fill stubs to use "       \
+             "non-temporal stores, which bypass the cache. 0 means never")  \
+             range(0, max_jint)                                             \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")
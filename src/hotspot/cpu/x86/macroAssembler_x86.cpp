@@ -5190,6 +5190,44 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
       movdl(xtmp, value);
       if (UseAVX >= 2 && UseUnalignedLoadStores) {
         Label L_check_fill_32_bytes;
+        if (ArrayFillNonTemporalThreshold > 0) {
+          // Fill huge arrays with streaming stores so they do not evict
+          // the rest of the cache. There must be room to align below.
+          Label L_fill_64_bytes_loop_nt, L_skip_fill_nt;
+          int nt_threshold = (int)MAX2(ArrayFillNonTemporalThreshold, (intx)256);
+
+          cmpl(count, nt_threshold >> (2 - shift));
+          jcc(Assembler::below, L_skip_fill_nt);
+
+          vpbroadcastd(xtmp, xtmp, Assembler::AVX_256bit);
+
+          // Non-temporal stores need a 32-byte aligned destination
+          vmovdqu(Address(to, 0), xtmp);
+          movptr(rtmp, to);
+          andptr(rtmp, 31);
+          negptr(rtmp);
+          addptr(rtmp, 32);
+          addptr(to, rtmp);
+          if (shift < 2) {
+            shrptr(rtmp, 2 - shift);
+          }
+          subl(count, rtmp);
+
+          subl(count, 16 << shift);
+          align(16);
+
+          BIND(L_fill_64_bytes_loop_nt);
+          vmovntdq(Address(to, 0), xtmp);
+          vmovntdq(Address(to, 32), xtmp);
+          addptr(to, 64);
+          subl(count, 16 << shift);
+          jcc(Assembler::greaterEqual, L_fill_64_bytes_loop_nt);
+          // order the streaming stores before anything that follows
+          sfence();
+          jmp(L_check_fill_32_bytes);
+
+          BIND(L_skip_fill_nt);
+        }
         if (UseAVX > 2) {
           // Fill 64-byte chunks
           Label L_fill_64_bytes_loop_avx3, L_check_fill_64_bytes_avx2;
@@ -4367,6 +4367,284 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Helpers for generate_sha3_implCompress. They mirror the ARMv8.2 SHA3
+  // instructions used by the aarch64 version, with one Keccak lane in the
+  // low quadword of each XMM register.
+
+  // d = n ^ m ^ a
+  void sha3_eor3(XMMRegister d, XMMRegister n, XMMRegister m, XMMRegister a) {
+    if (d == n) {
+      __ vpternlogq(d, 0x96, m, a, Assembler::AVX_128bit);
+    } else if (d == m) {
+      __ vpternlogq(d, 0x96, n, a, Assembler::AVX_128bit);
+    } else if (d == a) {
+      __ vpternlogq(d, 0x96, n, m, Assembler::AVX_128bit);
+    } else {
+      __ evmovdquq(d, n, Assembler::AVX_128bit);
+      __ vpternlogq(d, 0x96, m, a, Assembler::AVX_128bit);
+    }
+  }
+
+  // d = n ^ rol(m, 1)
+  void sha3_rax1(XMMRegister d, XMMRegister n, XMMRegister m, XMMRegister tmp) {
+    if (d == n) {
+      __ evprolq(tmp, m, 1, Assembler::AVX_128bit);
+      __ evpxorq(d, n, tmp, Assembler::AVX_128bit);
+    } else {
+      __ evprolq(d, m, 1, Assembler::AVX_128bit);
+      __ evpxorq(d, d, n, Assembler::AVX_128bit);
+    }
+  }
+
+  // d = ror(n ^ m, imm)
+  void sha3_xar(XMMRegister d, XMMRegister n, XMMRegister m, int imm) {
+    __ evpxorq(d, n, m, Assembler::AVX_128bit);
+    __ evprorq(d, d, imm, Assembler::AVX_128bit);
+  }
+
+  // d = n ^ (m & ~a)
+  void sha3_bcax(XMMRegister d, XMMRegister n, XMMRegister m, XMMRegister a) {
+    if (d == n) {
+      __ vpternlogq(d, 0xB4, m, a, Assembler::AVX_128bit);
+    } else if (d == m) {
+      __ vpternlogq(d, 0x9C, n, a, Assembler::AVX_128bit);
+    } else if (d == a) {
+      __ vpternlogq(d, 0xC6, n, m, Assembler::AVX_128bit);
+    } else {
+      __ evmovdquq(d, n, Assembler::AVX_128bit);
+      __ vpternlogq(d, 0xB4, m, a, Assembler::AVX_128bit);
+    }
+  }
+
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - byte[]  source+offset
+  //   c_rarg1   - byte[]  SHA.state
+  //   c_rarg2   - int     digest_length
+  //   c_rarg3   - int     offset
+  //   c_rarg4   - int     limit (on stack on Win64)
+  //
+  // The 25 lanes of the state live in xmm0-xmm24 and xmm25-xmm31 are
+  // temporaries, so the round is the same instruction sequence as the
+  // aarch64 stub with the SHA3 instructions replaced by AVX-512
+  // vpternlogq and rotates.
+  address generate_sha3_implCompress(bool multi_block, const char *name) {
+    assert(VM_Version::supports_avx512vl(), "");
+    static const uint64_t round_consts[24] = {
+      0x0000000000000001L, 0x0000000000008082L, 0x800000000000808AL,
+      0x8000000080008000L, 0x000000000000808BL, 0x0000000080000001L,
+      0x8000000080008081L, 0x8000000000008009L, 0x000000000000008AL,
+      0x0000000000000088L, 0x0000000080008009L, 0x000000008000000AL,
+      0x000000008000808BL, 0x800000000000008BL, 0x8000000000008089L,
+      0x8000000000008003L, 0x8000000000008002L, 0x8000000000000080L,
+      0x000000000000800AL, 0x800000008000000AL, 0x8000000080008081L,
+      0x8000000000008080L, 0x0000000080000001L, 0x8000000080008008L
+    };
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    const Register buf               = c_rarg0;
+    const Register state             = c_rarg1;
+    const Register digest_length     = c_rarg2;
+    const Register ofs               = c_rarg3;
+    const Register limit             = WINDOWS_ONLY(rax) NOT_WINDOWS(c_rarg4);
+    const Register rounds            = r10;
+    const Register round_consts_addr = r11;
+
+    Label sha3_loop, rounds24_loop;
+    Label sha3_512, sha3_384, sha3_256;
+
+    __ enter();
+
+#ifdef _WIN64
+    if (multi_block) {
+      // last argument is on stack on Win64
+      __ movl(limit, Address(rsp, 6 * wordSize));
+    }
+    // xmm6-xmm15 are callee saved on Win64
+    __ subptr(rsp, 10 * wordSize * 2);
+    for (int i = 6; i <= 15; i++) {
+      __ movdqu(Address(rsp, (i - 6) * wordSize * 2), as_XMMRegister(i));
+    }
+#endif
+
+    // load state
+    for (int i = 0; i < 25; i++) {
+      __ movq(as_XMMRegister(i), Address(state, i * 8));
+    }
+
+    __ BIND(sha3_loop);
+
+    // 24 keccak rounds
+    __ movl(rounds, 24);
+
+    // load round_constants base
+    __ lea(round_consts_addr, ExternalAddress((address) round_consts));
+
+    // load input: block_size = 200 - 2 * digest_length bytes, which is
+    // 9, 13, 17 or 18 lanes for SHA3-512, -384, -256 and -224
+    for (int i = 0; i < 9; i++) {
+      __ movq(xmm25, Address(buf, i * 8));
+      __ evpxorq(as_XMMRegister(i), as_XMMRegister(i), xmm25, Assembler::AVX_128bit);
+    }
+
+    // digest_length == 64, SHA3-512
+    __ testl(digest_length, 64);
+    __ jcc(Assembler::notZero, sha3_512);
+
+    for (int i = 9; i < 13; i++) {
+      __ movq(xmm25, Address(buf, i * 8));
+      __ evpxorq(as_XMMRegister(i), as_XMMRegister(i), xmm25, Assembler::AVX_128bit);
+    }
+
+    // digest_length == 28, SHA3-224;  digest_length == 48, SHA3-384
+    __ testl(digest_length, 16);
+    __ jcc(Assembler::zero, sha3_256);
+    __ testl(digest_length, 4);
+    __ jcc(Assembler::zero, sha3_384);
+
+    // SHA3-224
+    for (int i = 13; i < 18; i++) {
+      __ movq(xmm25, Address(buf, i * 8));
+      __ evpxorq(as_XMMRegister(i), as_XMMRegister(i), xmm25, Assembler::AVX_128bit);
+    }
+    __ addptr(buf, 144);
+    __ jmp(rounds24_loop);
+
+    __ BIND(sha3_384);
+    __ addptr(buf, 104);
+    __ jmp(rounds24_loop);
+
+    __ BIND(sha3_512);
+    __ addptr(buf, 72);
+    __ jmp(rounds24_loop);
+
+    // SHA3-256
+    __ BIND(sha3_256);
+    for (int i = 13; i < 17; i++) {
+      __ movq(xmm25, Address(buf, i * 8));
+      __ evpxorq(as_XMMRegister(i), as_XMMRegister(i), xmm25, Assembler::AVX_128bit);
+    }
+    __ addptr(buf, 136);
+
+    __ align(OptoLoopAlignment);
+    __ BIND(rounds24_loop);
+
+    sha3_eor3(xmm29, xmm4, xmm9, xmm14);
+    sha3_eor3(xmm26, xmm1, xmm6, xmm11);
+    sha3_eor3(xmm28, xmm3, xmm8, xmm13);
+    sha3_eor3(xmm25, xmm0, xmm5, xmm10);
+    sha3_eor3(xmm27, xmm2, xmm7, xmm12);
+    sha3_eor3(xmm29, xmm29, xmm19, xmm24);
+    sha3_eor3(xmm26, xmm26, xmm16, xmm21);
+    sha3_eor3(xmm28, xmm28, xmm18, xmm23);
+    sha3_eor3(xmm25, xmm25, xmm15, xmm20);
+    sha3_eor3(xmm27, xmm27, xmm17, xmm22);
+
+    sha3_rax1(xmm30, xmm29, xmm26, xmm31);
+    sha3_rax1(xmm26, xmm26, xmm28, xmm31);
+    sha3_rax1(xmm28, xmm28, xmm25, xmm31);
+    sha3_rax1(xmm25, xmm25, xmm27, xmm31);
+    sha3_rax1(xmm27, xmm27, xmm29, xmm31);
+
+    __ evpxorq(xmm0, xmm0, xmm30, Assembler::AVX_128bit);
+    sha3_xar(xmm29, xmm1, xmm25, (64 - 1));
+    sha3_xar(xmm1, xmm6, xmm25, (64 - 44));
+    sha3_xar(xmm6, xmm9, xmm28, (64 - 20));
+    sha3_xar(xmm9, xmm22, xmm26, (64 - 61));
+    sha3_xar(xmm22, xmm14, xmm28, (64 - 39));
+    sha3_xar(xmm14, xmm20, xmm30, (64 - 18));
+    sha3_xar(xmm31, xmm2, xmm26, (64 - 62));
+    sha3_xar(xmm2, xmm12, xmm26, (64 - 43));
+    sha3_xar(xmm12, xmm13, xmm27, (64 - 25));
+    sha3_xar(xmm13, xmm19, xmm28, (64 - 8));
+    sha3_xar(xmm19, xmm23, xmm27, (64 - 56));
+    sha3_xar(xmm23, xmm15, xmm30, (64 - 41));
+    sha3_xar(xmm15, xmm4, xmm28, (64 - 27));
+    sha3_xar(xmm28, xmm24, xmm28, (64 - 14));
+    sha3_xar(xmm24, xmm21, xmm25, (64 - 2));
+    sha3_xar(xmm8, xmm8, xmm27, (64 - 55));
+    sha3_xar(xmm4, xmm16, xmm25, (64 - 45));
+    sha3_xar(xmm16, xmm5, xmm30, (64 - 36));
+    sha3_xar(xmm5, xmm3, xmm27, (64 - 28));
+    sha3_xar(xmm27, xmm18, xmm27, (64 - 21));
+    sha3_xar(xmm3, xmm17, xmm26, (64 - 15));
+    sha3_xar(xmm25, xmm11, xmm25, (64 - 10));
+    sha3_xar(xmm26, xmm7, xmm26, (64 - 6));
+    sha3_xar(xmm30, xmm10, xmm30, (64 - 3));
+
+    sha3_bcax(xmm20, xmm31, xmm22, xmm8);
+    sha3_bcax(xmm21, xmm8, xmm23, xmm22);
+    sha3_bcax(xmm22, xmm22, xmm24, xmm23);
+    sha3_bcax(xmm23, xmm23, xmm31, xmm24);
+    sha3_bcax(xmm24, xmm24, xmm8, xmm31);
+
+    __ movq(xmm31, Address(round_consts_addr, 0));
+    __ addptr(round_consts_addr, 8);
+
+    sha3_bcax(xmm17, xmm25, xmm19, xmm3);
+    sha3_bcax(xmm18, xmm3, xmm15, xmm19);
+    sha3_bcax(xmm19, xmm19, xmm16, xmm15);
+    sha3_bcax(xmm15, xmm15, xmm25, xmm16);
+    sha3_bcax(xmm16, xmm16, xmm3, xmm25);
+
+    sha3_bcax(xmm10, xmm29, xmm12, xmm26);
+    sha3_bcax(xmm11, xmm26, xmm13, xmm12);
+    sha3_bcax(xmm12, xmm12, xmm14, xmm13);
+    sha3_bcax(xmm13, xmm13, xmm29, xmm14);
+    sha3_bcax(xmm14, xmm14, xmm26, xmm29);
+
+    sha3_bcax(xmm7, xmm30, xmm9, xmm4);
+    sha3_bcax(xmm8, xmm4, xmm5, xmm9);
+    sha3_bcax(xmm9, xmm9, xmm6, xmm5);
+    sha3_bcax(xmm5, xmm5, xmm30, xmm6);
+    sha3_bcax(xmm6, xmm6, xmm4, xmm30);
+
+    sha3_bcax(xmm3, xmm27, xmm0, xmm28);
+    sha3_bcax(xmm4, xmm28, xmm1, xmm0);
+    sha3_bcax(xmm0, xmm0, xmm2, xmm1);
+    sha3_bcax(xmm1, xmm1, xmm27, xmm2);
+    sha3_bcax(xmm2, xmm2, xmm28, xmm27);
+
+    __ evpxorq(xmm0, xmm0, xmm31, Assembler::AVX_128bit);
+
+    __ decrementl(rounds);
+    __ jcc(Assembler::notZero, rounds24_loop);
+
+    if (multi_block) {
+      // block_size =  200 - 2 * digest_length, ofs += block_size
+      __ movl(rounds, 200);
+      __ subl(rounds, digest_length);
+      __ subl(rounds, digest_length);
+      __ addl(ofs, rounds);
+
+      __ cmpl(ofs, limit);
+      __ jcc(Assembler::lessEqual, sha3_loop);
+      __ movl(rax, ofs); // return ofs
+    }
+
+    // store state
+    for (int i = 0; i < 25; i++) {
+      __ movq(Address(state, i * 8), as_XMMRegister(i));
+    }
+
+#ifdef _WIN64
+    for (int i = 6; i <= 15; i++) {
+      __ movdqu(as_XMMRegister(i), Address(rsp, (i - 6) * wordSize * 2));
+    }
+    __ addptr(rsp, 10 * wordSize * 2);
+#endif
+
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
   // This mask is used for incrementing counter value(linc0, linc4, etc.)
   address counter_mask_addr() {
     __ align(64);
@@ -6913,6 +7191,10 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_sha512_implCompress = generate_sha512_implCompress(false, "sha512_implCompress");
       StubRoutines::_sha512_implCompressMB = generate_sha512_implCompress(true, "sha512_implCompressMB");
     }
+    if (UseSHA3Intrinsics) {
+      StubRoutines::_sha3_implCompress = generate_sha3_implCompress(false, "sha3_implCompress");
+      StubRoutines::_sha3_implCompressMB = generate_sha3_implCompress(true, "sha3_implCompressMB");
+    }
 
     // Generate GHASH intrinsics code
     if (UseGHASHIntrinsics) {
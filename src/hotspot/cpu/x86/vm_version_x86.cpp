@@ -981,12 +981,18 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseSHA512Intrinsics, false);
   }
 
+#ifdef _LP64
+  // The stub keeps one Keccak lane per register and needs all 32 XMM registers
+  if (UseSHA && supports_evex() && supports_avx512vl()) {
+    // Do not auto-enable UseSHA3Intrinsics until it has been fully tested on hardware
+  } else
+#endif
   if (UseSHA3Intrinsics) {
     warning("Intrinsics for SHA3-224, SHA3-256, SHA3-384 and SHA3-512 crypto hash functions not available on this CPU.");
     FLAG_SET_DEFAULT(UseSHA3Intrinsics, false);
   }
 
-  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA512Intrinsics)) {
+  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA3Intrinsics || UseSHA512Intrinsics)) {
     FLAG_SET_DEFAULT(UseSHA, false);
   }
 
@@ -1401,6 +1407,23 @@ void VM_Version::get_processor_features() {
     }
   }
 
+  // Only the AVX2 fill loop has a non-temporal variant. The threshold is
+  // roughly the point where a fill no longer fits next to the working set
+  // in the last level cache.
+  if (UseAVX < 2 || !UseUnalignedLoadStores) {
+    if (!FLAG_IS_DEFAULT(ArrayFillNonTemporalThreshold) && ArrayFillNonTemporalThreshold != 0) {
+      warning("ArrayFillNonTemporalThreshold requires AVX2 and UseUnalignedLoadStores");
+    }
+    FLAG_SET_DEFAULT(ArrayFillNonTemporalThreshold, 0);
+  } else if (FLAG_IS_DEFAULT(ArrayFillNonTemporalThreshold)) {
+    if (is_intel()) {
+      FLAG_SET_DEFAULT(ArrayFillNonTemporalThreshold, 2 * M);
+    } else if (is_amd_family() && cpu_family() >= 0x17) {
+      // Zen has a larger L3 slice per core
+      FLAG_SET_DEFAULT(ArrayFillNonTemporalThreshold, 8 * M);
+    }
+  }
+
 #ifdef _LP64
   if (UseSSE42Intrinsics) {
     if (FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
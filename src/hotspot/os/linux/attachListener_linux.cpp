@@ -34,6 +34,7 @@
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #include <sys/stat.h>
 
@@ -105,6 +106,10 @@ class LinuxAttachListener: AllStatic {
   // write the given buffer to a socket
   static int write_fully(int s, char* buf, int len);
 
+  // write the two given buffers to a socket, using a single system call
+  // where possible
+  static int write_fully(int s, char* buf1, int len1, char* buf2, int len2);
+
   static LinuxAttachOperation* dequeue();
 };
 
@@ -397,6 +402,32 @@ int LinuxAttachListener::write_fully(int s, char* buf, int len) {
   return 0;
 }
 
+// write the two given buffers to the socket. The result line and the
+// result data are usually small enough to go out with one writev, which
+// saves a system call per request.
+int LinuxAttachListener::write_fully(int s, char* buf1, int len1, char* buf2, int len2) {
+  while (len1 > 0) {
+    struct iovec iov[2];
+    iov[0].iov_base = buf1;
+    iov[0].iov_len = len1;
+    iov[1].iov_base = buf2;
+    iov[1].iov_len = len2;
+    int n = ::writev(s, iov, len2 > 0 ? 2 : 1);
+    if (n == -1) {
+      if (errno != EINTR) return -1;
+    } else if (n < len1) {
+      buf1 += n;
+      len1 -= n;
+    } else {
+      n -= len1;
+      len1 = 0;
+      buf2 += n;
+      len2 -= n;
+    }
+  }
+  return len2 > 0 ? write_fully(s, buf2, len2) : 0;
+}
+
 // Complete an operation by sending the operation result and any result
 // output to the client. At this time the socket is in blocking mode so
 // potentially we can block if there is a lot of data and the client is
@@ -416,13 +447,9 @@ void LinuxAttachOperation::complete(jint result, bufferedStream* st) {
   // write operation result
   char msg[32];
   sprintf(msg, "%d\n", result);
-  int rc = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg));
-
-  // write any result data
-  if (rc == 0) {
-    LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size());
-    ::shutdown(this->socket(), 2);
-  }
+  LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg),
+                                   (char*) st->base(), st->size());
+  ::shutdown(this->socket(), 2);
 
   // done
   ::close(this->socket());
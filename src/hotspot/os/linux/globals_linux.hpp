@@ -50,6 +50,18 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, UseTransparentHugePagesForCodeCache, false,             \
+          "Use MADV_HUGEPAGE for committed code cache memory, "         \
+          "independent of UseTransparentHugePages")                     \
+                                                                        \
+  product(bool, UseTransparentHugePagesForMetaspace, false,             \
+          "Use MADV_HUGEPAGE for committed metaspace memory, "          \
+          "independent of UseTransparentHugePages")                     \
+                                                                        \
+  product(bool, WritePerfMap, false,                                    \
+          "Write /tmp/perf-<pid>.map for the perf profiler, adding an "  \
+          "entry for each compiled method and stub as it is installed")  \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -78,6 +90,18 @@
           "resulting in file-backed shared mappings of the process to " \
           "be dumped into the corefile.")                               \
                                                                         \
+  product(intx, PooledJavaThreads, 0, EXPERIMENTAL,                     \
+          "Number of native threads of terminated Java threads with the " \
+          "default stack size that are kept parked for running new "    \
+          "Java threads (0 means no pooling). Pthread TLS destructors " \
+          "do not run between the Java threads sharing a native thread.")\
+          range(0, 4096)                                                \
+                                                                        \
+  product(intx, PooledJavaThreadIdleMillis, 10000, EXPERIMENTAL,        \
+          "Time in milliseconds after which an unused parked native "   \
+          "thread terminates (see PooledJavaThreads)")                  \
+          range(1, max_jint)                                            \
+                                                                        \
   product(bool, UseCpuAllocPath, false, DIAGNOSTIC,                     \
           "Use CPU_ALLOC code path in os::active_processor_count ")
 
@@ -721,6 +721,131 @@ static void *thread_native_entry(Thread *thread) {
   return 0;
 }
 
+// Pool of native threads that have run a JavaThread with the default
+// stack size to completion and are parked waiting to run another one.
+// Handing a new JavaThread to a parked native thread saves creating the
+// native thread and its stack. The pool is only used if PooledJavaThreads
+// is set, since native code that relies on pthread TLS destructors being
+// run at the end of each Java thread would see a behavioral change.
+//
+// The lock is a plain pthread mutex because parked native threads are
+// not attached to the VM.
+class NativeThreadPool : AllStatic {
+  // A parked native thread. Lives on the stack of the parked thread.
+  class Entry : public StackObj {
+   public:
+    os::PlatformMonitor _monitor;
+    Thread* volatile    _thread;  // The Thread to run next, set by the adopter.
+    const pthread_t     _tid;
+    Entry*              _next;
+
+    Entry() : _monitor(), _thread(NULL), _tid(pthread_self()), _next(NULL) {}
+  };
+
+  static pthread_mutex_t _lock;
+  static Entry* _parked;
+  static int _num_parked;
+
+  // Remove the entry from the pool. Returns false if an adopter has
+  // already taken it.
+  static bool remove(Entry* entry) {
+    bool removed = false;
+    pthread_mutex_lock(&_lock);
+    for (Entry** p = &_parked; *p != NULL; p = &(*p)->_next) {
+      if (*p == entry) {
+        *p = entry->_next;
+        _num_parked--;
+        removed = true;
+        break;
+      }
+    }
+    pthread_mutex_unlock(&_lock);
+    return removed;
+  }
+
+ public:
+  // Hand the thread to a parked native thread. Returns false if there is none.
+  static bool adopt(Thread* thread) {
+    pthread_mutex_lock(&_lock);
+    Entry* entry = _parked;
+    if (entry != NULL) {
+      _parked = entry->_next;
+      _num_parked--;
+    }
+    pthread_mutex_unlock(&_lock);
+    if (entry == NULL) {
+      return false;
+    }
+
+    thread->osthread()->set_pthread_id(entry->_tid);
+    entry->_monitor.lock();
+    entry->_thread = thread;
+    entry->_monitor.notify();
+    entry->_monitor.unlock();
+    // The entry may be gone at this point.
+    return true;
+  }
+
+  // Park the current native thread until a new Thread is handed to it.
+  // Returns NULL if the pool is full, or if no Thread has been handed
+  // over for PooledJavaThreadIdleMillis, in which case the native thread
+  // should terminate.
+  static Thread* park() {
+    Entry entry;
+    pthread_mutex_lock(&_lock);
+    if (_num_parked >= PooledJavaThreads) {
+      pthread_mutex_unlock(&_lock);
+      return NULL;
+    }
+    entry._next = _parked;
+    _parked = &entry;
+    _num_parked++;
+    pthread_mutex_unlock(&_lock);
+
+    entry._monitor.lock();
+    while (entry._thread == NULL) {
+      if (entry._monitor.wait(PooledJavaThreadIdleMillis) == OS_TIMEOUT &&
+          entry._thread == NULL) {
+        // Leave the pool, unless an adopter has already taken the
+        // entry and is about to hand over its Thread.
+        entry._monitor.unlock();
+        if (remove(&entry)) {
+          return NULL;
+        }
+        entry._monitor.lock();
+      }
+    }
+    Thread* thread = entry._thread;
+    entry._monitor.unlock();
+    return thread;
+  }
+};
+
+pthread_mutex_t NativeThreadPool::_lock = PTHREAD_MUTEX_INITIALIZER;
+NativeThreadPool::Entry* NativeThreadPool::_parked = NULL;
+int NativeThreadPool::_num_parked = 0;
+
+// Thread start routine for native threads that return to the
+// NativeThreadPool after running their Thread.
+static void *pooled_thread_native_entry(Thread *thread) {
+  while (thread != NULL) {
+    thread_native_entry(thread);
+    thread = NativeThreadPool::park();
+  }
+  return 0;
+}
+
+// Wait until the child thread is either initialized or aborted.
+static ThreadState wait_until_child_initialized(OSThread* osthread) {
+  ThreadState state;
+  Monitor* sync_with_child = osthread->startThread_lock();
+  MutexLocker ml(sync_with_child, Mutex::_no_safepoint_check_flag);
+  while ((state = osthread->get_state()) == ALLOCATED) {
+    sync_with_child->wait_without_safepoint_check();
+  }
+  return state;
+}
+
 // On Linux, glibc places static TLS blocks (for __thread variables) on
 // the thread stack. This decreases the stack size actually available
 // to threads.
@@ -806,6 +931,16 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
   thread->set_osthread(osthread);
 
+  // Java threads with the default stack size can run on a pooled native thread.
+  const bool poolable = PooledJavaThreads > 0 && thr_type == java_thread && req_stack_size == 0;
+  if (poolable && NativeThreadPool::adopt(thread)) {
+    log_info(os, thread)("Thread started on pooled native thread (pthread id: " UINTX_FORMAT ").",
+                         (uintx) osthread->pthread_id());
+    ThreadState state = wait_until_child_initialized(osthread);
+    assert(state == INITIALIZED, "race condition");
+    return true;
+  }
+
   // init thread attributes
   pthread_attr_t attr;
   pthread_attr_init(&attr);
@@ -856,7 +991,8 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
   {
     pthread_t tid;
-    int ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
+    void* (*entry)(Thread*) = poolable ? pooled_thread_native_entry : thread_native_entry;
+    int ret = pthread_create(&tid, &attr, (void* (*)(void*)) entry, thread);
 
     char buf[64];
     if (ret == 0) {
@@ -887,13 +1023,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
     osthread->set_pthread_id(tid);
 
     // Wait until child thread is either initialized or aborted
-    {
-      Monitor* sync_with_child = osthread->startThread_lock();
-      MutexLocker ml(sync_with_child, Mutex::_no_safepoint_check_flag);
-      while ((state = osthread->get_state()) == ALLOCATED) {
-        sync_with_child->wait_without_safepoint_check();
-      }
-    }
+    state = wait_until_child_initialized(osthread);
   }
 
   // The thread is returned suspended (in state INITIALIZED),
@@ -2311,6 +2441,15 @@ void os::Linux::print_process_memory_info(outputStream* st) {
 
 }
 
+bool os::trim_native_heap() {
+#ifdef __GLIBC__
+  ::malloc_trim(0);
+  return true;
+#else
+  return false;
+#endif // __GLIBC__
+}
+
 bool os::Linux::print_ld_preload_file(outputStream* st) {
   return _print_ascii_file("/etc/ld.so.preload", st, "/etc/ld.so.preload:");
 }
@@ -2884,6 +3023,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2918,6 +3062,40 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+void os::pd_advise_huge_pages(char *addr, size_t bytes, MEMFLAGS flag) {
+  // Unlike UseTransparentHugePages, these only advise: the kernel may back the
+  // range with huge pages, but nothing is reserved or aligned for it. That is
+  // useful for densely used regions with THP set to "madvise" system wide.
+  bool advise = (flag == mtCode  && UseTransparentHugePagesForCodeCache) ||
+                (flag == mtClass && UseTransparentHugePagesForMetaspace);
+  if (advise) {
+    // We don't check the return value, see pd_realign_memory().
+    ::madvise(addr, bytes, MADV_HUGEPAGE);
+  }
+}
+
+// Cleared the first time the kernel rejects MADV_POPULATE_WRITE (before 5.14).
+static volatile bool _populate_write_supported = true;
+
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) {
+  // With transparent huge pages the caller has to touch every small page,
+  // since any part of the range may have fallen back to small pages. Let the
+  // kernel populate the whole range instead, which faults in huge pages where
+  // possible and needs a single call per range.
+  if (!UseTransparentHugePages || !Atomic::load(&_populate_write_supported)) {
+    return false;
+  }
+  char* const first = align_down((char*)start, os::vm_page_size());
+  char* const last = align_up((char*)end, os::vm_page_size());
+  if (::madvise(first, pointer_delta(last, first, sizeof(char)), MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  if (errno == EINVAL) {
+    Atomic::store(&_populate_write_supported, false);
+  }
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -5148,14 +5326,18 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
+  int fd;
 
+  // This is called once per thread by the bulk M&M queries, so read the
+  // stat file with plain system calls rather than going through a stdio
+  // FILE, which would malloc and free a buffer on every call.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = fopen(proc_name, "r");
-  if (fp == NULL) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  fd = ::open(proc_name, O_RDONLY);
+  if (fd == -1) return -1;
+  RESTARTABLE(::read(fd, stat, 2047), statlen);
+  ::close(fd);
+  if (statlen <= 0) return -1;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
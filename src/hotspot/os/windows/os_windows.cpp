@@ -3479,6 +3479,9 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 }
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
+void os::pd_advise_huge_pages(char *addr, size_t bytes, MEMFLAGS flag) { }
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) { return false; }
+bool os::trim_native_heap() { return false; }
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::numa_make_global(char *addr, size_t bytes)    { }
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint)    { }
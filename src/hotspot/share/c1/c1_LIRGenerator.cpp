@@ -974,6 +974,35 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   }
 }
 
+// With Tier3ProfileSampleFreqLog, switch profiles are only updated for one
+// in 2^Tier3ProfileSampleFreqLog executions of the switch, by
+// profile_sample_increment() instead of one. Each switch counts its own
+// executions in the sample counter of its MultiBranchData, found at
+// counter_offset from the MDO in md_reg, so the sampled executions do not
+// depend on the control flow elsewhere in the method. Returns the label to
+// branch to when the update is skipped.
+LabelObj* LIRGenerator::profile_sample_begin(LIR_Opr md_reg, int counter_offset) {
+  assert(Tier3ProfileSampleFreqLog > 0, "profiling is not sampled");
+  LabelObj* skip = new LabelObj();
+  // Only tier 3 code uses the counter, so a 32 bit counter in the cell is enough.
+  LIR_Address* counter_addr = new LIR_Address(md_reg, counter_offset, T_INT);
+  LIR_Opr counter = new_register(T_INT);
+  __ load(counter_addr, counter);
+  __ add(counter, LIR_OprFact::intConst(1), counter);
+  __ store(counter, counter_addr);
+  LIR_Opr mask = load_immediate(right_n_bits(Tier3ProfileSampleFreqLog), T_INT);
+  __ logical_and(counter, mask, counter);
+  __ cmp(lir_cond_notEqual, counter, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_notEqual, skip->label());
+  return skip;
+}
+
+void LIRGenerator::profile_sample_end(LabelObj* skip) {
+  if (skip != NULL) {
+    __ branch_destination(skip->label());
+  }
+}
+
 // Phi technique:
 // This is about passing live values from one basic block to the other.
 // In code generated with Java it is rather rare that more than one
@@ -2344,6 +2373,11 @@ void LIRGenerator::do_TableSwitch(TableSwitch* x) {
     int default_count_offset = md->byte_offset_of_slot(data, MultiBranchData::default_count_offset());
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
+    LabelObj* skip = NULL;
+    if (Tier3ProfileSampleFreqLog > 0) {
+      int number_of_cases = data->as_MultiBranchData()->number_of_cases();
+      skip = profile_sample_begin(md_reg, md->byte_offset_of_slot(data, MultiBranchData::sample_counter_offset(number_of_cases)));
+    }
     LIR_Opr data_offset_reg = new_pointer_register();
     LIR_Opr tmp_reg = new_pointer_register();
 
@@ -2361,8 +2395,9 @@ void LIRGenerator::do_TableSwitch(TableSwitch* x) {
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
-    __ add(data_reg, LIR_OprFact::intptrConst(1), data_reg);
+    __ add(data_reg, LIR_OprFact::intptrConst(profile_sample_increment(1)), data_reg);
     __ move(data_reg, data_addr);
+    profile_sample_end(skip);
   }
 
   if (UseTableRanges) {
@@ -2402,6 +2437,11 @@ void LIRGenerator::do_LookupSwitch(LookupSwitch* x) {
     int default_count_offset = md->byte_offset_of_slot(data, MultiBranchData::default_count_offset());
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
+    LabelObj* skip = NULL;
+    if (Tier3ProfileSampleFreqLog > 0) {
+      int number_of_cases = data->as_MultiBranchData()->number_of_cases();
+      skip = profile_sample_begin(md_reg, md->byte_offset_of_slot(data, MultiBranchData::sample_counter_offset(number_of_cases)));
+    }
     LIR_Opr data_offset_reg = new_pointer_register();
     LIR_Opr tmp_reg = new_pointer_register();
 
@@ -2419,8 +2459,9 @@ void LIRGenerator::do_LookupSwitch(LookupSwitch* x) {
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
-    __ add(data_reg, LIR_OprFact::intptrConst(1), data_reg);
+    __ add(data_reg, LIR_OprFact::intptrConst(profile_sample_increment(1)), data_reg);
     __ move(data_reg, data_addr);
+    profile_sample_end(skip);
   }
 
   if (UseTableRanges) {
@@ -394,6 +394,9 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
   LIR_Opr safepoint_poll_register();
 
   void profile_branch(If* if_instr, If::Condition cond);
+  LabelObj* profile_sample_begin(LIR_Opr md_reg, int counter_offset);
+  void profile_sample_end(LabelObj* skip);
+  int profile_sample_increment(int step) const { return step << Tier3ProfileSampleFreqLog; }
   void increment_event_counter_impl(CodeEmitInfo* info,
                                     ciMethod *method, LIR_Opr step, int frequency,
                                     int bci, bool backedge, bool notify);
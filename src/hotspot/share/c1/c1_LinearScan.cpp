@@ -86,6 +86,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(NULL)
  , _sorted_intervals(NULL)
  , _needs_full_resort(false)
+ , _fast_mode(false)
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -3081,6 +3082,11 @@ void LinearScan::do_linear_scan() {
 
   number_instructions();
 
+  // The search for good split positions is linear in the number of blocks
+  // for each split, which does not pay off for huge methods
+  _fast_mode = LinearScanFastModeThreshold > 0 && _lir_ops.length() > LinearScanFastModeThreshold;
+  TRACE_LINEAR_SCAN(1, if (_fast_mode) tty->print_cr("using fast mode for %d LIR operations", _lir_ops.length()));
+
   NOT_PRODUCT(print_lir(1, "Before Register Allocation"));
 
   compute_local_live_sets();
@@ -5072,6 +5078,11 @@ int LinearScanWalker::find_optimal_split_pos(BlockBegin* min_block, BlockBegin*
     optimal_split_pos = max_block->first_lir_instruction_id();
   }
 
+  // In fast mode only look at a bounded number of blocks before max_block
+  if (allocator()->fast_mode()) {
+    from_block_nr = MAX2(from_block_nr, to_block_nr - fast_mode_split_search_blocks);
+  }
+
   int min_loop_depth = max_block->loop_depth();
   for (int i = to_block_nr - 1; i >= from_block_nr; i--) {
     BlockBegin* cur = block_at(i);
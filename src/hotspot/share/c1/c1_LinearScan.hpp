@@ -138,6 +138,7 @@ class LinearScan : public CompilationResourceObj {
   IntervalList*             _new_intervals_from_allocation; // list with all intervals created during allocation when an existing interval is split
   IntervalArray*            _sorted_intervals;  // intervals sorted by Interval::from()
   bool                      _needs_full_resort; // set to true if an Interval::from() is changed and _sorted_intervals must be resorted
+  bool                      _fast_mode;         // true for huge methods, see LinearScanFastModeThreshold
 
   LIR_OpArray               _lir_ops;           // mapping from LIR_Op id to LIR_Op node
   BlockBeginArray           _block_of_op;       // mapping from LIR_Op id to the BlockBegin containing this instruction
@@ -173,6 +174,7 @@ class LinearScan : public CompilationResourceObj {
   // size of live_in and live_out sets of BasicBlocks (BitMap needs rounded size for iteration)
   int           live_set_size() const            { return align_up(_num_virtual_regs, BitsPerWord); }
   bool          has_fpu_registers() const        { return _has_fpu_registers; }
+  bool          fast_mode() const                { return _fast_mode; }
   int           num_loops() const                { return ir()->num_loops(); }
   bool          is_interval_in_loop(int interval, int loop) const { return _interval_in_loop.at(interval, loop); }
 
@@ -712,7 +714,8 @@ class IntervalWalker : public CompilationResourceObj {
 // The actual linear scan register allocator
 class LinearScanWalker : public IntervalWalker {
   enum {
-    any_reg = LinearScan::any_reg
+    any_reg = LinearScan::any_reg,
+    fast_mode_split_search_blocks = 16  // blocks searched for a split position in fast mode
   };
 
  private:
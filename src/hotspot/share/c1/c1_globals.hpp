@@ -222,6 +222,11 @@
   develop(bool, StressLinearScan, false,                                    \
           "scramble block order used by LinearScan (stress test)")          \
                                                                             \
+  product(intx, LinearScanFastModeThreshold, 30000,                         \
+          "Number of LIR operations above which LinearScan limits the "     \
+          "search for split positions to save compile time (0 = never)")    \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, TimeLinearScan, false,                                      \
           "detailed timing of LinearScan phases")                           \
                                                                             \
@@ -142,7 +142,7 @@ ClassLoaderData::ClassLoaderData(Handle h_class_loader, bool has_class_mirror_ho
   _keep_alive((has_class_mirror_holder || h_class_loader.is_null()) ? 1 : 0),
   _claim(0),
   _handles(),
-  _klasses(NULL), _packages(NULL), _modules(NULL), _unnamed_module(NULL), _dictionary(NULL),
+  _klasses(NULL), _num_classes(0), _packages(NULL), _modules(NULL), _unnamed_module(NULL), _dictionary(NULL),
   _jmethod_ids(NULL),
   _deallocate_list(NULL),
   _next(NULL),
@@ -471,6 +471,7 @@ void ClassLoaderData::add_class(Klass* k, bool publicize /* true */) {
     // Link the new item into the list, making sure the linked class is stable
     // since the list can be walked without a lock
     Atomic::release_store(&_klasses, k);
+    Atomic::inc(&_num_classes);
     if (k->is_array_klass()) {
       ClassLoaderDataGraph::inc_array_classes(1);
     } else {
@@ -514,6 +515,7 @@ void ClassLoaderData::remove_class(Klass* scratch_class) {
         Klass* next = k->next_link();
         prev->set_next_link(next);
       }
+      Atomic::dec(&_num_classes);
 
       if (k->is_array_klass()) {
         ClassLoaderDataGraph::dec_array_classes(1);
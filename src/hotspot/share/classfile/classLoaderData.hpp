@@ -140,6 +140,7 @@ class ClassLoaderData : public CHeapObj<mtClass> {
   NOT_PRODUCT(volatile int _dependency_count;)  // number of class loader dependencies
 
   Klass* volatile _klasses;              // The classes defined by the class loader.
+  volatile size_t _num_classes;          // Length of _klasses, kept for statistics.
   PackageEntryTable* volatile _packages; // The packages defined by the class loader.
   ModuleEntryTable*  volatile _modules;  // The modules defined by the class loader.
   ModuleEntry* _unnamed_module;          // This class loader's unnamed module.
@@ -280,6 +281,7 @@ class ClassLoaderData : public CHeapObj<mtClass> {
 
   void classes_do(KlassClosure* klass_closure);
   Klass* klasses() { return _klasses; }
+  size_t num_classes() const { return Atomic::load(&_num_classes); }
 
   JNIMethodBlock* jmethod_ids() const              { return _jmethod_ids; }
   void set_jmethod_ids(JNIMethodBlock* new_block)  { _jmethod_ids = new_block; }
@@ -32,19 +32,6 @@
 #include "utilities/globalDefinitions.hpp"
 
 
-class ClassStatsClosure : public KlassClosure {
-public:
-  int _num_classes;
-
-  ClassStatsClosure() :
-    _num_classes(0) {
-  }
-
-  virtual void do_klass(Klass* k) {
-    _num_classes++;
-  }
-};
-
 void ClassLoaderStatsClosure::do_cld(ClassLoaderData* cld) {
   oop cl = cld->class_loader();
 
@@ -67,17 +54,16 @@ void ClassLoaderStatsClosure::do_cld(ClassLoaderData* cld) {
     addEmptyParents(cls->_parent);
   }
 
-  ClassStatsClosure csc;
-  cld->classes_do(&csc);
-  bool is_hidden = false;
+  // Use the count maintained by the CLD rather than walking its classes.
+  size_t num_classes = cld->num_classes();
   if(cld->has_class_mirror_holder()) {
     // If cld has a class holder then it must be either hidden or unsafe anonymous.
     // Either way, count it as a hidden class.
-    cls->_hidden_classes_count += csc._num_classes;
+    cls->_hidden_classes_count += num_classes;
   } else {
-    cls->_classes_count = csc._num_classes;
+    cls->_classes_count = num_classes;
   }
-  _total_classes += csc._num_classes;
+  _total_classes += num_classes;
 
   ClassLoaderMetaspace* ms = cld->metaspace_or_null();
   if (ms != NULL) {
@@ -505,6 +505,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _fields(fields),
   _info(info),
   _root_group(NULL),
+  _hot_group(NULL),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(NULL),
   _layout(NULL),
@@ -538,6 +539,32 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
+}
+
+// Returns true if "name" of the class being laid out is listed in HotInstanceFields.
+bool FieldLayoutBuilder::is_hot_field(const Symbol* name) const {
+  const char* list = HotInstanceFields;
+  if (list == NULL || *list == '\0') {
+    return false;
+  }
+  int class_len = _classname->utf8_length();
+  int name_len = name->utf8_length();
+  const char* entry = list;
+  while (*entry != '\0') {
+    const char* end = entry;
+    while (*end != '\0' && *end != ',' && *end != '\n') {
+      end++;
+    }
+    if (end - entry == class_len + 1 + name_len &&
+        entry[class_len] == '.' &&
+        _classname->equals(entry, class_len) &&
+        name->equals(entry + class_len + 1, name_len)) {
+      return true;
+    }
+    entry = (*end == '\0') ? end : end + 1;
+  }
+  return false;
 }
 
 // Field sorting for regular classes:
@@ -560,6 +587,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (is_hot_field(fs.name())) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -587,6 +616,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  _hot_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -619,6 +649,9 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  // Hot fields go first, so they end up next to each other and to the header.
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -662,6 +695,13 @@ void FieldLayoutBuilder::epilogue() {
     }
   }
 
+  if (_hot_group->oop_fields() != NULL) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
       FieldGroup* cg = _contended_groups.at(i);
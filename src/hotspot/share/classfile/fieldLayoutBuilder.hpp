@@ -233,6 +233,7 @@ class FieldLayoutBuilder : public ResourceObj {
   Array<u2>* _fields;
   FieldLayoutInfo* _info;
   FieldGroup* _root_group;
+  FieldGroup* _hot_group;   // fields listed in HotInstanceFields
   GrowableArray<FieldGroup*> _contended_groups;
   FieldGroup* _static_fields;
   FieldLayout* _layout;
@@ -260,6 +261,7 @@ class FieldLayoutBuilder : public ResourceObj {
   void epilogue();
   void regular_field_sorting();
   FieldGroup* get_or_create_contended_group(int g);
+  bool is_hot_field(const Symbol* name) const;
 };
 
 #endif // SHARE_CLASSFILE_FIELDLAYOUTBUILDER_HPP
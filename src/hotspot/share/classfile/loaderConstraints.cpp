@@ -334,7 +334,9 @@ void LoaderConstraintTable::ensure_loader_constraint_capacity(
                                                      LoaderConstraintEntry *p,
                                                     int nfree) {
     if (p->max_loaders() - p->num_loaders() < nfree) {
-        int n = nfree + p->num_loaders();
+        // Grow geometrically, constraints shared by many loaders are
+        // extended one loader at a time.
+        int n = MAX2(nfree + p->num_loaders(), 2 * p->max_loaders());
         ClassLoaderData** new_loaders = NEW_C_HEAP_ARRAY(ClassLoaderData*, n, mtClass);
         memcpy(new_loaders, p->loaders(), sizeof(ClassLoaderData*) * p->num_loaders());
         p->set_max_loaders(n);
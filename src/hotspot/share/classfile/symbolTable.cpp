@@ -449,18 +449,31 @@ void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHa
   // Note that c_heap will be true for non-strong hidden classes and unsafe anonymous classes
   // even if their loader is the boot loader because they will have a different cld.
   bool c_heap = !loader_data->is_the_null_class_loader_data();
+  assert(names_count <= symbol_alloc_batch_size, "batch too large");
+  Symbol* arena_syms[symbol_alloc_batch_size];
+  bool use_arena = !c_heap && !DumpSharedSpaces;
+  if (use_arena) {
+    // Allocate the whole batch from the global arena with a single
+    // acquisition of SymbolArena_lock instead of one per symbol.
+    MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag);
+    for (int i = 0; i < names_count; i++) {
+      assert (lengths[i] <= Symbol::max_length(), "should be checked by caller");
+      arena_syms[i] = new (lengths[i], arena()) Symbol((const u1*)names[i], lengths[i], PERM_REFCOUNT);
+    }
+  }
   for (int i = 0; i < names_count; i++) {
     const char *name = names[i];
     int len = lengths[i];
     unsigned int hash = hashValues[i];
     assert(lookup_shared(name, len, hash) == NULL, "must have checked already");
-    Symbol* sym = do_add_if_needed(name, len, hash, c_heap);
+    Symbol* sym = do_add_if_needed(name, len, hash, c_heap, use_arena ? arena_syms[i] : NULL);
     assert(sym->refcount() != 0, "lookup should have incremented the count");
     cp->symbol_at_put(cp_indices[i], sym);
   }
 }
 
-Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, bool heap) {
+Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, bool heap,
+                                      Symbol* preallocated) {
   SymbolTableLookup lookup(name, len, hash);
   SymbolTableGet stg;
   bool clean_hint = false;
@@ -470,7 +483,12 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
 
   do {
     // Callers have looked up the symbol once, insert the symbol.
-    sym = allocate_symbol(name, len, heap);
+    if (preallocated != NULL) {
+      sym = preallocated;
+      preallocated = NULL;
+    } else {
+      sym = allocate_symbol(name, len, heap);
+    }
     if (_local_table->insert(THREAD, lookup, sym, &rehash_warning, &clean_hint)) {
       break;
     }
@@ -126,7 +126,9 @@ class SymbolTable : public AllStatic {
 
   static Symbol* allocate_symbol(const char* name, int len, bool c_heap); // Assumes no characters larger than 0x7F
   static Symbol* do_lookup(const char* name, int len, uintx hash);
-  static Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool heap);
+  // If given, 'preallocated' is tried first before allocating a new symbol.
+  static Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool heap,
+                                  Symbol* preallocated = NULL);
 
   // lookup only, won't add. Also calculate hash. Used by the ClassfileParser.
   static Symbol* lookup_only(const char* name, int len, unsigned int& hash);
@@ -157,7 +159,7 @@ public:
   static TableStatistics get_table_statistics();
 
   enum {
-    symbol_alloc_batch_size = 8,
+    symbol_alloc_batch_size = 32,
     // Pick initial size based on java -version size measurements
     symbol_alloc_arena_size = 360*K // TODO (revisit)
   };
@@ -524,7 +524,7 @@ public:
  protected:
 
   enum Constants {
-    _loader_constraint_size = 107,                     // number of entries in constraint table
+    _loader_constraint_size = 1009,                    // number of entries in constraint table
     _resolution_error_size  = 107,                     // number of entries in resolution error table
     _invoke_method_size     = 139,                     // number of entries in invoke method table
     _placeholder_table_size = 1009                     // number of entries in hash table for placeholders
@@ -32,6 +32,7 @@
 #include "code/dependencyContext.hpp"
 #include "code/icBuffer.hpp"
 #include "code/nmethod.hpp"
+#include "code/perfMap.hpp"
 #include "code/pcDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
@@ -483,7 +484,7 @@ CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
  * run the constructor for the CodeBlob subclass he is busy
  * instantiating.
  */
-CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_type) {
+CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool is_hot, int orig_code_blob_type) {
   // Possibly wakes up the sweeper thread.
   NMethodSweeper::report_allocation(code_blob_type);
   assert_locked_or_safepoint(CodeCache_lock);
@@ -498,7 +499,7 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
   assert(heap != NULL, "heap is null");
 
   while (true) {
-    cb = (CodeBlob*)heap->allocate(size);
+    cb = (CodeBlob*)heap->allocate(size, is_hot);
     if (cb != NULL) break;
     if (!heap->expand_by(CodeCacheExpansionSize)) {
       // Save original type for error reporting
@@ -531,7 +532,7 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
             tty->print_cr("Extension of %s failed. Trying to allocate in %s.",
                           heap->name(), get_code_heap(type)->name());
           }
-          return allocate(size, type, orig_code_blob_type);
+          return allocate(size, type, is_hot, orig_code_blob_type);
         }
       }
       MutexUnlocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
@@ -963,6 +964,7 @@ void CodeCache::initialize() {
 
 void codeCache_init() {
   CodeCache::initialize();
+  LINUX_ONLY(PerfMap::initialize();)
   // Load AOT libraries and add AOT code heaps.
   AOTLoader::initialize();
 }
@@ -1004,6 +1006,7 @@ int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  changes.begin_check();
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     Klass* d = str.klass();
     number_of_marked_CodeBlobs += InstanceKlass::cast(d)->mark_dependent_nmethods(changes);
@@ -1195,12 +1198,15 @@ void CodeCache::flush_dependents_on(InstanceKlass* dependee) {
 
   if (number_of_nmethods_with_dependencies() == 0) return;
 
+  ResourceMark rm;
   KlassDepChange changes(dependee);
 
   // Compute the dependent nmethods
   if (mark_for_deoptimization(changes) > 0) {
-    // At least one nmethod has been marked for deoptimization
-    Deoptimization::deoptimize_all_marked();
+    // At least one nmethod has been marked for deoptimization. Only the
+    // nmethods this change depends on need to be made not entrant, which
+    // saves scanning the whole code cache for each class loaded.
+    Deoptimization::deoptimize_marked(changes.marked_nmethods());
   }
 }
 
@@ -1608,4 +1614,10 @@ void CodeCache::print_names(outputStream *out) {
     CodeHeapState::print_names(out, (*heap));
   }
 }
+
+void CodeCache::print_occupancy(outputStream *out) {
+  FOR_ALL_ALLOCABLE_HEAPS(heap) {
+    CodeHeapState::print_occupancy(out, (*heap));
+  }
+}
 //---<  END  >--- CodeHeap State Analytics.
@@ -53,6 +53,11 @@
 // less detailed information or may just do nothing. It is by intention
 // that an unprotected invocation is not abnormally terminated.
 //
+// The "Occupancy" function is the exception to the above. It only prints
+// counters which the CodeHeap keeps up to date on every allocation and
+// deallocation. It needs neither aggregation nor any lock and is therefore
+// cheap enough to be polled periodically, e.g. by a monitoring agent.
+//
 // Data collection and printing is done on an "on request" basis.
 // While no request is being processed, there is no impact on performance.
 // The CodeHeap state analytics do have some memory footprint.
@@ -2360,6 +2365,36 @@ void CodeHeapState::print_names(outputStream* out, CodeHeap* heap) {
 }
 
 
+// Print the occupancy and fragmentation counters the CodeHeap maintains
+// on every allocation and deallocation. Unlike all other functions here,
+// this one neither requires a preceding aggregation step nor takes any lock.
+// The values are read racily, so they may be slightly inconsistent with
+// each other, but that is good enough for continuous monitoring.
+void CodeHeapState::print_occupancy(outputStream* out, CodeHeap* heap) {
+  const char* heapName      = get_heapName(heap);
+  size_t      reserved      = heap->max_capacity();
+  size_t      committed     = heap->capacity();
+  size_t      used          = heap->allocated_capacity();
+  size_t      in_freelist   = heap->allocated_in_freelist();
+  size_t      tail          = heap->heap_unallocated_capacity();
+  size_t      free_total    = in_freelist + tail;
+  BUFFEREDSTREAM_DECL(ast, out)
+
+  printBox(ast, '-', "Occupancy summary for ", heapName);
+  ast->print_cr("  reserved       = " SIZE_FORMAT_W(10) "k, committed = " SIZE_FORMAT_W(10) "k",
+                reserved/K, committed/K);
+  ast->print_cr("  used           = " SIZE_FORMAT_W(10) "k, peak used = " SIZE_FORMAT_W(10) "k",
+                used/K, heap->max_allocated_capacity()/K);
+  ast->print_cr("  free           = " SIZE_FORMAT_W(10) "k, in %d free blocks: " SIZE_FORMAT "k, unused tail: " SIZE_FORMAT "k",
+                free_total/K, heap->freelist_length(), in_freelist/K, tail/K);
+  ast->print_cr("  fragmentation  = %9.2f%% of free space is in free blocks",
+                (free_total == 0) ? 0.0 : 100.0 * (double)in_freelist / (double)free_total);
+  ast->print_cr("  blobs          = %10d, nmethods = %d, adapters = %d, full count = %d",
+                heap->blob_count(), heap->nmethod_count(), heap->adapter_count(), heap->full_count());
+  BUFFEREDSTREAM_FLUSH_LOCKED("\n")
+}
+
+
 void CodeHeapState::printBox(outputStream* ast, const char border, const char* text1, const char* text2) {
   unsigned int lineLen = 1 + 2 + 2 + 1;
   char edge, frame;
@@ -110,6 +110,7 @@ class CodeHeapState : public CHeapObj<mtCode> {
   static void print_space(outputStream* out, CodeHeap* heap);
   static void print_age(outputStream* out, CodeHeap* heap);
   static void print_names(outputStream* out, CodeHeap* heap);
+  static void print_occupancy(outputStream* out, CodeHeap* heap);
 };
 
 //----------------
@@ -40,6 +40,7 @@
 #include "runtime/handles.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/copy.hpp"
@@ -1988,6 +1989,13 @@ bool DepChange::ContextStream::next() {
   return false;
 }
 
+uint64_t KlassDepChange::_last_check_epoch = 0;
+
+void KlassDepChange::begin_check() {
+  assert_lock_strong(CodeCache_lock);
+  _check_epoch = ++_last_check_epoch;
+}
+
 void KlassDepChange::initialize() {
   // entire transaction must be under this lock:
   assert_lock_strong(Compile_lock);
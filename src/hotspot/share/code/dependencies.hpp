@@ -758,13 +758,18 @@ class KlassDepChange : public DepChange {
  private:
   // each change set is rooted in exactly one new type (at present):
   Klass* _new_type;
+  // the nmethods marked for deoptimization through this change
+  GrowableArray<nmethod*> _marked_nmethods;
+  // identifies this change while nmethods are checked against it, 0 if not begun
+  uint64_t _check_epoch;
+  static uint64_t _last_check_epoch;
 
   void initialize();
 
  public:
   // notes the new type, marks it and all its super-types
   KlassDepChange(Klass* new_type)
-    : _new_type(new_type)
+    : _new_type(new_type), _marked_nmethods(), _check_epoch(0)
   {
     initialize();
   }
@@ -777,10 +782,18 @@ class KlassDepChange : public DepChange {
 
   virtual void mark_for_deoptimization(nmethod* nm) {
     nm->mark_for_deoptimization(/*inc_recompile_counts=*/true);
+    _marked_nmethods.append(nm);
   }
 
+  const GrowableArray<nmethod*>* marked_nmethods() const { return &_marked_nmethods; }
+
   Klass* new_type() { return _new_type; }
 
+  // Called under the CodeCache_lock before the dependent nmethods of all
+  // contexts are checked against this change.
+  void begin_check();
+  uint64_t check_epoch() const { return _check_epoch; }
+
   // involves_context(k) is true if k is new_type or any of the super types
   bool involves_context(Klass* k);
 };
@@ -65,20 +65,39 @@ void DependencyContext::init() {
 //
 int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
   int found = 0;
+  // check_dependency_on() evaluates all contexts of a klass change at once,
+  // so an nmethod found in the dependency contexts of several super types
+  // only needs to be checked the first time.
+  uint64_t epoch = changes.is_klass_change() ? changes.as_klass_change()->check_epoch() : 0;
   for (nmethodBucket* b = dependencies_not_unloading(); b != NULL; b = b->next_not_unloading()) {
     nmethod* nm = b->get_nmethod();
     // since dependencies aren't removed until an nmethod becomes a zombie,
     // the dependency list may contain nmethods which aren't alive.
-    if (b->count() > 0 && nm->is_alive() && !nm->is_marked_for_deoptimization() && nm->check_dependency_on(changes)) {
-      if (TraceDependencies) {
-        ResourceMark rm;
-        tty->print_cr("Marked for deoptimization");
-        changes.print();
-        nm->print();
-        nm->print_dependencies();
+    // A klass change makes only the nmethods it found not entrant, so it
+    // still checks nmethods marked by someone else that are not yet
+    // not entrant instead of relying on that other thread to be done first.
+    bool already_handled = nm->is_marked_for_deoptimization() &&
+                           (!changes.is_klass_change() || nm->is_not_entrant());
+    if (b->count() > 0 && nm->is_alive() && !already_handled) {
+      // Only stamp nmethods that are actually checked, a dead bucket in one
+      // context must not hide a live one in another.
+      if (epoch != 0) {
+        if (nm->dependency_check_epoch() == epoch) {
+          continue;
+        }
+        nm->set_dependency_check_epoch(epoch);
+      }
+      if (nm->check_dependency_on(changes)) {
+        if (TraceDependencies) {
+          ResourceMark rm;
+          tty->print_cr("Marked for deoptimization");
+          changes.print();
+          nm->print();
+          nm->print_dependencies();
+        }
+        changes.mark_for_deoptimization(nm);
+        found++;
       }
-      changes.mark_for_deoptimization(nm);
-      found++;
     }
   }
   return found;
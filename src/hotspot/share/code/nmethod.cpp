@@ -31,6 +31,7 @@
 #include "code/dependencies.hpp"
 #include "code/nativeInst.hpp"
 #include "code/nmethod.hpp"
+#include "code/perfMap.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/abstractCompiler.hpp"
 #include "compiler/compileBroker.hpp"
@@ -431,6 +432,7 @@ void nmethod::init_defaults() {
   _has_flushed_dependencies   = 0;
   _lock_count                 = 0;
   _stack_traversal_mark       = 0;
+  _dependency_check_epoch     = 0;
   _load_reported              = false; // jvmti state
   _unload_reported            = false;
   _is_far_code                = false; // nmethods are located in CodeCache
@@ -526,7 +528,11 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
 #endif
       + align_up(debug_info->data_size()           , oopSize);
 
-    nm = new (nmethod_size, comp_level)
+    // Keep the code of frequently invoked methods together at low addresses
+    bool is_hot = HotCodeInvocationThreshold > 0 && comp_level == CompLevel_full_optimization &&
+                  method->invocation_count() >= HotCodeInvocationThreshold;
+
+    nm = new (nmethod_size, comp_level, is_hot)
     nmethod(method(), compiler->type(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -701,6 +707,10 @@ void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw
   return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
 }
 
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level, bool is_hot) throw () {
+  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level), is_hot);
+}
+
 nmethod::nmethod(
   Method* method,
   CompilerType type,
@@ -1588,6 +1598,12 @@ void nmethod::post_compiled_method_load_event(JvmtiThreadState* state) {
       m->signature()->utf8_length(),
       insts_begin(), insts_size());
 
+#ifdef LINUX
+  if (state == NULL) {
+    // A non-NULL state is a JVMTI GenerateEvents replay of already reported code
+    PerfMap::write(this);
+  }
+#endif
 
   if (JvmtiExport::should_post_compiled_method_load()) {
     // Only post unload events if load events are found.
@@ -2116,10 +2132,9 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
     return res;
   }
 
-  // Fallback algorithm: quasi-linear search for the PcDesc
+  // Fallback algorithm: binary search for the PcDesc
   // Find the last pc_offset less than the given offset.
   // The successor must be the required match, if there is a match at all.
-  // (Use a fixed radix to avoid expensive affine pointer arithmetic.)
   PcDesc* lower = search.scopes_pcs_begin();
   PcDesc* upper = search.scopes_pcs_end();
   upper -= 1; // exclude final sentinel
@@ -2140,35 +2155,20 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
     upper = mid;
   }
 
-  // Take giant steps at first (4096, then 256, then 16, then 1)
-  const int LOG2_RADIX = 4 /*smaller steps in debug mode:*/ debug_only(-1);
-  const int RADIX = (1 << LOG2_RADIX);
-  for (int step = (1 << (LOG2_RADIX*3)); step > 1; step >>= LOG2_RADIX) {
-    while ((mid = lower + step) < upper) {
-      assert_LU_OK;
-      NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
-      if (mid->pc_offset() < pc_offset) {
-        lower = mid;
-      } else {
-        upper = mid;
-        break;
-      }
-    }
-    assert_LU_OK;
-  }
-
-  // Sneak up on the value with a linear search of length ~16.
-  while (true) {
+  // Halve the range while keeping lower->pc_offset() < pc_offset <=
+  // upper->pc_offset(). Once upper is the successor of lower, upper is the
+  // first PcDesc at or after pc_offset, the only one that can match.
+  while (upper - lower > 1) {
     assert_LU_OK;
-    mid = lower + 1;
+    mid = lower + ((upper - lower) >> 1);
     NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
     if (mid->pc_offset() < pc_offset) {
       lower = mid;
     } else {
       upper = mid;
-      break;
     }
   }
+  assert_LU_OK;
 #undef assert_LU_OK
 
   if (match_desc(upper, pc_offset, approximate)) {
@@ -264,6 +264,10 @@ class nmethod : public CompiledMethod {
   // counter is decreased (by 1) while sweeping.
   int _hotness_counter;
 
+  // The KlassDepChange::check_epoch() of the last class hierarchy change
+  // this nmethod's dependencies were checked against (see DependencyContext).
+  uint64_t _dependency_check_epoch;
+
   // Local state used to keep track of whether unloading is happening or not
   volatile uint8_t _is_unloading_state;
 
@@ -322,6 +326,7 @@ class nmethod : public CompiledMethod {
 
   // helper methods
   void* operator new(size_t size, int nmethod_size, int comp_level) throw();
+  void* operator new(size_t size, int nmethod_size, int comp_level, bool is_hot) throw();
 
   const char* reloc_string_for(u_char* begin, u_char* end);
 
@@ -536,6 +541,8 @@ public:
 
   // Sweeper support
   long  stack_traversal_mark()                    { return _stack_traversal_mark; }
+  uint64_t dependency_check_epoch() const         { return _dependency_check_epoch; }
+  void  set_dependency_check_epoch(uint64_t e)    { _dependency_check_epoch = e; }
   void  set_stack_traversal_mark(long l)          { _stack_traversal_mark = l; }
 
   // On-stack replacement support
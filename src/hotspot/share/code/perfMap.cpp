@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "code/nmethod.hpp"
+#include "code/perfMap.hpp"
+#include "logging/log.hpp"
+#include "oops/method.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+#ifdef LINUX
+
+FILE* PerfMap::_file = NULL;
+
+void PerfMap::initialize() {
+  assert(_file == NULL, "invariant");
+  if (!WritePerfMap) {
+    return;
+  }
+  char path[JVM_MAXPATHLEN];
+  jio_snprintf(path, sizeof(path), "/tmp/perf-%d.map", os::current_process_id());
+  _file = os::fopen(path, "w");
+  if (_file == NULL) {
+    log_warning(codecache)("Could not open perf map file %s", path);
+    return;
+  }
+  // perf may read the map while the VM is running, so only ever expose whole lines.
+  // Each line is written by a single fprintf, which locks the stream.
+  setvbuf(_file, NULL, _IOLBF, 0);
+}
+
+void PerfMap::write(const char* name, address start, address end) {
+  if (_file != NULL && start < end) {
+    fprintf(_file, INTPTR_FORMAT " " SIZE_FORMAT_HEX " %s\n",
+            p2i(start), pointer_delta(end, start, sizeof(u1)), name);
+  }
+}
+
+void PerfMap::write(nmethod* nm) {
+  if (_file != NULL) {
+    char name[1024];
+    nm->method()->name_and_sig_as_C_string(name, sizeof(name));
+    write(name, nm->insts_begin(), nm->insts_end());
+  }
+}
+
+#endif // LINUX
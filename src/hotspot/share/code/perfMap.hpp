@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CODE_PERFMAP_HPP
+#define SHARE_CODE_PERFMAP_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class nmethod;
+
+// PerfMap writes /tmp/perf-<pid>.map, the symbol file read by the Linux
+// perf tool, incrementally as code is installed (-XX:+WritePerfMap).
+// Compiled methods are named after their method; stubs, adapters and the
+// interpreter after the names they are registered with. perf resolves an
+// address against the latest entry covering it, so entries for code that
+// has been freed are never removed.
+class PerfMap : AllStatic {
+ private:
+  static FILE* _file;
+ public:
+  static void initialize();
+  static void write(const char* name, address start, address end);
+  static void write(nmethod* nm);
+};
+
+#endif // SHARE_CODE_PERFMAP_HPP
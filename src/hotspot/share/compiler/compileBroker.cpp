@@ -78,6 +78,9 @@
 #ifdef COMPILER2
 #include "opto/c2compiler.hpp"
 #endif
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeMemorySampler.hpp"
+#endif
 
 #ifdef DTRACE_ENABLED
 
@@ -406,6 +409,8 @@ void CompileQueue::free_all() {
     CompileTask::free(current);
   }
   _first = NULL;
+  _num_candidates = 0;
+  _last_scanned = NULL;
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -500,6 +505,11 @@ void CompileQueue::purge_stale_tasks() {
 
 void CompileQueue::remove(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  remove_candidate(task);
+  if (task == _last_scanned) {
+    // The tasks after it are still the ones that have not been scanned.
+    _last_scanned = task->prev();
+  }
   if (task->prev() != NULL) {
     task->prev()->set_next(task->next());
   } else {
@@ -518,6 +528,27 @@ void CompileQueue::remove(CompileTask* task) {
   --_size;
 }
 
+void CompileQueue::remove_candidate(CompileTask* task) {
+  for (int i = 0; i < _num_candidates; i++) {
+    if (_candidates[i] == task) {
+      for (int j = i + 1; j < _num_candidates; j++) {
+        _candidates[j - 1] = _candidates[j];
+      }
+      _num_candidates--;
+      return;
+    }
+  }
+}
+
+void CompileQueue::set_candidates(CompileTask** tasks, int n) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  assert(n <= max_candidates, "too many candidates");
+  for (int i = 0; i < n; i++) {
+    _candidates[i] = tasks[i];
+  }
+  _num_candidates = n;
+}
+
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
   remove(task);
@@ -1052,9 +1083,20 @@ void CompileBroker::init_compiler_sweeper_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+int CompileBroker::compiler_thread_cpu_budget() {
+  if (CompilerThreadsCPUPercentage >= 100) {
+    // The default: the number of compiler threads is not capped by the CPUs.
+    return max_jint;
+  }
+  // os::active_processor_count() takes the container CPU quota into account.
+  int budget = (int)(os::active_processor_count() * CompilerThreadsCPUPercentage / 100);
+  return MAX2(budget, 1);
+}
+
 void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
 
   julong available_memory = os::available_memory();
+  int cpu_budget = compiler_thread_cpu_budget();
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -1068,6 +1110,9 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    // Leave room for the C1 threads that are already running.
+    int c1_running = (_compilers[0] != NULL) ? _compilers[0]->num_compiler_threads() : 0;
+    new_c2_count = MIN2(new_c2_count, MAX2(cpu_budget - c1_running, 1));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1121,6 +1166,8 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    int c2_running = (_compilers[1] != NULL) ? _compilers[1]->num_compiler_threads() : 0;
+    new_c1_count = MIN2(new_c1_count, MAX2(cpu_budget - c2_running, 1));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2002,6 +2049,7 @@ void CompileBroker::compiler_thread_loop() {
         assert(!thread->has_pending_exception(), "should have been handled");
       }
     }
+    JFR_ONLY(JfrNativeMemorySampler::on_compilation_end(thread);)
   }
 
   // Shut down compiler runtime
@@ -2843,6 +2891,13 @@ void CompileBroker::print_heapinfo(outputStream* out, const char* function, size
     out = tty;
   }
 
+  // The occupancy counters are maintained by the CodeHeap itself.
+  // Print them right away, without acquiring any of the locks below.
+  if (!strcmp(function, "Occupancy")) {
+    CodeCache::print_occupancy(out);
+    return;
+  }
+
   if (!(aggregate || usedSpace || freeSpace || methodCount || methodSpace || methodAge || methodNames || discard)) {
     out->print_cr("\n__ CodeHeapStateAnalytics: Function %s is not supported", function);
     out->cr();
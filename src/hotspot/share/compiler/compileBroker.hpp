@@ -79,6 +79,9 @@ class CompilerCounters : public CHeapObj<mtCompiler> {
 //
 // A list of CompileTasks.
 class CompileQueue : public CHeapObj<mtCompiler> {
+ public:
+  enum { max_candidates = 16 };
+
  private:
   const char* _name;
 
@@ -89,7 +92,18 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Selection state that the compilation policy can keep between calls
+  // to select_task(), so that it does not have to rescan the whole queue
+  // for every selection. _candidates holds the best tasks found by the
+  // last scan, in the order of the policy. Tasks after _last_scanned have
+  // been added since then. Tasks are dropped from both when removed.
+  CompileTask* _candidates[max_candidates];
+  int          _num_candidates;
+  CompileTask* _last_scanned;
+  jlong        _last_full_scan_ms;
+
   void purge_stale_tasks();
+  void remove_candidate(CompileTask* task);
  public:
   CompileQueue(const char* name) {
     _name = name;
@@ -97,6 +111,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _last = NULL;
     _size = 0;
     _first_stale = NULL;
+    _num_candidates = 0;
+    _last_scanned = NULL;
+    _last_full_scan_ms = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -112,6 +129,14 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  // Selection state, see above
+  int          num_candidates() const            { return _num_candidates; }
+  CompileTask* candidate(int i) const            { assert(i < _num_candidates, "oob"); return _candidates[i]; }
+  void         set_candidates(CompileTask** tasks, int n);
+  CompileTask* last_scanned() const              { return _last_scanned; }
+  void         set_last_scanned(CompileTask* task) { _last_scanned = task; }
+  jlong        last_full_scan_ms() const         { return _last_full_scan_ms; }
+  void         set_last_full_scan_ms(jlong t)    { _last_full_scan_ms = t; }
 
   // Redefine Classes support
   void mark_on_stack();
@@ -295,6 +320,10 @@ public:
     CompileQueue *q = compile_queue(comp_level);
     return q != NULL ? q->size() : 0;
   }
+  // Number of compiler threads which may run concurrently without exceeding
+  // CompilerThreadsCPUPercentage of the available processors. Unlimited
+  // (max_jint) when CompilerThreadsCPUPercentage is 100.
+  static int compiler_thread_cpu_budget();
   static void compilation_init_phase1(Thread* THREAD);
   static void compilation_init_phase2();
   static void init_compiler_thread_log();
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/symbolTable.hpp"
+#include "compiler/profileSnapshot.hpp"
+#include "interpreter/invocationCounter.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/methodCounters.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+struct ProfileSnapshotKey {
+  Symbol* _klass_name;
+  Symbol* _name;
+  Symbol* _signature;
+
+  static unsigned hash(const ProfileSnapshotKey& k) {
+    return k._klass_name->identity_hash() ^
+           (k._name->identity_hash() * 31) ^
+           (k._signature->identity_hash() * 961);
+  }
+
+  static bool equals(const ProfileSnapshotKey& a, const ProfileSnapshotKey& b) {
+    return a._klass_name == b._klass_name &&
+           a._name == b._name &&
+           a._signature == b._signature;
+  }
+};
+
+struct ProfileSnapshotCounts {
+  uint _invocation_count;
+  uint _backedge_count;
+};
+
+typedef ResourceHashtable<ProfileSnapshotKey, ProfileSnapshotCounts,
+                          ProfileSnapshotKey::hash, ProfileSnapshotKey::equals,
+                          15889, ResourceObj::C_HEAP, mtCompiler> ProfileSnapshotTable;
+
+// Written once during VM initialization, and only read afterwards.
+static ProfileSnapshotTable* _table = NULL;
+
+static const char* header = "# profile snapshot version 1";
+
+// Keep the seeded counts away from the overflow handling of InvocationCounter.
+static uint clamp_count(julong count) {
+  return (uint)MIN2(count, (julong)(InvocationCounter::count_limit / 2));
+}
+
+// Returns the next space separated token in the line, and advances the line
+// past it. The token is NUL terminated in place.
+static char* next_token(char** line) {
+  char* p = *line;
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  if (*p == '\0' || *p == '\n' || *p == '\r') {
+    return NULL;
+  }
+  char* token = p;
+  while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') {
+    p++;
+  }
+  if (*p != '\0') {
+    *p++ = '\0';
+  }
+  *line = p;
+  return token;
+}
+
+static bool parse_count(const char* token, julong* count) {
+  if (token == NULL) {
+    return false;
+  }
+  char* end;
+  *count = (julong)strtoull(token, &end, 10);
+  return *end == '\0';
+}
+
+static bool parse_line(char* line, ProfileSnapshotKey* key, ProfileSnapshotCounts* counts) {
+  char* tag = next_token(&line);
+  if (tag == NULL || strcmp(tag, "method") != 0) {
+    return false;
+  }
+  char* klass_name = next_token(&line);
+  char* name = next_token(&line);
+  char* signature = next_token(&line);
+  julong invocation_count;
+  julong backedge_count;
+  if (klass_name == NULL || name == NULL || signature == NULL ||
+      !parse_count(next_token(&line), &invocation_count) ||
+      !parse_count(next_token(&line), &backedge_count) ||
+      next_token(&line) != NULL) {
+    return false;
+  }
+  // The symbols are kept alive by the table.
+  key->_klass_name = SymbolTable::new_symbol(klass_name);
+  key->_name = SymbolTable::new_symbol(name);
+  key->_signature = SymbolTable::new_symbol(signature);
+  counts->_invocation_count = clamp_count(invocation_count);
+  counts->_backedge_count = clamp_count(backedge_count);
+  return true;
+}
+
+void ProfileSnapshot::initialize() {
+  if (ProfileSnapshotFile == NULL) {
+    return;
+  }
+  FILE* file = os::fopen(ProfileSnapshotFile, "rt");
+  if (file == NULL) {
+    if (DumpProfileSnapshotAtExit) {
+      // This is the first run, the file is created at exit.
+      log_info(jit)("No profile snapshot %s to load", ProfileSnapshotFile);
+    } else {
+      log_warning(jit)("Cannot open profile snapshot %s", ProfileSnapshotFile);
+    }
+    return;
+  }
+
+  ProfileSnapshotTable* table = new (ResourceObj::C_HEAP, mtCompiler) ProfileSnapshotTable();
+  char line[4 * K];
+  int line_no = 0;
+  int num_methods = 0;
+  int num_errors = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    line_no++;
+    if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+      continue;
+    }
+    if (strchr(line, '\n') == NULL && !feof(file)) {
+      // Too long. Skip the rest of it.
+      int c;
+      while ((c = fgetc(file)) != EOF && c != '\n') {}
+      num_errors++;
+      continue;
+    }
+    ProfileSnapshotKey key;
+    ProfileSnapshotCounts counts;
+    if (parse_line(line, &key, &counts)) {
+      table->put(key, counts);
+      num_methods++;
+    } else {
+      log_debug(jit)("Malformed line %d in profile snapshot %s", line_no, ProfileSnapshotFile);
+      num_errors++;
+    }
+  }
+  fclose(file);
+
+  if (num_errors > 0) {
+    log_warning(jit)("Ignored %d malformed lines in profile snapshot %s", num_errors, ProfileSnapshotFile);
+  }
+  log_info(jit)("Loaded %d methods from profile snapshot %s", num_methods, ProfileSnapshotFile);
+  _table = table;
+}
+
+bool ProfileSnapshot::is_loaded() {
+  return _table != NULL;
+}
+
+void ProfileSnapshot::seed(Method* m, MethodCounters* counters) {
+  assert(is_loaded(), "must be");
+  ProfileSnapshotKey key;
+  key._klass_name = m->klass_name();
+  key._name = m->name();
+  key._signature = m->signature();
+  ProfileSnapshotCounts* counts = _table->get(key);
+  if (counts != NULL) {
+    counters->invocation_counter()->set(counts->_invocation_count);
+    counters->backedge_counter()->set(counts->_backedge_count);
+  }
+}
+
+class ProfileSnapshotKlassClosure : public KlassClosure {
+  outputStream* _out;
+  int _num_methods;
+
+  // Names with white space cannot be parsed back.
+  static bool is_printable(Symbol* s) {
+    for (int i = 0; i < s->utf8_length(); i++) {
+      char c = s->char_at(i);
+      if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ public:
+  ProfileSnapshotKlassClosure(outputStream* out) : _out(out), _num_methods(0) {}
+
+  int num_methods() const { return _num_methods; }
+
+  void do_klass(Klass* k) {
+    if (!k->is_instance_klass() || InstanceKlass::cast(k)->is_hidden() ||
+        !is_printable(k->name())) {
+      return;
+    }
+    Array<Method*>* methods = InstanceKlass::cast(k)->methods();
+    for (int i = 0; i < methods->length(); i++) {
+      Method* m = methods->at(i);
+      if (m->method_counters() == NULL || m->is_native() || m->is_abstract()) {
+        continue;
+      }
+      int invocation_count = m->invocation_count();
+      int backedge_count = m->backedge_count();
+      if ((invocation_count <= 0 && backedge_count <= 0) ||
+          !is_printable(m->name()) || !is_printable(m->signature())) {
+        continue;
+      }
+      _out->print("method ");
+      k->name()->print_symbol_on(_out);
+      _out->print(" ");
+      m->name()->print_symbol_on(_out);
+      _out->print(" ");
+      m->signature()->print_symbol_on(_out);
+      _out->print_cr(" %d %d", MAX2(invocation_count, 0), MAX2(backedge_count, 0));
+      _num_methods++;
+    }
+  }
+};
+
+void ProfileSnapshot::dump(outputStream* out) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  ResourceMark rm;
+  ProfileSnapshotKlassClosure cl(out);
+  out->print_cr("%s", header);
+  ClassLoaderDataGraph::loaded_classes_do(&cl);
+  log_info(jit)("Wrote %d methods to profile snapshot", cl.num_methods());
+}
+
+class VM_DumpProfileSnapshot : public VM_Operation {
+ private:
+  outputStream* _out;
+ public:
+  VM_DumpProfileSnapshot(outputStream* out) : _out(out) {}
+
+  virtual VMOp_Type type() const { return VMOp_DumpProfileSnapshot; }
+
+  virtual void doit() {
+    ProfileSnapshot::dump(_out);
+  }
+};
+
+bool ProfileSnapshot::dump(const char* filename) {
+  fileStream out(filename, "w");
+  if (!out.is_open()) {
+    log_warning(jit)("Cannot open profile snapshot %s for writing", filename);
+    return false;
+  }
+  VM_DumpProfileSnapshot op(&out);
+  VMThread::execute(&op);
+  return true;
+}
+
+void profileSnapshot_init() {
+  ProfileSnapshot::initialize();
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_COMPILER_PROFILESNAPSHOT_HPP
+#define SHARE_COMPILER_PROFILESNAPSHOT_HPP
+
+#include "memory/allocation.hpp"
+
+class Method;
+class MethodCounters;
+class outputStream;
+
+// A profile snapshot records the invocation and backedge counts of the
+// methods of the loaded classes, so that a later run of the application
+// can start with them (see ProfileSnapshotFile). Counters of methods in
+// the snapshot are seeded when they are created, so that hot methods are
+// compiled without having to gather their counts again.
+//
+// The snapshot is a text file, with one line per method in the form
+//   method <klass> <name> <signature> <invocation count> <backedge count>
+// Methods are matched by name only, regardless of their class loader.
+class ProfileSnapshot : AllStatic {
+ public:
+  // Load ProfileSnapshotFile, if set.
+  static void initialize();
+  static bool is_loaded();
+
+  // Seed the counters of the method from the snapshot, if it is in there.
+  static void seed(Method* m, MethodCounters* counters);
+
+  // Write the snapshot of the loaded methods. Must be called at a safepoint.
+  static void dump(outputStream* out);
+
+  // Write the snapshot of the loaded methods to the named file.
+  // Returns false if the file cannot be opened.
+  static bool dump(const char* filename);
+};
+
+#endif // SHARE_COMPILER_PROFILESNAPSHOT_HPP
@@ -394,54 +394,109 @@ void TieredThresholdPolicy::handle_counter_overflow(Method* method) {
   }
 }
 
+// Remove the task from the queue. Unless its method was unloaded, report
+// the removal and allow the method to be queued again.
+void TieredThresholdPolicy::remove_from_queue(CompileQueue* compile_queue, CompileTask* task) {
+  if (!task->is_unloaded()) {
+    Method* method = task->method();
+    if (PrintTieredEvents) {
+      print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+    }
+    method->clear_queued_for_compilation();
+  }
+  compile_queue->remove_and_mark_stale(task);
+}
+
+// Returns true if the task has been removed from the queue because its
+// method was unloaded or has been stale for some time.
+// Blocking tasks and tasks submitted from whitebox API don't become stale.
+bool TieredThresholdPolicy::maybe_remove_task(CompileQueue* compile_queue, CompileTask* task, jlong t) {
+  Method* method = task->method();
+  if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+    remove_from_queue(compile_queue, task);
+    return true;
+  }
+  return false;
+}
+
+// Return true if task x should be selected before task y.
+// In blocking compilation mode, the CompileBroker will make
+// compilations submitted by a JVMCI compiler thread non-blocking. These
+// compilations should be scheduled after all blocking compilations
+// to service non-compiler related compilations sooner and reduce the
+// chance of such compilations timing out.
+bool TieredThresholdPolicy::select_before(CompileTask* x, CompileTask* y) {
+  if (x->is_blocking() != y->is_blocking()) {
+    return x->is_blocking();
+  }
+  return compare_methods(x->method(), y->method());
+}
+
+// Insert the task into the sorted array of the best n tasks.
+void TieredThresholdPolicy::add_candidate(CompileTask** candidates, int* n, CompileTask* task) {
+  int i = *n;
+  while (i > 0 && select_before(task, candidates[i - 1])) {
+    i--;
+  }
+  if (i == CompileQueue::max_candidates) {
+    return;
+  }
+  int last = MIN2(*n, (int)CompileQueue::max_candidates - 1);
+  for (int j = last; j > i; j--) {
+    candidates[j] = candidates[j - 1];
+  }
+  candidates[i] = task;
+  *n = last + 1;
+}
+
+// Tasks are selected by the rate of events of their methods, and the rates
+// are sampled at most once every TieredRateUpdateMinTime milliseconds.
+// Only then is the whole queue scanned. In between, the selection is made
+// from the best tasks of the last full scan, and the tasks that have been
+// added to the queue since, which keeps selection cheap with large queues.
 // Called with the queue locked and with at least one element
 CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
-  CompileTask *max_blocking_task = NULL;
-  CompileTask *max_task = NULL;
-  Method* max_method = NULL;
+  CompileTask* candidates[CompileQueue::max_candidates];
+  int num_candidates = 0;
   jlong t = nanos_to_millis(os::javaTimeNanos());
-  // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != NULL;) {
-    CompileTask* next_task = task->next();
-    Method* method = task->method();
-    // If a method was unloaded or has been stale for some time, remove it from the queue.
-    // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
-      if (!task->is_unloaded()) {
-        if (PrintTieredEvents) {
-          print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
-        }
-        method->clear_queued_for_compilation();
-      }
-      compile_queue->remove_and_mark_stale(task);
-      task = next_task;
-      continue;
-    }
-    update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
-      // Select a method with the highest rate
-      max_task = task;
-      max_method = method;
-    }
 
-    if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
-        max_blocking_task = task;
+  CompileTask* task;
+  if (compile_queue->num_candidates() == 0 ||
+      t - compile_queue->last_full_scan_ms() >= TieredRateUpdateMinTime) {
+    // Iterate through the queue and find a method with a maximum rate.
+    task = compile_queue->first();
+    compile_queue->set_last_full_scan_ms(t);
+  } else {
+    // Re-sort the candidates, their weights may have changed since.
+    int n = compile_queue->num_candidates();
+    CompileTask* old_candidates[CompileQueue::max_candidates];
+    for (int i = 0; i < n; i++) {
+      old_candidates[i] = compile_queue->candidate(i);
+    }
+    for (int i = 0; i < n; i++) {
+      CompileTask* candidate = old_candidates[i];
+      if (candidate->is_unloaded()) {
+        remove_from_queue(compile_queue, candidate);
+      } else {
+        add_candidate(candidates, &num_candidates, candidate);
       }
     }
+    task = compile_queue->last_scanned() != NULL ? compile_queue->last_scanned()->next() : compile_queue->first();
+  }
 
+  while (task != NULL) {
+    CompileTask* next_task = task->next();
+    if (!maybe_remove_task(compile_queue, task, t)) {
+      update_rate(t, task->method());
+      add_candidate(candidates, &num_candidates, task);
+    }
     task = next_task;
   }
+  compile_queue->set_candidates(candidates, num_candidates);
+  compile_queue->set_last_scanned(compile_queue->last());
 
-  if (max_blocking_task != NULL) {
-    // In blocking compilation mode, the CompileBroker will make
-    // compilations submitted by a JVMCI compiler thread non-blocking. These
-    // compilations should be scheduled after all blocking compilations
-    // to service non-compiler related compilations sooner and reduce the
-    // chance of such compilations timing out.
-    max_task = max_blocking_task;
-    max_method = max_task->method();
-  }
+  CompileTask* max_task = num_candidates > 0 ? candidates[0] : NULL;
+  Method* max_method = max_task != NULL ? max_task->method() : NULL;
 
   methodHandle max_method_h(Thread::current(), max_method);
 
@@ -451,11 +506,7 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
     max_task->set_comp_level(CompLevel_limited_profile);
 
     if (CompileBroker::compilation_is_complete(max_method_h, max_task->osr_bci(), CompLevel_limited_profile)) {
-      if (PrintTieredEvents) {
-        print_event(REMOVE_FROM_QUEUE, max_method, max_method, max_task->osr_bci(), (CompLevel)max_task->comp_level());
-      }
-      compile_queue->remove_and_mark_stale(max_task);
-      max_method->clear_queued_for_compilation();
+      remove_from_queue(compile_queue, max_task);
       return NULL;
     }
 
@@ -689,6 +740,11 @@ bool TieredThresholdPolicy::is_method_profiled(const methodHandle& method) {
 
 double TieredThresholdPolicy::threshold_scale(CompLevel level, int feedback_k) {
   int comp_count = compiler_count(level);
+  if (UseDynamicNumberOfCompilerThreads && CompilerThreadsCPUPercentage < 100) {
+    // Not all compiler threads will be started if that exceeds the CPU budget,
+    // so scale by the number of threads that can actually drain the queue.
+    comp_count = MIN2(comp_count, CompileBroker::compiler_thread_cpu_budget());
+  }
   if (comp_count > 0) {
     double queue_size = CompileBroker::queue_size(level);
     double k = queue_size / (feedback_k * comp_count) + 1;
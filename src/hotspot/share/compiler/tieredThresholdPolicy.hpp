@@ -204,6 +204,11 @@ class TieredThresholdPolicy : public CompilationPolicy {
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline void update_rate(jlong t, Method* m);
+  // Helpers for select_task()
+  void remove_from_queue(CompileQueue* compile_queue, CompileTask* task);
+  bool maybe_remove_task(CompileQueue* compile_queue, CompileTask* task, jlong t);
+  bool select_before(CompileTask* x, CompileTask* y);
+  void add_candidate(CompileTask** candidates, int* n, CompileTask* task);
   // Compute threshold scaling coefficient
   inline double threshold_scale(CompLevel level, int feedback_k);
   // If a method is old enough and is still in the interpreter we would want to
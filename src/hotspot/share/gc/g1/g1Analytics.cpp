@@ -225,7 +225,19 @@ void G1Analytics::report_rs_length(double rs_length) {
 }
 
 double G1Analytics::predict_alloc_rate_ms() const {
-  return predict_zero_bounded(_alloc_rate_ms_seq);
+  // The decaying average lags behind a steadily increasing allocation rate.
+  // Also consider the linear trend of the recent samples so that the young
+  // gen grows ahead of a ramp up instead of after it.
+  double average = predict_zero_bounded(_alloc_rate_ms_seq);
+  if (_alloc_rate_ms_seq->num() < 2) {
+    // No trend can be fitted to fewer than two samples.
+    return average;
+  }
+  double trend = _alloc_rate_ms_seq->predict_next();
+  if (g_isnan(trend)) {
+    return average;
+  }
+  return MAX2(average, trend);
 }
 
 double G1Analytics::predict_concurrent_refine_rate_ms() const {
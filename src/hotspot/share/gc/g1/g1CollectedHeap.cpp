@@ -72,7 +72,7 @@
 #include "gc/shared/gcBehaviours.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
-#include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcLocker.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/generationSpec.hpp"
@@ -2259,6 +2259,22 @@ bool G1CollectedHeap::try_collect(GCCause::Cause cause) {
   }
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  if (heap_region_containing(obj)->is_pinned()) {
+    return obj;
+  }
+  // Entering the critical region may wait for a GC that moves obj.
+  Handle h(thread, obj);
+  GCLocker::lock_critical(thread);
+  return h();
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  if (!heap_region_containing(obj)->is_pinned()) {
+    GCLocker::unlock_critical(thread);
+  }
+}
+
 bool G1CollectedHeap::is_in(const void* p) const {
   if (_hrm->reserved().contains(p)) {
     // Given that we know that p is in the reserved space,
@@ -3069,6 +3085,7 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
         double sample_end_time_sec = os::elapsedTime();
         double pause_time_ms = (sample_end_time_sec - sample_start_time_sec) * MILLIUNITS;
         policy()->record_collection_pause_end(pause_time_ms, concurrent_operation_is_full_mark);
+        g1mm()->record_pause_times(pause_time_ms, phase_times());
       }
 
       verify_after_young_collection(verify_type);
@@ -3593,12 +3610,7 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -3607,8 +3619,20 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
-
-      return obj->is_typeArray() &&
+      //
+      // Humongous objArrays are only nominated while neither marking nor
+      // remembered set rebuild is in progress, so they can not be on the
+      // mark stack or be scanned by the rebuild. Their references induce
+      // remembered set entries on other regions that become stale once
+      // the object is reclaimed. These are harmless: cards of free and
+      // young regions are never scanned, and scanning a stale card of a
+      // region that has been reused only finds the objects actually there.
+
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      return obj->is_objArray() &&
+             !_g1h->collector_state()->mark_or_rebuild_in_progress() &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
@@ -4425,10 +4449,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
     // are completely up-to-date wrt to references to the humongous object.
     //
     // Other implementation considerations:
-    // - never consider object arrays at this time because they would pose
-    // considerable effort for cleaning up the the remembered sets. This is
-    // required because stale remembered sets might reference locations that
-    // are currently allocated into.
+    // - object arrays are only candidates if they were nominated outside of
+    // concurrent mark and remembered set rebuild; the remembered set entries
+    // they induced on other regions are left stale.
     uint region_idx = r->hrm_index();
     if (!g1h->is_humongous_reclaim_candidate(region_idx) ||
         !r->rem_set()->is_empty()) {
@@ -4445,8 +4468,8 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
       return false;
     }
 
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Dead humongous region %u object size " SIZE_FORMAT " start " PTR_FORMAT " with remset " SIZE_FORMAT " code roots " SIZE_FORMAT " is marked %d reclaim candidate %d type array %d",
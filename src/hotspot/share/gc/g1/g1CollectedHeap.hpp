@@ -1136,6 +1136,13 @@ public:
   void decrement_summary_bytes(size_t bytes);
 
   virtual bool is_in(const void* p) const;
+
+  // Objects in humongous and archive regions are never moved, so JNI
+  // critical regions on them need not block GC. Other objects use the
+  // GCLocker.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
 #ifdef ASSERT
   // Returns whether p is in one of the available areas of the heap. Slow but
   // extensive version.
@@ -64,6 +64,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/java.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/prefetch.inline.hpp"
@@ -388,6 +389,7 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   _concurrent(false),
   _has_aborted(false),
   _restart_for_overflow(false),
+  _metaspace_purge_pending(false),
   _gc_timer_cm(new (ResourceObj::C_HEAP, mtGC) ConcurrentGCTimer()),
   _gc_tracer_cm(new (ResourceObj::C_HEAP, mtGC) G1OldTracer()),
 
@@ -1151,8 +1153,8 @@ void G1ConcurrentMark::remark() {
       reclaim_empty_regions();
     }
 
-    // Clean out dead classes
-    if (ClassUnloadingWithConcurrentMark) {
+    // Clean out dead classes, unless that has been deferred to after Remark.
+    if (ClassUnloadingWithConcurrentMark && !_metaspace_purge_pending) {
       GCTraceTime(Debug, gc, phases) debug("Purge Metaspace", _gc_timer_cm);
       ClassLoaderDataGraph::purge(/*at_safepoint*/true);
     }
@@ -1621,7 +1623,11 @@ void G1ConcurrentMark::weak_refs_work(bool clear_all_soft_refs) {
   if (ClassUnloadingWithConcurrentMark) {
     GCTraceTime(Debug, gc, phases) debug("Class Unloading", _gc_timer_cm);
     bool purged_classes = SystemDictionary::do_unloading(_gc_timer_cm);
+    // The inline caches of the surviving nmethods must be cleaned in this
+    // pause: G1 has no nmethod entry barriers, so once the mutators resume
+    // nothing stops them from calling into an unloaded nmethod.
     _g1h->complete_cleaning(&g1_is_alive, purged_classes);
+    _metaspace_purge_pending = G1ConcurrentMetaspacePurge;
   } else if (StringDedup::is_enabled()) {
     GCTraceTime(Debug, gc, phases) debug("String Deduplication", _gc_timer_cm);
     _g1h->string_dedup_cleaning(&g1_is_alive, NULL);
@@ -1954,6 +1960,27 @@ void G1ConcurrentMark::rebuild_rem_set_concurrently() {
   _g1h->rem_set()->rebuild_rem_set(this, _concurrent_workers, _worker_id_offset);
 }
 
+class G1RendezvousClosure : public HandshakeClosure {
+public:
+  G1RendezvousClosure() : HandshakeClosure("G1Rendezvous") {}
+  void do_thread(Thread* thread) {}
+};
+
+void G1ConcurrentMark::purge_metaspace_concurrently() {
+  if (!_metaspace_purge_pending) {
+    return;
+  }
+  _metaspace_purge_pending = false;
+
+  // Make sure that no thread still reads the metadata of the unloaded classes.
+  G1RendezvousClosure cl;
+  Handshake::execute(&cl);
+
+  // Stay in the suspendible thread set, so that a Full GC can not purge concurrently.
+  SuspendibleThreadSetJoiner sts;
+  ClassLoaderDataGraph::purge(/*at_safepoint*/false);
+}
+
 void G1ConcurrentMark::print_stats() {
   if (!log_is_enabled(Debug, gc, stats)) {
     return;
@@ -2831,7 +2858,7 @@ G1CMTask::G1CMTask(uint worker_id,
   _cm(cm),
   _next_mark_bitmap(NULL),
   _task_queue(task_queue),
-  _mark_stats_cache(mark_stats, RegionMarkStatsCacheSize),
+  _mark_stats_cache(mark_stats, G1RegionMarkStatsCache::num_cache_entries_for(_g1h->max_reserved_regions())),
   _calls(0),
   _time_target_ms(0.0),
   _start_time_ms(0.0),
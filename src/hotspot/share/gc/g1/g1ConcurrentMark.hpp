@@ -347,6 +347,10 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   // another concurrent marking phase should start
   volatile bool           _restart_for_overflow;
 
+  // Set by Remark if purging the metadata of the unloaded classes has been
+  // deferred to the concurrent phase following it.
+  bool                    _metaspace_purge_pending;
+
   ConcurrentGCTimer*      _gc_timer_cm;
 
   G1OldTracer*            _gc_tracer_cm;
@@ -601,6 +605,9 @@ public:
 private:
   // Rebuilds the remembered sets for chosen regions in parallel and concurrently to the application.
   void rebuild_rem_set_concurrently();
+
+  // Purges the metadata of the classes unloaded in Remark.
+  void purge_metaspace_concurrently();
 };
 
 // A class representing a marking task.
@@ -617,10 +624,6 @@ private:
     init_hash_seed                = 17
   };
 
-  // Number of entries in the per-task stats entry. This seems enough to have a very
-  // low cache miss rate.
-  static const uint RegionMarkStatsCacheSize = 1024;
-
   G1CMObjArrayProcessor       _objArray_processor;
 
   uint                        _worker_id;
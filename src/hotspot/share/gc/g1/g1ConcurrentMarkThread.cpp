@@ -245,6 +245,14 @@ bool G1ConcurrentMarkThread::subphase_remark() {
   return _cm->has_aborted();
 }
 
+bool G1ConcurrentMarkThread::phase_purge_metaspace() {
+  if (G1ConcurrentMetaspacePurge) {
+    G1ConcPhaseTimer p(_cm, "Concurrent Purge Metaspace");
+    _cm->purge_metaspace_concurrently();
+  }
+  return _cm->has_aborted();
+}
+
 bool G1ConcurrentMarkThread::phase_rebuild_remembered_sets() {
   G1ConcPhaseTimer p(_cm, "Concurrent Rebuild Remembered Sets");
   _cm->rebuild_rem_set_concurrently();
@@ -301,18 +309,22 @@ void G1ConcurrentMarkThread::concurrent_mark_cycle_do() {
   if (phase_scan_root_regions()) return;
 
   // Phase 3: Actual mark loop.
-  if (phase_mark_loop()) return;
+  bool mark_loop_aborted = phase_mark_loop();
+
+  // Phase 4: Purge metaspace. Also runs after an abort, to reset the
+  // pending state; a Full GC has then already purged everything.
+  if (phase_purge_metaspace() || mark_loop_aborted) return;
 
-  // Phase 4: Rebuild remembered sets.
+  // Phase 5: Rebuild remembered sets.
   if (phase_rebuild_remembered_sets()) return;
 
-  // Phase 5: Wait for Cleanup.
+  // Phase 6: Wait for Cleanup.
   if (phase_delay_to_keep_mmu_before_cleanup()) return;
 
-  // Phase 6: Cleanup pause
+  // Phase 7: Cleanup pause
   if (phase_cleanup()) return;
 
-  // Phase 7: Clear bitmap for next mark.
+  // Phase 8: Clear bitmap for next mark.
   phase_clear_bitmap_for_next_mark();
 }
 
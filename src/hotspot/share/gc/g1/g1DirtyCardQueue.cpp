@@ -431,8 +431,13 @@ class G1RefineBufferedCards : public StackObj {
   const size_t _node_buffer_size;
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
+  G1CollectedHeap* const _g1h;
   G1RemSet* const _g1rs;
 
+  // Upper bound on the number of cards refined together, to limit the time
+  // between checks for a pending safepoint.
+  static const size_t MaxCoalescedCards = 64;
+
   static inline int compare_card(const CardTable::CardValue* p1,
                                  const CardTable::CardValue* p2) {
     return p2 - p1;
@@ -485,16 +490,38 @@ class G1RefineBufferedCards : public StackObj {
     return first_clean;
   }
 
+  // Returns the number of cards starting at start_index that form a run of
+  // consecutive cards within a single region. Large object arrays typically
+  // leave many such runs, and refining them with a single iteration avoids
+  // repeating the per-card setup for every card.
+  size_t consecutive_cards(size_t start_index) const {
+    CardTable::CardValue* const first = _node_buffer[start_index];
+    const HeapRegion* r = _g1h->heap_region_containing(_g1h->card_table()->addr_for(first));
+    const size_t max_index = MIN2(_node_buffer_size, start_index + MaxCoalescedCards);
+    size_t i = start_index + 1;
+    // The cards are sorted in decreasing address order.
+    while (i < max_index && _node_buffer[i] == _node_buffer[i - 1] - 1) {
+      if (_g1h->heap_region_containing(_g1h->card_table()->addr_for(_node_buffer[i])) != r) {
+        break;
+      }
+      i++;
+    }
+    return i - start_index;
+  }
+
   bool refine_cleaned_cards(size_t start_index) {
     bool result = true;
     size_t i = start_index;
-    for ( ; i < _node_buffer_size; ++i) {
+    while (i < _node_buffer_size) {
       if (SuspendibleThreadSet::should_yield()) {
         redirty_unrefined_cards(i);
         result = false;
         break;
       }
-      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+      size_t num_cards = consecutive_cards(i);
+      // Pass the lowest card of the run.
+      _g1rs->refine_cards_concurrently(_node_buffer[i + num_cards - 1], num_cards, _worker_id);
+      i += num_cards;
     }
     _node->set_index(i);
     _stats->inc_refined_cards(i - start_index);
@@ -517,7 +544,8 @@ public:
     _node_buffer_size(node_buffer_size),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1h(G1CollectedHeap::heap()),
+    _g1rs(_g1h->rem_set()) {}
 
   bool refine() {
     size_t first_clean_index = clean_cards();
@@ -30,7 +30,7 @@
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
-#include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "oops/access.inline.hpp"
@@ -216,7 +216,18 @@ public:
                                         &_log_buffer_cl,
                                         during_concurrent_start,
                                         _worker_id);
-    hr->object_iterate(&rspc);
+    // Only [evac_failure_bottom, evac_failure_top) can contain self-forwarded
+    // objects. The space below and above is dead and is zapped as a whole,
+    // the former on the first self-forwarded object, the latter below.
+    HeapWord* p = hr->evac_failure_bottom();
+    HeapWord* const limit = hr->evac_failure_top();
+    assert(p != NULL && limit != NULL, "region %u has no failed objects", hr->hrm_index());
+    while (p < limit) {
+      if (hr->block_is_obj(p)) {
+        rspc.do_object(oop(p));
+      }
+      p += hr->block_size(p);
+    }
     // Need to zap the remainder area of the processed region.
     rspc.zap_remainder();
 
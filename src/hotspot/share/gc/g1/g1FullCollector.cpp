@@ -117,11 +117,19 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap, bool explicit_gc, bool c
     _is_subject_mutator(heap->ref_processor_stw(), &_always_subject_to_discovery) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
 
+  uint const max_regions = heap->max_reserved_regions();
+  _live_stats = NEW_C_HEAP_ARRAY(G1RegionMarkStats, max_regions, mtGC);
+  _skip_compacting = NEW_C_HEAP_ARRAY(bool, max_regions, mtGC);
+  for (uint i = 0; i < max_regions; i++) {
+    _live_stats[i].clear();
+    _skip_compacting[i] = false;
+  }
+
   _preserved_marks_set.init(_num_workers);
   _markers = NEW_C_HEAP_ARRAY(G1FullGCMarker*, _num_workers, mtGC);
   _compaction_points = NEW_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _num_workers, mtGC);
   for (uint i = 0; i < _num_workers; i++) {
-    _markers[i] = new G1FullGCMarker(i, _preserved_marks_set.get(i), mark_bitmap());
+    _markers[i] = new G1FullGCMarker(i, _preserved_marks_set.get(i), mark_bitmap(), _live_stats);
     _compaction_points[i] = new G1FullGCCompactionPoint();
     _oop_queue_set.register_queue(i, marker(i)->oop_stack());
     _array_queue_set.register_queue(i, marker(i)->objarray_stack());
@@ -135,6 +143,8 @@ G1FullCollector::~G1FullCollector() {
   }
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
+  FREE_C_HEAP_ARRAY(G1RegionMarkStats, _live_stats);
+  FREE_C_HEAP_ARRAY(bool, _skip_compacting);
 }
 
 void G1FullCollector::prepare_collection() {
@@ -210,6 +220,11 @@ void G1FullCollector::phase1_mark_live_objects() {
     reference_processing.execute(scope()->timer(), scope()->tracer());
   }
 
+  // All live objects have been marked, flush the gathered live words.
+  for (uint i = 0; i < workers(); i++) {
+    marker(i)->flush_mark_stats_cache();
+  }
+
   // Weak oops cleanup.
   {
     GCTraceTime(Debug, gc, phases) debug("Phase 1: Weak Processing", scope()->timer());
@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1FULLGCMARKER_HPP
 
 #include "gc/g1/g1FullGCOopClosures.hpp"
+#include "gc/g1/g1RegionMarkStatsCache.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "memory/iterator.hpp"
@@ -60,8 +61,10 @@ class G1FullGCMarker : public CHeapObj<mtGC> {
   G1FollowStackClosure _stack_closure;
   CLDToOopClosure      _cld_closure;
 
+  // Per-region live words gathered during marking.
+  G1RegionMarkStatsCache _mark_stats_cache;
+
   inline bool is_empty();
-  inline bool pop_object(oop& obj);
   inline bool pop_objarray(ObjArrayTask& array);
   inline void push_objarray(oop obj, size_t index);
   inline bool mark_object(oop obj);
@@ -71,7 +74,10 @@ class G1FullGCMarker : public CHeapObj<mtGC> {
   inline void follow_array(objArrayOop array);
   inline void follow_array_chunk(objArrayOop array, int index);
 public:
-  G1FullGCMarker(uint worker_id, PreservedMarks* preserved_stack, G1CMBitMap* bitmap);
+  G1FullGCMarker(uint worker_id,
+                 PreservedMarks* preserved_stack,
+                 G1CMBitMap* bitmap,
+                 G1RegionMarkStats* mark_stats);
   ~G1FullGCMarker();
 
   // Stack getters
@@ -89,6 +95,9 @@ public:
                         ObjArrayTaskQueueSet* array_stacks,
                         TaskTerminator* terminator);
 
+  // Flush the gathered live words into the global statistics.
+  void flush_mark_stats_cache();
+
   // Closure getters
   CLDToOopClosure*      cld_closure()   { return &_cld_closure; }
   G1MarkAndPushClosure* mark_closure()  { return &_mark_closure; }
@@ -26,9 +26,11 @@
 #define SHARE_GC_G1_G1FULLGCMARKER_INLINE_HPP
 
 #include "gc/g1/g1Allocator.inline.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1FullGCMarker.hpp"
 #include "gc/g1/g1FullGCOopClosures.inline.hpp"
+#include "gc/g1/g1RegionMarkStatsCache.inline.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1StringDedupQueue.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
@@ -60,6 +62,10 @@ inline bool G1FullGCMarker::mark_object(oop obj) {
   if (G1StringDedup::is_enabled()) {
     G1StringDedup::enqueue_from_mark(obj, _worker_id);
   }
+
+  // Collect live words.
+  uint const region_idx = G1CollectedHeap::heap()->addr_to_region(cast_from_oop<HeapWord*>(obj));
+  _mark_stats_cache.add_live_words(region_idx, (size_t)obj->size());
   return true;
 }
 
@@ -81,10 +87,6 @@ inline bool G1FullGCMarker::is_empty() {
   return _oop_stack.is_empty() && _objarray_stack.is_empty();
 }
 
-inline bool G1FullGCMarker::pop_object(oop& oop) {
-  return _oop_stack.pop_overflow(oop) || _oop_stack.pop_local(oop);
-}
-
 inline void G1FullGCMarker::push_objarray(oop obj, size_t index) {
   ObjArrayTask task(obj, index);
   assert(task.is_valid(), "bad ObjArrayTask");
@@ -152,7 +154,15 @@ inline void G1FullGCMarker::follow_object(oop obj) {
 void G1FullGCMarker::drain_stack() {
   do {
     oop obj;
-    while (pop_object(obj)) {
+    // Move overflowed entries back to the task queue, where other workers
+    // can steal them, and only process those that do not fit.
+    while (_oop_stack.pop_overflow(obj)) {
+      if (!_oop_stack.try_push_to_taskqueue(obj)) {
+        assert(_bitmap->is_marked(obj), "must be marked");
+        follow_object(obj);
+      }
+    }
+    while (_oop_stack.pop_local(obj)) {
       assert(_bitmap->is_marked(obj), "must be marked");
       follow_object(obj);
     }
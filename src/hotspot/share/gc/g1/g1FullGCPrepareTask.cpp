@@ -50,7 +50,11 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       free_humongous_region(hr);
     }
   } else if (!hr->is_pinned()) {
-    prepare_for_compaction(hr);
+    if (should_skip_compacting(hr)) {
+      prepare_for_skip_compacting(hr);
+    } else {
+      prepare_for_compaction(hr);
+    }
   }
 
   // Reset data structures not valid after Full GC.
@@ -78,7 +82,7 @@ bool G1FullGCPrepareTask::has_freed_regions() {
 void G1FullGCPrepareTask::work(uint worker_id) {
   Ticks start = Ticks::now();
   G1FullGCCompactionPoint* compaction_point = collector()->compaction_point(worker_id);
-  G1CalculatePointersClosure closure(collector()->mark_bitmap(), compaction_point);
+  G1CalculatePointersClosure closure(collector(), compaction_point);
   G1CollectedHeap::heap()->heap_region_par_iterate_from_start(&closure, &_hrclaimer);
 
   // Update humongous region sets
@@ -92,10 +96,11 @@ void G1FullGCPrepareTask::work(uint worker_id) {
   log_task("Prepare compaction task", worker_id, start);
 }
 
-G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1CMBitMap* bitmap,
+G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1FullCollector* collector,
                                                                             G1FullGCCompactionPoint* cp) :
     _g1h(G1CollectedHeap::heap()),
-    _bitmap(bitmap),
+    _collector(collector),
+    _bitmap(collector->mark_bitmap()),
     _cp(cp),
     _humongous_regions_removed(0) { }
 
@@ -161,6 +166,47 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(Hea
   prepare_for_compaction_work(_cp, hr);
 }
 
+bool G1FullGCPrepareTask::G1CalculatePointersClosure::should_skip_compacting(HeapRegion* hr) {
+  return _collector->live_words(hr->hrm_index()) >= _collector->scope()->region_compaction_threshold();
+}
+
+void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_skip_compacting(HeapRegion* hr) {
+  // The region is dense enough that moving its live objects is not worth
+  // the few words gained. Leave the live objects in place and make the
+  // region parsable by filling the dead ranges between them, since the
+  // classes of dead objects may already have been unloaded. The block
+  // offset table is rebuilt for the resulting layout.
+  _collector->set_skip_compacting(hr->hrm_index());
+
+  HeapWord* const limit = hr->top();
+  HeapWord* current = hr->bottom();
+  HeapWord* threshold = hr->initialize_threshold();
+
+  while (current < limit) {
+    HeapWord* block_end = _bitmap->get_next_marked_addr(current, limit);
+    if (block_end == current) {
+      oop obj = oop(current);
+      // Live objects keep their location. As in G1FullGCCompactionPoint::forward(),
+      // reset a mark word that looks like a forwarding pointer; the original mark
+      // has been preserved during marking if needed.
+      if (obj->forwardee() != NULL) {
+        obj->init_mark();
+      }
+      block_end = current + obj->size();
+    } else {
+      CollectedHeap::fill_with_object(current, block_end);
+    }
+    if (block_end > threshold) {
+      threshold = hr->cross_threshold(current, block_end);
+    }
+    current = block_end;
+  }
+  assert(current == limit, "Should stop the scan at the limit.");
+
+  // The region is not compacted, so its compaction top is its top.
+  hr->set_compaction_top(limit);
+}
+
 void G1FullGCPrepareTask::prepare_serial_compaction() {
   GCTraceTime(Debug, gc, phases) debug("Phase 2: Prepare Serial Compaction", collector()->scope()->timer());
   // At this point we know that no regions were completely freed by
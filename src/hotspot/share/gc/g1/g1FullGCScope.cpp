@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1FullGCScope.hpp"
+#include "gc/g1/heapRegion.hpp"
 
 G1FullGCScope::G1FullGCScope(G1MonitoringSupport* monitoring_support, bool explicit_gc, bool clear_soft) :
     _rm(),
@@ -37,7 +38,12 @@ G1FullGCScope::G1FullGCScope(G1MonitoringSupport* monitoring_support, bool expli
     _cpu_time(),
     _soft_refs(clear_soft, _g1h->soft_ref_policy()),
     _monitoring_scope(monitoring_support, true /* full_gc */, true /* all_memory_pools_affected */),
-    _heap_transition(_g1h) {
+    _heap_transition(_g1h),
+    // When clearing soft references the full gc should reclaim as much space
+    // as possible, so only skip compacting regions that are completely live.
+    _region_compaction_threshold(clear_soft ?
+                                 HeapRegion::GrainWords :
+                                 (size_t)((1 - MarkSweepDeadRatio / 100.0) * HeapRegion::GrainWords)) {
   _timer.register_gc_start();
   _tracer.report_gc_start(_g1h->gc_cause(), _timer.gc_start());
   _g1h->pre_full_gc_dump(&_timer);
@@ -75,3 +81,7 @@ G1FullGCTracer* G1FullGCScope::tracer() {
 G1HeapTransition* G1FullGCScope::heap_transition() {
   return &_heap_transition;
 }
+
+size_t G1FullGCScope::region_compaction_threshold() const {
+  return _region_compaction_threshold;
+}
@@ -283,6 +283,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_strong_code_root_purge_time_ms = ms;
   }
 
+  double cur_merge_heap_roots_time_ms() const {
+    return _cur_merge_heap_roots_time_ms;
+  }
+
   void record_merge_heap_roots_time(double ms) {
     _cur_merge_heap_roots_time_ms += ms;
   }
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegionRemSet.hpp"
 #include "g1HeapRegionEventSender.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "runtime/vmThread.hpp"
@@ -37,6 +38,8 @@ public:
     evt.set_type(r->get_trace_type());
     evt.set_start((uintptr_t)r->bottom());
     evt.set_used(r->used());
+    evt.set_liveBytes(r->live_bytes());
+    evt.set_remSetCards(r->rem_set()->occupied());
     evt.commit();
     return false;
   }
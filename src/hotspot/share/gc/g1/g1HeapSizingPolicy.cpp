@@ -28,6 +28,7 @@
 #include "gc/g1/g1Analytics.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -63,6 +64,11 @@ double G1HeapSizingPolicy::scale_with_heap(double pause_time_threshold) {
   return threshold;
 }
 
+size_t G1HeapSizingPolicy::soft_max_capacity() const {
+  size_t soft_max = align_up(SoftMaxHeapSize, HeapRegion::GrainBytes);
+  return clamp(soft_max, MinHeapSize, _g1h->max_capacity());
+}
+
 static void log_expansion(double short_term_pause_time_ratio,
                           double long_term_pause_time_ratio,
                           double threshold,
@@ -92,7 +98,9 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
 
   size_t expand_bytes = 0;
 
-  if (_g1h->capacity() == _g1h->max_capacity()) {
+  // Beyond the soft maximum we only grow at full collections, when the
+  // live data does not fit otherwise.
+  if (_g1h->capacity() >= soft_max_capacity()) {
     log_expansion(short_term_pause_time_ratio, long_term_pause_time_ratio,
                   threshold, pause_time_threshold, true, 0);
     clear_ratio_check_data();
@@ -123,7 +131,7 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   if ((_ratio_over_threshold_count == MinOverThresholdForGrowth) ||
       (filled_history_buffer && (long_term_pause_time_ratio > threshold))) {
     size_t min_expand_bytes = HeapRegion::GrainBytes;
-    size_t reserved_bytes = _g1h->max_capacity();
+    size_t reserved_bytes = soft_max_capacity();
     size_t committed_bytes = _g1h->capacity();
     size_t uncommitted_bytes = reserved_bytes - committed_bytes;
     size_t expand_bytes_via_pct =
@@ -236,6 +244,10 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // with respect to the heap max size as it's an upper bound (i.e.,
   // we'll try to make the capacity smaller than it, not greater).
   maximum_desired_capacity =  MAX2(maximum_desired_capacity, MinHeapSize);
+  // Shrink toward the soft maximum heap size, but not below what the live
+  // data needs.
+  maximum_desired_capacity = MAX2(MIN2(maximum_desired_capacity, soft_max_capacity()),
+                                  minimum_desired_capacity);
 
   // Don't expand unless it's significant; prefer expansion to shrinking.
   if (capacity_after_gc < minimum_desired_capacity) {
@@ -49,6 +49,10 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // eagerly at small heap sizes.
   double scale_with_heap(double pause_time_threshold);
 
+  // The capacity the heap should steer toward, i.e. SoftMaxHeapSize bounded
+  // by the minimum and maximum heap size.
+  size_t soft_max_capacity() const;
+
   G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 public:
 
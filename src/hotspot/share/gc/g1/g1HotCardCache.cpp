@@ -41,6 +41,9 @@ void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
 
     _hot_cache_size = (size_t)1 << G1ConcRSLogCacheSize;
     _hot_cache = ArrayAllocator<CardValue*>::allocate(_hot_cache_size, mtGC);
+    for (size_t i = 0; i < _hot_cache_size; i++) {
+      _hot_cache[i] = NULL;
+    }
 
     reset_hot_cache_internal();
 
@@ -77,18 +80,12 @@ CardTable::CardValue* G1HotCardCache::insert(CardValue* card_ptr) {
     Atomic::store(&_cache_wrapped_around, true);
   }
   size_t masked_index = index & (_hot_cache_size - 1);
-  CardValue* current_ptr = _hot_cache[masked_index];
-
-  // Try to store the new card pointer into the cache. Compare-and-swap to guard
-  // against the unlikely event of a race resulting in another card pointer to
-  // have already been written to the cache. In this case we will return
-  // card_ptr in favor of the other option, which would be starting over. This
-  // should be OK since card_ptr will likely be the older card already when/if
-  // this ever happens.
-  CardValue* previous_ptr = Atomic::cmpxchg(&_hot_cache[masked_index],
-                                            current_ptr,
-                                            card_ptr);
-  return (previous_ptr == current_ptr) ? previous_ptr : card_ptr;
+
+  // Store the new card pointer into the cache and return the evicted one.
+  // An exchange cannot fail, so even if another thread raced for the same
+  // slot after a wrap around, every card ends up either in the cache or
+  // returned for refinement without a retry.
+  return Atomic::xchg(&_hot_cache[masked_index], card_ptr);
 }
 
 void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_id) {
@@ -97,12 +94,16 @@ void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_id) {
   assert(_hot_cache != NULL, "Logic");
   assert(!use_cache(), "cache should be disabled");
 
-  while (_hot_cache_par_claimed_idx < _hot_cache_size) {
+  // Until the cache wrapped around only the slots up to the insertion index
+  // have been used, so do not claim chunks beyond.
+  size_t const limit = _cache_wrapped_around ? _hot_cache_size : MIN2(_hot_cache_idx, _hot_cache_size);
+
+  while (_hot_cache_par_claimed_idx < limit) {
     size_t end_idx = Atomic::add(&_hot_cache_par_claimed_idx,
                                  _hot_cache_par_chunk_size);
     size_t start_idx = end_idx - _hot_cache_par_chunk_size;
     // The current worker has successfully claimed the chunk [start_idx..end_idx)
-    end_idx = MIN2(end_idx, _hot_cache_size);
+    end_idx = MIN2(end_idx, limit);
     for (size_t i = start_idx; i < end_idx; i++) {
       CardValue* card_ptr = _hot_cache[i];
       if (card_ptr != NULL) {
@@ -144,8 +144,11 @@ private:
  private:
   void reset_hot_cache_internal() {
     assert(_hot_cache != NULL, "Logic");
+    // Only the slots up to the insertion index are in use unless the
+    // cache wrapped around.
+    size_t const used = _cache_wrapped_around ? _hot_cache_size : MIN2(_hot_cache_idx, _hot_cache_size);
     _hot_cache_idx = 0;
-    for (size_t i = 0; i < _hot_cache_size; i++) {
+    for (size_t i = 0; i < used; i++) {
       _hot_cache[i] = NULL;
     }
     _cache_wrapped_around = false;
@@ -24,10 +24,12 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/shared/hSpaceCounters.hpp"
+#include "gc/shared/timeHistogramCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
 #include "services/memoryPool.hpp"
 
@@ -100,6 +102,10 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _eden_space_counters(NULL),
   _from_space_counters(NULL),
   _to_space_counters(NULL),
+  _pause_histogram(NULL),
+  _ext_root_scan_histogram(NULL),
+  _merge_heap_roots_histogram(NULL),
+  _obj_copy_histogram(NULL),
 
   _overall_committed(0),
   _overall_used(0),
@@ -129,6 +135,14 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _conc_collection_counters =
     new CollectorCounters("G1 concurrent cycle pauses", 2);
 
+  //  names "collector.0.pauseTime", "collector.0.extRootScanTime", ...
+  // Histograms of the young collection pause times and their main phases.
+  const char* incremental_collection_name_space = _incremental_collection_counters->name_space();
+  _pause_histogram = new TimeHistogramCounters(incremental_collection_name_space, "pauseTime");
+  _ext_root_scan_histogram = new TimeHistogramCounters(incremental_collection_name_space, "extRootScanTime");
+  _merge_heap_roots_histogram = new TimeHistogramCounters(incremental_collection_name_space, "mergeHeapRootsTime");
+  _obj_copy_histogram = new TimeHistogramCounters(incremental_collection_name_space, "objCopyTime");
+
   // "Generation" and "Space" counters.
   //
   //  name "generation.1" This is logically the old generation in
@@ -225,18 +239,21 @@ GrowableArray<MemoryPool*> G1MonitoringSupport::memory_pools() {
 void G1MonitoringSupport::recalculate_sizes() {
   assert_heap_locked_or_at_safepoint(true);
 
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-  // Recalculate all the sizes from scratch.
+  // Recalculate all the sizes from scratch. Updates are serialized by the
+  // Heap_lock or the safepoint, so the calculation is done without holding
+  // MonitoringSupport_lock; the lock is only taken to publish the results.
+  // This keeps memory pool readers from stalling the allocation slow path
+  // (which gets here via update_eden_size()) for longer than a few stores.
 
   // This never includes used bytes of current allocating heap region.
-  _overall_used = _g1h->used_unlocked();
-  _eden_space_used = _g1h->eden_regions_used_bytes();
-  _survivor_space_used = _g1h->survivor_regions_used_bytes();
+  size_t overall_used = _g1h->used_unlocked();
+  size_t eden_space_used = _g1h->eden_regions_used_bytes();
+  size_t survivor_space_used = _g1h->survivor_regions_used_bytes();
 
-  // _overall_used and _eden_space_used are obtained concurrently so
-  // may be inconsistent with each other. To prevent _old_gen_used going negative,
+  // overall_used and eden_space_used are obtained concurrently so
+  // may be inconsistent with each other. To prevent old_gen_used going negative,
   // use smaller value to substract.
-  _old_gen_used = _overall_used - MIN2(_overall_used, _eden_space_used + _survivor_space_used);
+  size_t old_gen_used = overall_used - MIN2(overall_used, eden_space_used + survivor_space_used);
 
   uint survivor_list_length = _g1h->survivor_regions_count();
   // Max length includes any potential extensions to the young gen
@@ -246,45 +263,56 @@ void G1MonitoringSupport::recalculate_sizes() {
   uint eden_list_max_length = young_list_max_length - survivor_list_length;
 
   // First calculate the committed sizes that can be calculated independently.
-  _survivor_space_committed = survivor_list_length * HeapRegion::GrainBytes;
-  _old_gen_committed = HeapRegion::align_up_to_region_byte_size(_old_gen_used);
+  size_t survivor_space_committed = survivor_list_length * HeapRegion::GrainBytes;
+  size_t old_gen_committed = HeapRegion::align_up_to_region_byte_size(old_gen_used);
 
   // Next, start with the overall committed size.
-  _overall_committed = _g1h->capacity();
-  size_t committed = _overall_committed;
+  size_t overall_committed = _g1h->capacity();
+  size_t committed = overall_committed;
 
   // Remove the committed size we have calculated so far (for the
   // survivor and old space).
-  assert(committed >= (_survivor_space_committed + _old_gen_committed), "sanity");
-  committed -= _survivor_space_committed + _old_gen_committed;
+  assert(committed >= (survivor_space_committed + old_gen_committed), "sanity");
+  committed -= survivor_space_committed + old_gen_committed;
 
   // Next, calculate and remove the committed size for the eden.
-  _eden_space_committed = (size_t) eden_list_max_length * HeapRegion::GrainBytes;
+  size_t eden_space_committed = (size_t) eden_list_max_length * HeapRegion::GrainBytes;
   // Somewhat defensive: be robust in case there are inaccuracies in
   // the calculations
-  _eden_space_committed = MIN2(_eden_space_committed, committed);
-  committed -= _eden_space_committed;
+  eden_space_committed = MIN2(eden_space_committed, committed);
+  committed -= eden_space_committed;
 
   // Finally, give the rest to the old space...
-  _old_gen_committed += committed;
-  // ..and calculate the young gen committed.
-  _young_gen_committed = _eden_space_committed + _survivor_space_committed;
+  old_gen_committed += committed;
 
-  assert(_overall_committed ==
-         (_eden_space_committed + _survivor_space_committed + _old_gen_committed),
+  assert(overall_committed ==
+         (eden_space_committed + survivor_space_committed + old_gen_committed),
          "the committed sizes should add up");
   // Somewhat defensive: cap the eden used size to make sure it
   // never exceeds the committed size.
-  _eden_space_used = MIN2(_eden_space_used, _eden_space_committed);
-  // _survivor_space_used is calculated during a safepoint and _survivor_space_committed
+  eden_space_used = MIN2(eden_space_used, eden_space_committed);
+  // survivor_space_used is calculated during a safepoint and survivor_space_committed
   // is calculated from survivor region count * heap region size.
-  assert(_survivor_space_used <= _survivor_space_committed, "Survivor used bytes(" SIZE_FORMAT
+  assert(survivor_space_used <= survivor_space_committed, "Survivor used bytes(" SIZE_FORMAT
          ") should be less than or equal to survivor committed(" SIZE_FORMAT ")",
-         _survivor_space_used, _survivor_space_committed);
-  // _old_gen_committed is calculated in terms of _old_gen_used value.
-  assert(_old_gen_used <= _old_gen_committed, "Old gen used bytes(" SIZE_FORMAT
+         survivor_space_used, survivor_space_committed);
+  // old_gen_committed is calculated in terms of old_gen_used value.
+  assert(old_gen_used <= old_gen_committed, "Old gen used bytes(" SIZE_FORMAT
          ") should be less than or equal to old gen committed(" SIZE_FORMAT ")",
-         _old_gen_used, _old_gen_committed);
+         old_gen_used, old_gen_committed);
+
+  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
+  _overall_used = overall_used;
+  _eden_space_used = eden_space_used;
+  _survivor_space_used = survivor_space_used;
+  _old_gen_used = old_gen_used;
+
+  _overall_committed = overall_committed;
+  _eden_space_committed = eden_space_committed;
+  _survivor_space_committed = survivor_space_committed;
+  _old_gen_committed = old_gen_committed;
+  // ..and calculate the young gen committed.
+  _young_gen_committed = eden_space_committed + survivor_space_committed;
 }
 
 void G1MonitoringSupport::update_sizes() {
@@ -316,6 +344,15 @@ void G1MonitoringSupport::update_eden_size() {
   }
 }
 
+void G1MonitoringSupport::record_pause_times(double pause_time_ms, G1GCPhaseTimes* phase_times) {
+  if (UsePerfData) {
+    _pause_histogram->record(pause_time_ms);
+    _ext_root_scan_histogram->record(phase_times->average_time_ms(G1GCPhaseTimes::ExtRootScan));
+    _merge_heap_roots_histogram->record(phase_times->cur_merge_heap_roots_time_ms());
+    _obj_copy_histogram->record(phase_times->average_time_ms(G1GCPhaseTimes::ObjCopy));
+  }
+}
+
 MemoryUsage G1MonitoringSupport::eden_space_memory_usage(size_t initial_size, size_t max_size) {
   MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
 
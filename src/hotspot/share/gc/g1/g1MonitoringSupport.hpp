@@ -33,8 +33,10 @@
 
 class CollectorCounters;
 class G1CollectedHeap;
+class G1GCPhaseTimes;
 class HSpaceCounters;
 class MemoryPool;
+class TimeHistogramCounters;
 
 // Class for monitoring logical spaces in G1. It provides data for
 // both G1's jstat counters as well as G1's memory pools.
@@ -156,6 +158,12 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
   HSpaceCounters*      _from_space_counters;
   HSpaceCounters*      _to_space_counters;
 
+  // Histograms of young and mixed pause times and of their main phases
+  TimeHistogramCounters* _pause_histogram;
+  TimeHistogramCounters* _ext_root_scan_histogram;
+  TimeHistogramCounters* _merge_heap_roots_histogram;
+  TimeHistogramCounters* _obj_copy_histogram;
+
   // When it's appropriate to recalculate the various sizes (at the
   // end of a GC, when a new eden region is allocated, etc.) we store
   // them here so that we can easily report them when needed and not
@@ -210,6 +218,9 @@ public:
 
   void update_eden_size();
 
+  // Record the total time and the main phase times of a young or mixed pause.
+  void record_pause_times(double pause_time_ms, G1GCPhaseTimes* phase_times);
+
   CollectorCounters* conc_collection_counters() {
     return _conc_collection_counters;
   }
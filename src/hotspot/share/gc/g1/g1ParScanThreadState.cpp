@@ -31,6 +31,7 @@
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1Trace.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "memory/allocation.inline.hpp"
@@ -54,7 +55,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
                                            uint worker_id,
                                            uint n_workers,
                                            size_t young_cset_length,
-                                           size_t optional_cset_length)
+                                           size_t optional_cset_length,
+                                           uint* worker_node_indices)
   : _g1h(g1h),
     _task_queue(g1h->task_queue(worker_id)),
     _rdcq(rdcqs),
@@ -77,6 +79,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _partial_array_stepper(n_workers),
     _num_optional_regions(optional_cset_length),
     _numa(g1h->numa()),
+    _worker_node_indices(worker_node_indices),
+    _n_workers(n_workers),
     _obj_alloc_stat(NULL)
 {
   // We allocate number of young gen regions in the collection set plus one
@@ -102,6 +106,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
   _oops_into_optional_regions = new G1OopStarChunkedList[_num_optional_regions];
 
   initialize_numa_stats();
+
+  update_worker_node_index();
 }
 
 size_t G1ParScanThreadState::flush(size_t* surviving_young_words) {
@@ -303,10 +309,44 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
   } while (!_task_queue->overflow_empty());
 }
 
+uint G1ParScanThreadState::update_worker_node_index() {
+  if (_worker_node_indices == NULL) {
+    return G1NUMA::UnknownNodeIndex;
+  }
+  // The thread running this worker id may change between the tasks of a
+  // pause, so look up the node again rather than caching it.
+  uint node_index = _numa->index_of_current_thread();
+  Atomic::store(&_worker_node_indices[_worker_id], node_index);
+  return node_index;
+}
+
+bool G1ParScanThreadState::steal_on_same_node(G1ScannerTasksQueueSet* task_queues, uint node_index, ScannerTask& t) {
+  if (node_index == G1NUMA::UnknownNodeIndex) {
+    return false;
+  }
+  uint victim = _worker_id;
+  uint victim_size = 0;
+  for (uint i = 0; i < _n_workers; i++) {
+    if (i == _worker_id || Atomic::load(&_worker_node_indices[i]) != node_index) {
+      continue;
+    }
+    uint size = task_queues->queue(i)->size();
+    if (size > victim_size) {
+      victim = i;
+      victim_size = size;
+    }
+  }
+  return victim_size > 0 && task_queues->queue(victim)->pop_global(t);
+}
+
 ATTRIBUTE_FLATTEN
 void G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet* task_queues) {
   ScannerTask stolen_task;
-  while (task_queues->steal(_worker_id, stolen_task)) {
+  uint node_index = update_worker_node_index();
+  // Prefer work from the same node, as cross-node copying is considerably
+  // slower. Fall back to stealing from any queue to keep the load balanced.
+  while (steal_on_same_node(task_queues, node_index, stolen_task) ||
+         task_queues->steal(_worker_id, stolen_task)) {
     dispatch_task(stolen_task);
     // Processing stolen task may have added tasks to our queue.
     trim_queue();
@@ -445,7 +485,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     if (obj_ptr == NULL) {
       // This will either forward-to-self, or detect that someone else has
       // installed a forwarding pointer.
-      return handle_evacuation_failure_par(old, old_mark);
+      return handle_evacuation_failure_par(old, old_mark, word_sz);
     }
   }
 
@@ -458,7 +498,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     // Doing this after all the allocation attempts also tests the
     // undo_allocation() method too.
     undo_allocation(dest_attr, obj_ptr, word_sz, node_index);
-    return handle_evacuation_failure_par(old, old_mark);
+    return handle_evacuation_failure_par(old, old_mark, word_sz);
   }
 #endif // !PRODUCT
 
@@ -547,7 +587,8 @@ G1ParScanThreadState* G1ParScanThreadStateSet::state_for_worker(uint worker_id)
     _states[worker_id] =
       new G1ParScanThreadState(_g1h, _rdcqs,
                                worker_id, _n_workers,
-                               _young_cset_length, _optional_cset_length);
+                               _young_cset_length, _optional_cset_length,
+                               _worker_node_indices);
   }
   return _states[worker_id];
 }
@@ -599,7 +640,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
 }
 
 NOINLINE
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -611,6 +652,8 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
       r->set_evacuation_failed(true);
      _g1h->hr_printer()->evac_failure(r);
     }
+    HeapWord* obj_start = cast_from_oop<HeapWord*>(old);
+    r->note_evacuation_failure(obj_start, obj_start + word_sz);
 
     _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
 
@@ -668,10 +711,17 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
     _young_cset_length(young_cset_length),
     _optional_cset_length(optional_cset_length),
     _n_workers(n_workers),
+    _worker_node_indices(NULL),
     _flushed(false) {
   for (uint i = 0; i < n_workers; ++i) {
     _states[i] = NULL;
   }
+  if (g1h->numa()->is_enabled()) {
+    _worker_node_indices = NEW_C_HEAP_ARRAY(uint, n_workers, mtGC);
+    for (uint i = 0; i < n_workers; ++i) {
+      _worker_node_indices[i] = G1NUMA::UnknownNodeIndex;
+    }
+  }
   memset(_surviving_young_words_total, 0, (young_cset_length + 1) * sizeof(size_t));
 }
 
@@ -679,4 +729,7 @@ G1ParScanThreadStateSet::~G1ParScanThreadStateSet() {
   assert(_flushed, "thread local state from the per thread states should have been flushed");
   FREE_C_HEAP_ARRAY(G1ParScanThreadState*, _states);
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_total);
+  if (_worker_node_indices != NULL) {
+    FREE_C_HEAP_ARRAY(uint, _worker_node_indices);
+  }
 }
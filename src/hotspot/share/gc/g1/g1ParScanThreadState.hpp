@@ -100,6 +100,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   G1NUMA* _numa;
 
+  // The node indices of the threads owning the task queues, indexed by
+  // worker id. Shared by all workers, and NULL if NUMA is disabled.
+  uint* _worker_node_indices;
+  uint _n_workers;
+
   // Records how many object allocations happened at each node during copy to survivor.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
@@ -111,7 +116,8 @@ public:
                        uint worker_id,
                        uint n_workers,
                        size_t young_cset_length,
-                       size_t optional_cset_length);
+                       size_t optional_cset_length,
+                       uint* worker_node_indices);
   virtual ~G1ParScanThreadState();
 
   void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
@@ -210,6 +216,13 @@ private:
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
 
+  // Publishes and returns the node index of the thread currently running
+  // this worker, UnknownNodeIndex if NUMA is disabled.
+  uint update_worker_node_index();
+  // Attempts to steal a task from the fullest queue of the other workers
+  // running on the given NUMA node.
+  bool steal_on_same_node(G1ScannerTasksQueueSet* task_queues, uint node_index, ScannerTask& t);
+
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
 
@@ -221,7 +234,7 @@ public:
   void reset_trim_ticks();
 
   // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markWord m);
+  oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz);
 
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
@@ -239,6 +252,8 @@ class G1ParScanThreadStateSet : public StackObj {
   size_t _young_cset_length;
   size_t _optional_cset_length;
   uint _n_workers;
+  // The NUMA node index of each worker, NULL if NUMA is disabled.
+  uint* _worker_node_indices;
   bool _flushed;
 
  public:
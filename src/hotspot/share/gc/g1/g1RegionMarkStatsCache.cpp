@@ -27,6 +27,10 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+uint G1RegionMarkStatsCache::num_cache_entries_for(uint num_regions) {
+  return clamp(round_up_power_of_2(num_regions), MinNumCacheEntries, MaxNumCacheEntries);
+}
+
 G1RegionMarkStatsCache::G1RegionMarkStatsCache(G1RegionMarkStats* target, uint num_cache_entries) :
   _target(target),
   _cache(NULL),
@@ -98,6 +98,16 @@ private:
 
   G1RegionMarkStatsCacheEntry* find_for_add(uint region_idx);
 public:
+  // Bounds for the number of cache entries. Within these bounds a cache covers
+  // every region of the heap, keeping the cache miss rate low also on heaps
+  // with many regions.
+  static const uint MinNumCacheEntries = 1024;
+  static const uint MaxNumCacheEntries = 16 * 1024;
+
+  // Returns the number of cache entries to use for a heap with the given
+  // number of regions.
+  static uint num_cache_entries_for(uint num_regions);
+
   G1RegionMarkStatsCache(G1RegionMarkStats* target, uint num_cache_entries);
 
   ~G1RegionMarkStatsCache();
@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/stack.inline.hpp"
 #include "utilities/ticks.hpp"
@@ -523,15 +525,23 @@ private:
     return (value & ToScanMask) == 0;
   }
 
-  bool cur_word_of_cards_contains_any_dirty_card() const {
+  // Returns a mask with the ToScanMask bit set for every dirty card in the
+  // word of cards at the current address.
+  size_t cur_word_dirty_cards_mask() const {
     assert(cur_addr_aligned(), "Current address should be aligned");
     size_t const value = *(size_t*)_cur_addr;
-    return (~value & ExpandedToScanMask) != 0;
+    return ~value & ExpandedToScanMask;
   }
 
-  bool cur_word_of_cards_all_dirty_cards() const {
-    size_t const value = *(size_t*)_cur_addr;
-    return value == G1CardTable::WordAllDirty;
+  // Returns the index within the word of cards of the first card that has
+  // its bit set in the given non-zero mask.
+  static size_t first_card_in_word(size_t mask) {
+    assert(mask != 0, "must have a card");
+#ifdef VM_LITTLE_ENDIAN
+    return count_trailing_zeros(mask) / BitsPerByte;
+#else
+    return count_leading_zeros(mask) / BitsPerByte;
+#endif
   }
 
   size_t get_and_advance_pos() {
@@ -559,14 +569,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (cur_word_of_cards_contains_any_dirty_card()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a dirty card in the word.");
+      size_t const dirty = cur_word_dirty_cards_mask();
+      if (dirty != 0) {
+        _cur_addr += first_card_in_word(dirty);
+        assert(cur_card_is_dirty(), "Should be at the dirty card detected in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -585,14 +592,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (!cur_word_of_cards_all_dirty_cards()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (!cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a non-dirty card in the word.");
+      size_t const non_dirty = ~cur_word_dirty_cards_mask() & ExpandedToScanMask;
+      if (non_dirty != 0) {
+        _cur_addr += first_card_in_word(non_dirty);
+        assert(!cur_card_is_dirty(), "Should be at the non-dirty card detected in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -1419,12 +1423,14 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
   return true;
 }
 
-void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
-                                        const uint worker_id) {
+void G1RemSet::refine_cards_concurrently(CardValue* const card_ptr,
+                                         size_t num_cards,
+                                         const uint worker_id) {
   assert(!_g1h->is_gc_active(), "Only call concurrently");
+  assert(num_cards > 0, "must refine at least one card");
   check_card_ptr(card_ptr, _ct);
 
-  // Construct the MemRegion representing the card.
+  // Construct the MemRegion representing the cards.
   HeapWord* start = _ct->addr_for(card_ptr);
   // And find the region containing it.
   HeapRegion* r = _g1h->heap_region_containing(start);
@@ -1437,9 +1443,10 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   HeapWord* scan_limit = r->top();
   assert(scan_limit > start, "sanity");
 
-  // Don't use addr_for(card_ptr + 1) which can ask for
+  // Don't use addr_for(card_ptr + num_cards) which can ask for
   // a card beyond the heap.
-  HeapWord* end = start + G1CardTable::card_size_in_words;
+  HeapWord* end = start + num_cards * G1CardTable::card_size_in_words;
+  assert(end <= r->end(), "Cards must not span regions");
   MemRegion dirty_region(start, MIN2(scan_limit, end));
   assert(!dirty_region.is_empty(), "sanity");
 
@@ -1448,7 +1455,7 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
     return;
   }
 
-  // If unable to process the card then we encountered an unparsable
+  // If unable to process the cards then we encountered an unparsable
   // part of the heap (e.g. a partially allocated object, so only
   // temporarily a problem) while processing a stale card.  Despite
   // the card being stale, we can't simply ignore it, because we've
@@ -1457,16 +1464,18 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   //
   // However, the card might have gotten re-dirtied and re-enqueued
   // while we worked.  (In fact, it's pretty likely.)
-  if (*card_ptr == G1CardTable::dirty_card_val()) {
-    return;
+  for (size_t i = 0; i < num_cards; i++) {
+    CardValue* cur = card_ptr + i;
+    if (*cur == G1CardTable::dirty_card_val()) {
+      continue;
+    }
+    // Re-dirty the card and enqueue in the *shared* queue.  Can't use
+    // the thread-local queue, because that might be the queue that is
+    // being processed by us; we could be a Java thread conscripted to
+    // perform refinement on our queue's current buffer.
+    *cur = G1CardTable::dirty_card_val();
+    G1BarrierSet::shared_dirty_card_queue().enqueue(cur);
   }
-
-  // Re-dirty the card and enqueue in the *shared* queue.  Can't use
-  // the thread-local queue, because that might be the queue that is
-  // being processed by us; we could be a Java thread conscripted to
-  // perform refinement on our queue's current buffer.
-  *card_ptr = G1CardTable::dirty_card_val();
-  G1BarrierSet::shared_dirty_card_queue().enqueue(card_ptr);
 }
 
 void G1RemSet::print_periodic_summary_info(const char* header, uint period_count) {
@@ -120,11 +120,13 @@ public:
   // card needs later refinement. Note that "*card_ptr_addr" could be updated to
   // a different card due to use of hot card cache.
   bool clean_card_before_refine(CardValue** const card_ptr_addr);
-  // Refine the region corresponding to "card_ptr". Must be called after
-  // being filtered by clean_card_before_refine(), and after proper
+  // Refine the region corresponding to the "num_cards" consecutive cards
+  // starting at "card_ptr". All cards must be in the same heap region. Must be
+  // called after being filtered by clean_card_before_refine(), and after proper
   // fence/synchronization.
-  void refine_card_concurrently(CardValue* const card_ptr,
-                                const uint worker_id);
+  void refine_cards_concurrently(CardValue* const card_ptr,
+                                 size_t num_cards,
+                                 const uint worker_id);
 
   // Print accumulated summary info from the start of the VM.
   void print_summary_info();
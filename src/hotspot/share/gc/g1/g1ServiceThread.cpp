@@ -30,11 +30,14 @@
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1ServiceThread.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionManager.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "utilities/ticks.hpp"
 
 G1ServiceThread::G1ServiceThread() :
     ConcurrentGCThread(),
@@ -100,6 +103,30 @@ void G1ServiceThread::check_for_periodic_gc(){
   }
 }
 
+void G1ServiceThread::uncommit_inactive_regions() {
+  HeapRegionManager* hrm = G1CollectedHeap::heap()->hrm();
+  if (!hrm->has_inactive_regions()) {
+    return;
+  }
+
+  // Limit the work per batch to bound the time a safepoint may have to wait.
+  const size_t UncommitBatchBytes = 128 * M;
+  const uint batch_size = MAX2((uint)(UncommitBatchBytes / HeapRegion::GrainBytes), 1u);
+
+  Ticks start = Ticks::now();
+  uint uncommitted = 0;
+  do {
+    SuspendibleThreadSetJoiner sts;
+    uncommitted += hrm->uncommit_inactive_regions(batch_size);
+  } while (hrm->has_inactive_regions() && !should_terminate());
+
+  log_debug(gc, heap)("Concurrent uncommit: " SIZE_FORMAT "%s (%u regions) in %.3fms",
+                      byte_size_in_proper_unit(uncommitted * HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(uncommitted * HeapRegion::GrainBytes),
+                      uncommitted,
+                      (Ticks::now() - start).seconds() * 1000.0);
+}
+
 void G1ServiceThread::run_service() {
   double vtime_start = os::elapsedVTime();
 
@@ -114,6 +141,8 @@ void G1ServiceThread::run_service() {
 
     check_for_periodic_gc();
 
+    uncommit_inactive_regions();
+
     sleep_before_next_cycle();
   }
 }
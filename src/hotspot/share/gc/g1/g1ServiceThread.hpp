@@ -32,6 +32,7 @@
 //   - re-assess the validity of the prediction for the
 //     remembered set lengths of the young generation.
 //   - check if a periodic GC should be scheduled.
+//   - uncommit the memory of regions removed from the heap by shrinking.
 class G1ServiceThread: public ConcurrentGCThread {
 private:
   Monitor _monitor;
@@ -53,6 +54,11 @@ private:
   // increase the young gen size to keep pause time length goal.
   void sample_young_list_rs_length();
 
+  // Uncommit the memory of regions the heap has been shrunk by in small
+  // batches, leaving the suspendible thread set in between so that safepoints
+  // are not delayed.
+  void uncommit_inactive_regions();
+
   void run_service();
   void check_for_periodic_gc();
 
@@ -77,6 +77,10 @@
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
                                                                             \
+  product(bool, G1ConcurrentMetaspacePurge, false, EXPERIMENTAL,            \
+               "Purge the metadata of the classes unloaded in the Remark "  \
+               "pause concurrently after it.")                              \
+                                                                            \
   product(double, G1LastPLABAverageOccupancy, 50.0, EXPERIMENTAL,           \
                "The expected average occupancy of the last PLAB in "        \
                "percent.")                                                  \
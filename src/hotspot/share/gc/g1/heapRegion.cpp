@@ -137,7 +137,7 @@ void HeapRegion::hr_clear(bool clear_space) {
   init_top_at_mark_start();
   if (clear_space) clear(SpaceDecorator::Mangle);
 
-  _evacuation_failed = false;
+  set_evacuation_failed(false);
   _gc_efficiency = 0.0;
 }
 
@@ -246,6 +246,8 @@ HeapRegion::HeapRegion(uint hrm_index,
   _type(),
   _humongous_start_region(NULL),
   _evacuation_failed(false),
+  _evac_failure_bottom(NULL),
+  _evac_failure_top(NULL),
   _index_in_opt_cset(InvalidCSetIndex),
   _next(NULL), _prev(NULL),
 #ifdef ASSERT
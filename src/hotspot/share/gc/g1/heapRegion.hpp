@@ -209,6 +209,11 @@ private:
 
   // True iff an attempt to evacuate an object in the region failed.
   bool _evacuation_failed;
+  // Start of the lowest and end of the highest object in the region that
+  // failed evacuation, NULL if there are none. Only the objects in this range
+  // need to be walked to remove self-forwarding pointers.
+  HeapWord* volatile _evac_failure_bottom;
+  HeapWord* volatile _evac_failure_top;
 
   static const uint InvalidCSetIndex = UINT_MAX;
 
@@ -506,9 +511,20 @@ public:
 
     if (b) {
       _next_marked_bytes = 0;
+    } else {
+      _evac_failure_bottom = NULL;
+      _evac_failure_top = NULL;
     }
   }
 
+  // Record that the object at [start, end) failed evacuation. May be called
+  // concurrently by multiple threads.
+  inline void note_evacuation_failure(HeapWord* start, HeapWord* end);
+
+  // Bounds of the objects that failed evacuation, see note_evacuation_failure.
+  HeapWord* evac_failure_bottom() const { return _evac_failure_bottom; }
+  HeapWord* evac_failure_top() const { return _evac_failure_top; }
+
   // Notify the region that we are about to start processing
   // self-forwarded objects during evac failure handling.
   void note_self_forwarding_removal_start(bool during_concurrent_start,
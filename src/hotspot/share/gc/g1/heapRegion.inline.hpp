@@ -134,6 +134,26 @@ inline bool HeapRegion::is_obj_dead_with_size(const oop obj, const G1CMBitMap* c
   return obj_is_dead;
 }
 
+inline void HeapRegion::note_evacuation_failure(HeapWord* start, HeapWord* end) {
+  assert(is_in(start) && end <= top(), "object must be in region");
+  HeapWord* cur = Atomic::load(&_evac_failure_bottom);
+  while (cur == NULL || start < cur) {
+    HeapWord* prev = Atomic::cmpxchg(&_evac_failure_bottom, cur, start);
+    if (prev == cur) {
+      break;
+    }
+    cur = prev;
+  }
+  cur = Atomic::load(&_evac_failure_top);
+  while (cur == NULL || end > cur) {
+    HeapWord* prev = Atomic::cmpxchg(&_evac_failure_top, cur, end);
+    if (prev == cur) {
+      break;
+    }
+    cur = prev;
+  }
+}
+
 inline bool HeapRegion::block_is_obj(const HeapWord* p) const {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
@@ -35,6 +35,7 @@
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -70,6 +71,9 @@ HeapRegionManager::HeapRegionManager() :
   _card_counts_mapper(NULL),
   _available_map(mtGC),
   _num_committed(0),
+  _inactive_map(mtGC),
+  _num_inactive(0),
+  _uncommit_lock(Mutex::nonleaf, "G1 Uncommit lock", true, Mutex::_safepoint_check_never),
   _allocated_heapregions_length(0),
   _regions(), _heap_mapper(NULL),
   _prev_bitmap_mapper(NULL),
@@ -105,6 +109,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(heap_storage->reserved(), HeapRegion::GrainBytes);
 
   _available_map.initialize(_regions.length());
+  _inactive_map.initialize(_regions.length());
 }
 
 bool HeapRegionManager::is_available(uint region) const {
@@ -221,6 +226,10 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _num_committed -= (uint)num_regions;
 
   _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  uncommit_memory(start, num_regions);
+}
+
+void HeapRegionManager::uncommit_memory(uint start, size_t num_regions) {
   _heap_mapper->uncommit_regions(start, num_regions);
 
   // Also uncommit auxiliary data
@@ -233,8 +242,77 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _card_counts_mapper->uncommit_regions(start, num_regions);
 }
 
+void HeapRegionManager::deactivate_regions(uint start, uint num_regions) {
+  guarantee(num_regions >= 1, "Need to specify at least one region to deactivate, tried to deactivate zero regions at %u", start);
+  guarantee(_num_committed >= num_regions, "pre-condition");
+
+  // Reset node index to distinguish with committed regions.
+  for (uint i = start; i < start + num_regions; i++) {
+    at(i)->set_node_index(G1NUMA::UnknownNodeIndex);
+  }
+
+  MutexLocker ml(&_uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  _num_committed -= num_regions;
+
+  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  _inactive_map.par_set_range(start, start + num_regions, BitMap::unknown_range);
+  Atomic::store(&_num_inactive, _num_inactive + num_regions);
+}
+
+void HeapRegionManager::uncommit_inactive(uint start, uint num_regions) {
+  assert_lock_strong(&_uncommit_lock);
+
+  // Print before uncommitting.
+  if (G1CollectedHeap::heap()->hr_printer()->is_active()) {
+    for (uint i = start; i < start + num_regions; i++) {
+      HeapRegion* hr = at(i);
+      G1CollectedHeap::heap()->hr_printer()->uncommit(hr);
+    }
+  }
+
+  _inactive_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  Atomic::store(&_num_inactive, _num_inactive - num_regions);
+  uncommit_memory(start, num_regions);
+}
+
+uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
+  assert(limit > 0, "Need to specify at least one region to uncommit");
+
+  MutexLocker ml(&_uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  uint uncommitted = 0;
+  BitMap::idx_t offset = 0;
+  while (uncommitted < limit && _num_inactive > 0) {
+    BitMap::idx_t start = _inactive_map.get_next_one_offset(offset);
+    assert(start < _inactive_map.size(), "Must find inactive region, %u remaining", _num_inactive);
+    BitMap::idx_t end = _inactive_map.get_next_zero_offset(start);
+    uint num_regions = MIN2(limit - uncommitted, (uint)(end - start));
+
+    uncommit_inactive((uint)start, num_regions);
+
+    uncommitted += num_regions;
+    offset = start + num_regions;
+  }
+  return uncommitted;
+}
+
 void HeapRegionManager::make_regions_available(uint start, uint num_regions, WorkGang* pretouch_gang) {
   guarantee(num_regions > 0, "No point in calling this for zero regions");
+
+  MutexLocker ml(&_uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  // Regions that were removed by shrinking but have not been uncommitted yet
+  // need to be uncommitted first, so that commit notifications are sent and the
+  // auxiliary data structures are cleared as for any other newly committed region.
+  if (_num_inactive > 0) {
+    for (uint i = start; i < start + num_regions; i++) {
+      if (_inactive_map.at(i)) {
+        uncommit_inactive(i, 1);
+      }
+    }
+  }
+
   commit_regions(start, num_regions, pretouch_gang);
   for (uint i = start; i < start + num_regions; i++) {
     if (_regions.get_by_index(i) == NULL) {
@@ -567,7 +645,13 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
       (num_last_found = find_empty_from_idx_reverse(cur, &idx_last_found)) > 0) {
     uint to_remove = MIN2(num_regions_to_remove - removed, num_last_found);
 
-    shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
+#ifdef ASSERT
+    for (uint i = idx_last_found + num_last_found - to_remove; i < idx_last_found + num_last_found; i++) {
+      assert(at(i)->is_empty(), "Expected empty region at index %u", i);
+      assert(at(i)->is_free(), "Expected free region at index %u", i);
+    }
+#endif
+    deactivate_regions(idx_last_found + num_last_found - to_remove, to_remove);
 
     cur = idx_last_found;
     removed += to_remove;
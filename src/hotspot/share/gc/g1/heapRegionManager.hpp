@@ -29,6 +29,8 @@
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/heapRegionSet.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutex.hpp"
 #include "services/memoryUsage.hpp"
 
 class HeapRegion;
@@ -98,6 +100,17 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // The number of regions committed in the heap.
   uint _num_committed;
 
+  // Each bit in this bitmap indicates that the corresponding region has been
+  // removed from the heap by shrinking, but its memory is still committed. The
+  // service thread uncommits the memory of these regions concurrently.
+  CHeapBitMap _inactive_map;
+  // The number of regions set in _inactive_map.
+  volatile uint _num_inactive;
+
+  // Serializes uncommitting of inactive regions with committing regions, as
+  // some of the auxiliary data structures share pages between regions.
+  Mutex _uncommit_lock;
+
   // Internal only. The highest heap region +1 we allocated a HeapRegion instance for.
   uint _allocated_heapregions_length;
 
@@ -107,6 +120,16 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Pass down commit calls to the VirtualSpace.
   void commit_regions(uint index, size_t num_regions = 1, WorkGang* pretouch_gang = NULL);
 
+  // Remove the given available regions from the heap without uncommitting their
+  // memory, leaving that to uncommit_inactive_regions().
+  void deactivate_regions(uint start, uint num_regions);
+
+  // Uncommit the memory of the given inactive regions. Requires _uncommit_lock.
+  void uncommit_inactive(uint start, uint num_regions);
+
+  // Uncommit the memory of the given regions in all mappers.
+  void uncommit_memory(uint start, size_t num_regions);
+
   // Notify other data structures about change in the heap layout.
   void update_committed_space(HeapWord* old_end, HeapWord* new_end);
 
@@ -289,10 +312,19 @@ public:
 
   void par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const;
 
-  // Uncommit up to num_regions_to_remove regions that are completely free.
-  // Return the actual number of uncommitted regions.
+  // Remove up to num_regions_to_remove regions that are completely free from the
+  // heap. Return the actual number of removed regions. The memory of the removed
+  // regions is uncommitted later by uncommit_inactive_regions().
   virtual uint shrink_by(uint num_regions_to_remove);
 
+  // Whether there are regions removed by shrinking whose memory still needs to
+  // be uncommitted.
+  bool has_inactive_regions() const { return Atomic::load(&_num_inactive) > 0; }
+
+  // Uncommit the memory of up to limit regions removed by shrink_by(). Returns
+  // the number of regions uncommitted. May be called concurrently with the mutator.
+  uint uncommit_inactive_regions(uint limit);
+
   // Uncommit a number of regions starting at the specified index, which must be available,
   // empty, and free.
   void shrink_at(uint index, size_t num_regions);
@@ -55,13 +55,13 @@ bool SparsePRTEntry::contains_card(CardIdx_t card_index) const {
   return false;
 }
 
-SparsePRT::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
+SparsePRT::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index, int cards_num) {
   for (int i = 0; i < num_valid_cards(); i++) {
     if (card(i) == card_index) {
       return SparsePRT::found;
     }
   }
-  if (num_valid_cards() < cards_num() - 1) {
+  if (num_valid_cards() < cards_num - 1) {
     _cards[_next_null] = (card_elem_t)card_index;
     _next_null++;
     return SparsePRT::added;
@@ -71,13 +71,12 @@ SparsePRT::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
 }
 
 void SparsePRTEntry::copy_cards(card_elem_t* cards) const {
-  memcpy(cards, _cards, cards_num() * sizeof(card_elem_t));
+  memcpy(cards, _cards, num_valid_cards() * sizeof(card_elem_t));
 }
 
 void SparsePRTEntry::copy_cards(SparsePRTEntry* e) const {
   copy_cards(e->_cards);
   assert(_next_null >= 0, "invariant");
-  assert(_next_null <= cards_num(), "invariant");
   e->_next_null = _next_null;
 }
 
@@ -92,6 +91,8 @@ RSHashTable RSHashTable::empty_table;
 
 RSHashTable::RSHashTable() :
   _num_entries(0),
+  _cards_num(0),
+  _entry_size(0),
   _capacity(0),
   _capacity_mask(0),
   _occupied_entries(0),
@@ -100,12 +101,14 @@ RSHashTable::RSHashTable() :
   _free_region(0),
   _free_list(NullEntry) { }
 
-RSHashTable::RSHashTable(size_t capacity) :
+RSHashTable::RSHashTable(size_t capacity, int cards_num) :
   _num_entries((capacity * TableOccupancyFactor) + 1),
+  _cards_num(cards_num),
+  _entry_size(SparsePRTEntry::size(cards_num)),
   _capacity(capacity),
   _capacity_mask(capacity - 1),
   _occupied_entries(0),
-  _entries((SparsePRTEntry*)NEW_C_HEAP_ARRAY(char, _num_entries * SparsePRTEntry::size(), mtGC)),
+  _entries((SparsePRTEntry*)NEW_C_HEAP_ARRAY(char, _num_entries * _entry_size, mtGC)),
   _buckets(NEW_C_HEAP_ARRAY(int, capacity, mtGC)),
   _free_region(0),
   _free_list(NullEntry)
@@ -132,7 +135,7 @@ void RSHashTable::clear() {
                 "_capacity too large");
 
   // This will put -1 == NullEntry in the key field of all entries.
-  memset((void*)_entries, NullEntry, _num_entries * SparsePRTEntry::size());
+  memset((void*)_entries, NullEntry, _num_entries * _entry_size);
   memset((void*)_buckets, NullEntry, _capacity * sizeof(int));
   _free_list = NullEntry;
   _free_region = 0;
@@ -143,7 +146,7 @@ SparsePRT::AddCardResult RSHashTable::add_card(RegionIdx_t region_ind, CardIdx_t
   SparsePRTEntry* e = entry_for_region_ind_create(region_ind);
   assert(e != NULL && e->r_ind() == region_ind,
          "Postcondition of call above.");
-  SparsePRT::AddCardResult res = e->add_card(card_index);
+  SparsePRT::AddCardResult res = e->add_card(card_index, _cards_num);
   assert(e->num_valid_cards() > 0, "Postcondition");
   return res;
 }
@@ -221,6 +224,7 @@ void RSHashTable::free_entry(int fi) {
 
 void RSHashTable::add_entry(SparsePRTEntry* e) {
   assert(e->num_valid_cards() > 0, "Precondition.");
+  assert(e->num_valid_cards() < _cards_num, "Entry does not fit into the table.");
   SparsePRTEntry* e2 = entry_for_region_ind_create(e->r_ind());
   e->copy_cards(e2);
   assert(e2->num_valid_cards() > 0, "Postcondition.");
@@ -246,17 +250,21 @@ bool RSHashTable::contains_card(RegionIdx_t region_index, CardIdx_t card_index)
 
 size_t RSHashTable::mem_size() const {
   return sizeof(RSHashTable) +
-    _num_entries * (SparsePRTEntry::size() + sizeof(int));
+    _num_entries * (_entry_size + sizeof(int));
 }
 
 // ----------------------------------------------------------------------
 
 SparsePRT::SparsePRT() :
+  _small_table(&RSHashTable::empty_table),
   _table(&RSHashTable::empty_table) {
 }
 
 
 SparsePRT::~SparsePRT() {
+  if (_small_table != &RSHashTable::empty_table) {
+    delete _small_table;
+  }
   if (_table != &RSHashTable::empty_table) {
     delete _table;
   }
@@ -264,48 +272,84 @@ SparsePRT::~SparsePRT() {
 
 
 size_t SparsePRT::mem_size() const {
-  // We ignore "_cur" here, because it either = _next, or else it is
-  // on the deleted list.
-  return sizeof(SparsePRT) + _table->mem_size();
+  return sizeof(SparsePRT) + _small_table->mem_size() + _table->mem_size();
+}
+
+bool SparsePRT::use_small_table() {
+  return SparsePRTEntry::small_cards_num() < SparsePRTEntry::cards_num();
 }
 
 SparsePRT::AddCardResult SparsePRT::add_card(RegionIdx_t region_id, CardIdx_t card_index) {
-  if (_table->should_expand()) {
-    expand();
+  // Entries that already overflowed the small table are kept in the regular one.
+  if (!use_small_table() || _table->get_entry(region_id) != NULL) {
+    if (_table->should_expand()) {
+      expand(_table, SparsePRTEntry::cards_num());
+    }
+    return _table->add_card(region_id, card_index);
+  }
+
+  if (_small_table->should_expand()) {
+    expand(_small_table, SparsePRTEntry::small_cards_num());
+  }
+  AddCardResult res = _small_table->add_card(region_id, card_index);
+  if (res != overflow) {
+    return res;
   }
+  promote(region_id);
   return _table->add_card(region_id, card_index);
 }
 
+void SparsePRT::promote(RegionIdx_t region_id) {
+  if (_table->should_expand()) {
+    expand(_table, SparsePRTEntry::cards_num());
+  }
+  SparsePRTEntry* e = _small_table->get_entry(region_id);
+  assert(e != NULL, "must have an entry to promote");
+  _table->add_entry(e);
+  bool deleted = _small_table->delete_entry(region_id);
+  assert(deleted, "must have deleted the promoted entry");
+}
+
 SparsePRTEntry* SparsePRT::get_entry(RegionIdx_t region_id) {
-  return _table->get_entry(region_id);
+  SparsePRTEntry* e = _table->get_entry(region_id);
+  if (e == NULL) {
+    e = _small_table->get_entry(region_id);
+  }
+  return e;
 }
 
 bool SparsePRT::delete_entry(RegionIdx_t region_id) {
-  return _table->delete_entry(region_id);
+  return _table->delete_entry(region_id) || _small_table->delete_entry(region_id);
 }
 
 void SparsePRT::clear() {
+  clear(_small_table);
+  clear(_table);
+}
+
+void SparsePRT::clear(RSHashTable*& table) {
   // If the entry table not at initial capacity, just reset to the empty table.
-  if (_table->capacity() == InitialCapacity) {
-    _table->clear();
-  } else if (_table != &RSHashTable::empty_table) {
-    delete _table;
-    _table = &RSHashTable::empty_table;
+  if (table->capacity() == InitialCapacity) {
+    table->clear();
+  } else if (table != &RSHashTable::empty_table) {
+    delete table;
+    table = &RSHashTable::empty_table;
   }
 }
 
-void SparsePRT::expand() {
-  RSHashTable* last = _table;
+void SparsePRT::expand(RSHashTable*& table, int cards_num) {
+  RSHashTable* last = table;
   if (last != &RSHashTable::empty_table) {
-    _table = new RSHashTable(last->capacity() * 2);
+    assert(last->cards_num() == cards_num, "must not change entry size");
+    table = new RSHashTable(last->capacity() * 2, cards_num);
     for (size_t i = 0; i < last->num_entries(); i++) {
       SparsePRTEntry* e = last->entry((int)i);
       if (e->valid_entry()) {
-        _table->add_entry(e);
+        table->add_entry(e);
       }
     }
     delete last;
   } else {
-    _table = new RSHashTable(InitialCapacity);
+    table = new RSHashTable(InitialCapacity, cards_num);
   }
 }
@@ -39,15 +39,31 @@ class SparsePRTEntry;
 // Sparse remembered set for a heap region (the "owning" region).  Maps
 // indices of other regions to short sequences of cards in the other region
 // that might contain pointers into the owner region.
+// Most regions only refer to an owner region through a handful of cards, so
+// entries are first kept in a table with small entries (_small_table). Only
+// entries that overflow there are moved to the table with entries sized
+// G1RSetSparseRegionEntries (_table).
 // Concurrent access to a SparsePRT must be serialized by some external mutex.
 class SparsePRT {
   friend class SparsePRTBucketIter;
 
+  RSHashTable* _small_table;
   RSHashTable* _table;
 
   static const size_t InitialCapacity = 8;
 
-  void expand();
+  // Expand "table" to twice its capacity, allocating the initial table with
+  // entries of "cards_num" cards if it is still the empty table.
+  static void expand(RSHashTable*& table, int cards_num);
+
+  static void clear(RSHashTable*& table);
+
+  // Whether the small entry table is used at all. It is not if the small
+  // entries would not be smaller than the regular ones.
+  static bool use_small_table();
+
+  // Move the overflown entry for "region_id" from the small to the regular table.
+  void promote(RegionIdx_t region_id);
 
 public:
   SparsePRT();
@@ -102,15 +118,25 @@ private:
   // It should always be the last data member.
   card_elem_t _cards[card_array_alignment];
 
+  // Number of cards of the entries in the small entry table.
+  static const int SmallCardsNum = 8;
+
   // Copy the current entry's cards into "cards".
   inline void copy_cards(card_elem_t* cards) const;
 public:
-  // Returns the size of the entry, used for entry allocation.
-  static size_t size() { return sizeof(SparsePRTEntry) + sizeof(card_elem_t) * (cards_num() - card_array_alignment); }
-  // Returns the size of the card array.
+  // Returns the size of an entry with a card array of "cards_num" elements,
+  // used for entry allocation.
+  static size_t size(int cards_num) {
+    return sizeof(SparsePRTEntry) + sizeof(card_elem_t) * (cards_num - card_array_alignment);
+  }
+  // Returns the size of the card array of regular entries.
   static int cards_num() {
     return align_up((int)G1RSetSparseRegionEntries, (int)card_array_alignment);
   }
+  // Returns the size of the card array of small entries.
+  static int small_cards_num() {
+    return align_up(SmallCardsNum, (int)card_array_alignment);
+  }
 
   // Set the region_ind to the given value, and delete all cards.
   inline void init(RegionIdx_t region_ind);
@@ -128,16 +154,18 @@ public:
   // Returns the number of non-NULL card entries.
   inline int num_valid_cards() const { return _next_null; }
 
-  inline SparsePRT::AddCardResult add_card(CardIdx_t card_index);
+  // Adds the card to an entry with a card array of "cards_num" elements.
+  inline SparsePRT::AddCardResult add_card(CardIdx_t card_index, int cards_num);
 
-  // Copy the current entry's cards into the "_card" array of "e."
+  // Copy the current entry's cards into the "_card" array of "e." The
+  // card array of "e" must be able to hold all valid cards of this entry.
   inline void copy_cards(SparsePRTEntry* e) const;
 
   card_elem_t* cards() { return _cards; }
 
   inline CardIdx_t card(int i) const {
     assert(i >= 0, "must be nonnegative");
-    assert(i < cards_num(), "range checking");
+    assert(i < num_valid_cards(), "range checking");
     return (CardIdx_t)_cards[i];
   }
 };
@@ -150,6 +178,10 @@ class RSHashTable : public CHeapObj<mtGC> {
   static float TableOccupancyFactor;
 
   size_t _num_entries;
+  // The number of elements of the card array of the entries, and the
+  // resulting size of a single entry.
+  int    _cards_num;
+  size_t _entry_size;
 
   size_t _capacity;
   size_t _capacity_mask;
@@ -177,7 +209,7 @@ class RSHashTable : public CHeapObj<mtGC> {
   RSHashTable();
 
 public:
-  RSHashTable(size_t capacity);
+  RSHashTable(size_t capacity, int cards_num);
   ~RSHashTable();
 
   static const int NullEntry = -1;
@@ -203,6 +235,7 @@ public:
 
   void clear();
 
+  int cards_num() const        { return _cards_num; }
   size_t capacity() const      { return _capacity; }
   size_t capacity_mask() const { return _capacity_mask;  }
   size_t mem_size() const;
@@ -211,7 +244,7 @@ public:
 
   SparsePRTEntry* entry(int i) const {
     assert(i >= 0 && (size_t)i < _num_entries, "precondition");
-    return (SparsePRTEntry*)((char*)_entries + SparsePRTEntry::size() * i);
+    return (SparsePRTEntry*)((char*)_entries + _entry_size * i);
   }
 
   void print();
@@ -233,13 +266,18 @@ public:
   bool has_next(SparsePRTEntry*& entry);
 };
 
-class SparsePRTBucketIter: public RSHashTableBucketIter {
+// Iterates over the entries of the regular and then the small entry table.
+class SparsePRTBucketIter {
+  RSHashTableBucketIter _iter;
+  RSHashTableBucketIter _small_iter;
+
 public:
   SparsePRTBucketIter(const SparsePRT* sprt) :
-    RSHashTableBucketIter(sprt->_table) {}
+    _iter(sprt->_table),
+    _small_iter(sprt->_small_table) {}
 
   bool has_next(SparsePRTEntry*& entry) {
-    return RSHashTableBucketIter::has_next(entry);
+    return _iter.has_next(entry) || _small_iter.has_next(entry);
   }
 };
 
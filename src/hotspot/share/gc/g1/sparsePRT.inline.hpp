@@ -29,7 +29,8 @@
 #include "gc/g1/sparsePRT.hpp"
 
 inline bool SparsePRT::contains_card(RegionIdx_t region_id, CardIdx_t card_index) const {
-  return _table->contains_card(region_id, card_index);
+  return _table->contains_card(region_id, card_index) ||
+         _small_table->contains_card(region_id, card_index);
 }
 
 
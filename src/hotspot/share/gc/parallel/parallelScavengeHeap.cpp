@@ -50,6 +50,7 @@
 #include "runtime/vmThread.hpp"
 #include "services/memoryManager.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/align.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/vmError.hpp"
 
@@ -217,6 +218,15 @@ size_t ParallelScavengeHeap::max_capacity() const {
   return MAX2(estimated, capacity());
 }
 
+size_t ParallelScavengeHeap::soft_max_gen_size(size_t max_gen_size, size_t live_bytes) {
+  if (SoftMaxHeapSize >= MaxHeapSize) {
+    return max_gen_size;
+  }
+  double ratio = (double)SoftMaxHeapSize / (double)MaxHeapSize;
+  size_t soft_max = align_down((size_t)(max_gen_size * ratio), GenAlignment);
+  return MIN2(MAX2(soft_max, live_bytes), max_gen_size);
+}
+
 bool ParallelScavengeHeap::is_in(const void* p) const {
   return young_gen()->is_in(p) || old_gen()->is_in(p);
 }
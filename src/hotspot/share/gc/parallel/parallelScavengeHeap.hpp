@@ -156,6 +156,11 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   size_t max_capacity() const;
 
+  // Scale the maximum size of a generation by SoftMaxHeapSize / MaxHeapSize
+  // so that adaptive sizing steers toward the soft maximum heap size. The
+  // result is never less than live_bytes.
+  static size_t soft_max_gen_size(size_t max_gen_size, size_t live_bytes);
+
   // Whether p is in the allocated part of the heap
   bool is_in(const void* p) const;
 
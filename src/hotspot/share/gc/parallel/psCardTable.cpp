@@ -32,6 +32,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 
@@ -126,44 +127,29 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // when the space is empty, fix the calculation of
 // end_card to allow sp_top == sp->bottom().
 
-// The generation (old gen) is divided into slices, which are further
-// subdivided into stripes, with one stripe per GC thread. The size of
-// a stripe is a constant, ssize.
+// The generation (old gen) is divided into stripes of a constant size, ssize.
 //
-//      +===============+        slice 0
-//      |  stripe 0     |
-//      +---------------+
-//      |  stripe 1     |
-//      +---------------+
-//      |  stripe 2     |
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 1
 //      |  stripe 0     |
 //      +---------------+
 //      |  stripe 1     |
 //      +---------------+
 //      |  stripe 2     |
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes.  The next
-// stripe is at ssize * number_of_stripes (= slice_stride)..  So after
-// finishing stripe 0 in slice 0, the thread finds the stripe 0 in slice1 by
-// adding slice_stride to the start of stripe 0 in slice 0 to get to the start
-// of stride 0 in slice 1.
+// GC threads claim the stripes one at a time from a shared counter, in
+// increasing address order, until all stripes up to the top of the generation
+// have been claimed. A thread that happens to claim stripes with many dirty
+// cards simply claims fewer stripes, so threads scanning sparsely dirtied
+// parts of the generation pick up the remaining work instead of idling.
 
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
-                                             uint stripe_number,
-                                             uint stripe_total) {
+                                             uint worker_id,
+                                             volatile size_t* claimed_stripe) {
   int ssize = 128; // Naked constant!  Work unit = 64k.
   int dirty_card_count = 0;
 
@@ -173,23 +159,22 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
   CardValue* start_card = byte_for(sp->bottom());
   CardValue* end_card   = byte_for(sp_top - 1) + 1;
   oop* last_scanned = NULL; // Prevent scanning objects more than once
-  // The width of the stripe ssize*stripe_total must be
-  // consistent with the number of stripes so that the complete slice
-  // is covered.
-  size_t slice_width = ssize * stripe_total;
-  for (CardValue* slice = start_card; slice < end_card; slice += slice_width) {
-    CardValue* worker_start_card = slice + stripe_number * ssize;
-    if (worker_start_card >= end_card)
-      return; // We're done.
+  // Stripes are claimed in increasing address order, so the stripes a worker
+  // processes are always ascending, as "last_scanned" requires.
+  size_t num_stripes = ((size_t)(end_card - start_card) + ssize - 1) / ssize;
+  for (size_t stripe = Atomic::fetch_and_add(claimed_stripe, (size_t)1);
+       stripe < num_stripes;
+       stripe = Atomic::fetch_and_add(claimed_stripe, (size_t)1)) {
+    CardValue* worker_start_card = start_card + stripe * ssize;
 
     CardValue* worker_end_card = worker_start_card + ssize;
     if (worker_end_card > end_card)
       worker_end_card = end_card;
 
     // We do not want to scan objects more than once. In order to accomplish
-    // this, we assert that any object with an object head inside our 'slice'
+    // this, we assert that any object with an object head inside our stripe
     // belongs to us. We may need to extend the range of scanned cards if the
-    // last object continues into the next 'slice'.
+    // last object continues into the next stripe.
     //
     // Note! ending cards are exclusive!
     HeapWord* slice_start = addr_for(worker_start_card);
@@ -199,7 +184,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (GCWorkerDelayMillis > 0) {
       // Delay 1 worker so that it proceeds after all the work
       // has been completed.
-      if (stripe_number < 2) {
+      if (worker_id < 2) {
         os::naked_sleep(GCWorkerDelayMillis);
       }
     }
@@ -57,12 +57,15 @@ class PSCardTable: public CardTable {
   static CardValue verify_card_val()     { return verify_card; }
 
   // Scavenge support
+  // The cards covering the space are divided into stripes, which the workers
+  // claim dynamically through the shared counter "claimed_stripe" so that
+  // unevenly distributed dirty cards do not leave workers idle.
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   MutableSpace* sp,
                                   HeapWord* space_top,
                                   PSPromotionManager* pm,
-                                  uint stripe_number,
-                                  uint stripe_total);
+                                  uint worker_id,
+                                  volatile size_t* claimed_stripe);
 
   bool addr_is_marked_imprecise(void *addr);
   bool addr_is_marked_precise(void *addr);
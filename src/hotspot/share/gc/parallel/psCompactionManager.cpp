@@ -119,9 +119,13 @@ ParCompactionManager::gc_thread_compaction_manager(uint index) {
 void ParCompactionManager::follow_marking_stacks() {
   do {
     // Drain the overflow stack first, to allow stealing from the marking stack.
+    // Entries that fit are moved back to the marking stack so other workers
+    // can steal them too.
     oop obj;
     while (marking_stack()->pop_overflow(obj)) {
-      follow_contents(obj);
+      if (!marking_stack()->try_push_to_taskqueue(obj)) {
+        follow_contents(obj);
+      }
     }
     while (marking_stack()->pop_local(obj)) {
       follow_contents(obj);
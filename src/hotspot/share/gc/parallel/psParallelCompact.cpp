@@ -1883,12 +1883,16 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
         // Used for diagnostics
         size_policy->clear_generation_free_space_flags();
 
+        // Steer toward SoftMaxHeapSize, but keep the real limits for the
+        // overhead check below.
+        size_t old_live_avg = (size_t)size_policy->avg_old_live()->average();
         size_policy->compute_generations_free_space(young_live,
                                                     eden_live,
                                                     old_live,
                                                     cur_eden,
-                                                    max_old_gen_size,
-                                                    max_eden_size,
+                                                    ParallelScavengeHeap::soft_max_gen_size(max_old_gen_size,
+                                                                                            MAX2(old_live, old_live_avg)),
+                                                    ParallelScavengeHeap::soft_max_gen_size(max_eden_size, eden_live),
                                                     true /* full gc*/);
 
         size_policy->check_gc_overhead_limit(eden_live,
@@ -2403,33 +2407,27 @@ void PSParallelCompact::enqueue_dense_prefix_tasks(TaskQueue& task_queue,
         tasks_for_dense_prefix = parallel_gc_threads *
           PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING;
       }
-      size_t regions_per_thread = total_dense_prefix_regions /
+      // Give each task at least 1 region.
+      tasks_for_dense_prefix =
+        (uint)MIN2((size_t)tasks_for_dense_prefix, total_dense_prefix_regions);
+      size_t regions_per_task = total_dense_prefix_regions /
         tasks_for_dense_prefix;
-      // Give each thread at least 1 region.
-      if (regions_per_thread == 0) {
-        regions_per_thread = 1;
-      }
+      // Spread the regions that did not divide evenly over the first
+      // tasks, one each, rather than leaving them all to a single task.
+      size_t remainder = total_dense_prefix_regions % tasks_for_dense_prefix;
 
       for (uint k = 0; k < tasks_for_dense_prefix; k++) {
-        if (region_index_start >= region_index_end_dense_prefix) {
-          break;
-        }
         // region_index_end is not processed
-        size_t region_index_end = MIN2(region_index_start + regions_per_thread,
-                                       region_index_end_dense_prefix);
+        size_t region_index_end = region_index_start + regions_per_task +
+                                  (k < remainder ? 1 : 0);
         task_queue.push(UpdateDensePrefixTask(SpaceId(space_id),
                                               region_index_start,
                                               region_index_end));
         region_index_start = region_index_end;
       }
     }
-    // This gets any part of the dense prefix that did not
-    // fit evenly.
-    if (region_index_start < region_index_end_dense_prefix) {
-      task_queue.push(UpdateDensePrefixTask(SpaceId(space_id),
-                                            region_index_start,
-                                            region_index_end_dense_prefix));
-    }
+    assert(region_index_start == region_index_end_dense_prefix,
+           "all of the dense prefix should have been covered");
   }
 }
 
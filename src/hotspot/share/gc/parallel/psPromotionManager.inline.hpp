@@ -53,7 +53,10 @@ inline void PSPromotionManager::claim_or_forward_depth(T* p) {
   assert(should_scavenge(p, true), "revisiting object?");
   assert(ParallelScavengeHeap::heap()->is_in(p), "pointer outside heap");
   oop obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+  // Prefetch the header for write, we may install a forwarding pointer,
+  // and the klass word for read, it is needed to size the copy.
   Prefetch::write(obj->mark_addr(), 0);
+  Prefetch::read(obj->mark_addr(), (HeapWordSize*2));
   push_depth(ScannerTask(p));
 }
 
@@ -295,6 +295,7 @@ class ScavengeRootsTask : public AbstractGangTask {
   uint _active_workers;
   bool _is_empty;
   TaskTerminator _terminator;
+  volatile size_t _claimed_stripe;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
@@ -308,7 +309,8 @@ public:
       _gen_top(gen_top),
       _active_workers(active_workers),
       _is_empty(is_empty),
-      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+      _claimed_stripe(0) {
     _subtasks.set_n_threads(active_workers);
     _subtasks.set_n_tasks(ParallelRootType::sentinel);
   }
@@ -335,7 +337,7 @@ public:
                                                _gen_top,
                                                pm,
                                                worker_id,
-                                               _active_workers);
+                                               &_claimed_stripe);
 
         // Do the real work
         pm->drain_stacks(false);
@@ -632,7 +634,7 @@ bool PSScavenge::invoke_no_policy() {
           size_policy->compute_eden_space_size(young_live,
                                                eden_live,
                                                cur_eden,
-                                               max_eden_size,
+                                               ParallelScavengeHeap::soft_max_gen_size(max_eden_size, eden_live),
                                                false /* not full gc*/);
 
           size_policy->check_gc_overhead_limit(eden_live,
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/allocTracer.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "runtime/handles.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -61,3 +62,14 @@ void AllocTracer::send_allocation_requiring_gc_event(size_t size, uint gcId) {
     event.commit();
   }
 }
+
+void AllocTracer::send_tlab_resize_event(Thread* thread, size_t previous_size, size_t desired_size, unsigned refills) {
+  EventThreadLocalAllocationBufferResize event;
+  if (event.should_commit()) {
+    event.set_tlabThread(JFR_THREAD_ID(thread));
+    event.set_previousSize(previous_size);
+    event.set_desiredSize(desired_size);
+    event.set_refills(refills);
+    event.commit();
+  }
+}
@@ -33,6 +33,7 @@ class AllocTracer : AllStatic {
     static void send_allocation_outside_tlab(Klass* klass, HeapWord* obj, size_t alloc_size, Thread* thread);
     static void send_allocation_in_new_tlab(Klass* klass, HeapWord* obj, size_t tlab_size, size_t alloc_size, Thread* thread);
     static void send_allocation_requiring_gc_event(size_t size, uint gcId);
+    static void send_tlab_resize_event(Thread* thread, size_t previous_size, size_t desired_size, unsigned refills);
 };
 
 #endif // SHARE_GC_SHARED_ALLOCTRACER_HPP
@@ -322,6 +322,13 @@
           "MaxRAM * MaxRAMPercentage / 100")                                \
           range(0, max_uintx)                                               \
                                                                             \
+  product(size_t, ErgoNativeMemoryReserve, 0,                               \
+          "Amount of physical memory (in bytes) held back for native "      \
+          "memory such as code cache, metaspace, thread stacks and direct " \
+          "buffers before applying MaxRAMPercentage, MinRAMPercentage and " \
+          "InitialRAMPercentage; zero means no reserve")                    \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(uintx, MaxRAMFraction, 4,                                         \
           "Maximum fraction (1/n) of real memory used for maximum heap "    \
           "size. "                                                          \
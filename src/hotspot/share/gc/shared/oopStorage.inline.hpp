@@ -29,6 +29,7 @@
 #include "metaprogramming/conditional.hpp"
 #include "metaprogramming/isConst.hpp"
 #include "oops/oop.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/align.hpp"
 #include "utilities/count_trailing_zeros.hpp"
@@ -168,6 +169,9 @@ public:
   bool is_empty() const;
   uintx allocated_bitmask() const;
 
+  // Hint that the block is about to be iterated over.
+  void prefetch() const;
+
   bool is_safe_to_delete() const;
 
   Block* deferred_updates_next() const;
@@ -315,6 +319,12 @@ inline uintx OopStorage::Block::allocated_bitmask() const {
   return _allocated_bitmask;
 }
 
+inline void OopStorage::Block::prefetch() const {
+  // Iteration reads the bitmask first, then the allocated entries.
+  Prefetch::read((void*)&_allocated_bitmask, 0);
+  Prefetch::read((void*)_data, 0);
+}
+
 inline uintx OopStorage::Block::bitmask_for_index(unsigned index) const {
   check_index(index);
   return uintx(1) << index;
@@ -59,6 +59,11 @@ inline void OopStorage::BasicParState::iterate(F f) {
     size_t i = data._segment_start;
     do {
       BlockPtr block = _active_array->at(i);
+      // Blocks are allocated separately and scattered in memory, so start
+      // fetching the next one while this one is processed.
+      if (i + 1 < data._segment_end) {
+        _active_array->at(i + 1)->prefetch();
+      }
       block->iterate(atf_f);
     } while (++i < data._segment_end);
   }
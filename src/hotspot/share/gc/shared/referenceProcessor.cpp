@@ -1303,6 +1303,11 @@ bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_lis
                                                      OopClosure*        keep_alive,
                                                      VoidClosure*       complete_gc,
                                                      YieldClosure*      yield) {
+  // Most of the _max_num_queues lists per type are usually empty; there is
+  // nothing to remove or trace, so don't pay for a mark stack drain.
+  if (refs_list.is_empty()) {
+    return false;
+  }
   DiscoveredListIterator iter(refs_list, keep_alive, is_alive);
   while (iter.has_next()) {
     if (yield->should_return_fine_grain()) {
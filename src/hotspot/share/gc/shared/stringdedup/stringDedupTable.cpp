@@ -272,6 +272,23 @@ void StringDedupTable::transfer(StringDedupEntry** pentry, StringDedupTable* des
   *list = entry;
 }
 
+void StringDedupTable::transfer_atomic(StringDedupEntry** pentry, StringDedupTable* dest) {
+  StringDedupEntry* entry = *pentry;
+  *pentry = entry->next();
+  unsigned int hash = entry->hash();
+  size_t index = dest->hash_to_index(hash);
+  StringDedupEntry** list = dest->bucket(index);
+  StringDedupEntry* head = Atomic::load(list);
+  for (;;) {
+    entry->set_next(head);
+    StringDedupEntry* prev = Atomic::cmpxchg(list, head, entry);
+    if (prev == head) {
+      return;
+    }
+    head = prev;
+  }
+}
+
 typeArrayOop StringDedupTable::lookup(typeArrayOop value, bool latin1, unsigned int hash,
                                       StringDedupEntry** list, uintx &count) {
   for (StringDedupEntry* entry = *list; entry != NULL; entry = entry->next()) {
@@ -504,19 +521,19 @@ uintx StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
           _table->transfer(entry, _resized_table);
         } else {
           if (is_rehashing()) {
-            // We are rehashing the table, rehash the entry but keep it
-            // in the table. We can't transfer entries into the new table
-            // at this point since we don't have exclusive access to all
-            // destination partitions. finish_rehash() will do a single
-            // threaded transfer of all entries.
+            // We are rehashing the table, rehash the entry and transfer it
+            // to the new table. We don't have exclusive access to the
+            // destination buckets, since they are spread over all partitions,
+            // so the transfer has to be atomic.
             typeArrayOop value = (typeArrayOop)*p;
             bool latin1 = (*entry)->latin1();
             unsigned int hash = hash_code(value, latin1);
             (*entry)->set_hash(hash);
+            _table->transfer_atomic(entry, _rehashed_table);
+          } else {
+            // Move to next entry
+            entry = (*entry)->next_addr();
           }
-
-          // Move to next entry
-          entry = (*entry)->next_addr();
         }
       } else {
         // Not alive, remove entry from table
@@ -575,11 +592,18 @@ StringDedupTable* StringDedupTable::prepare_rehash() {
 void StringDedupTable::finish_rehash(StringDedupTable* rehashed_table) {
   assert(rehashed_table != NULL, "Invalid table");
 
-  // Move all newly rehashed entries into the correct buckets in the new table
-  for (size_t bucket = 0; bucket < _table->_size; bucket++) {
-    StringDedupEntry** entry = _table->bucket(bucket);
-    while (*entry != NULL) {
-      _table->transfer(entry, rehashed_table);
+  // The entries have normally been rehashed and transferred in parallel by
+  // unlink_or_oops_do(). Only if the table was not scanned they still need
+  // to be rehashed and moved into the correct buckets in the new table.
+  if (_claimed_index == 0) {
+    for (size_t bucket = 0; bucket < _table->_size; bucket++) {
+      StringDedupEntry** entry = _table->bucket(bucket);
+      while (*entry != NULL) {
+        oop* p = (oop*)(*entry)->obj_addr();
+        typeArrayOop value = (typeArrayOop)*p;
+        (*entry)->set_hash(hash_code(value, (*entry)->latin1()));
+        _table->transfer(entry, rehashed_table);
+      }
     }
   }
 
@@ -175,6 +175,10 @@ private:
   // Transfers a table entry from the current table to the destination table.
   void transfer(StringDedupEntry** pentry, StringDedupTable* dest);
 
+  // Same as transfer(), but safe to use when multiple threads concurrently
+  // transfer entries to the same destination bucket.
+  void transfer_atomic(StringDedupEntry** pentry, StringDedupTable* dest);
+
   // Returns an existing character array in the given hash bucket, or NULL
   // if no matching character array exists.
   typeArrayOop lookup(typeArrayOop value, bool latin1, unsigned int hash,
@@ -225,9 +229,10 @@ private:
   // hashtable and updates the hash seed.
   static StringDedupTable* prepare_rehash();
 
-  // Transfers rehashed entries from the currently active table into
-  // the new table. Installs the new table as the currently active table
-  // and deletes the previously active table.
+  // Installs the new table, to which unlink_or_oops_do() transferred the
+  // rehashed entries, as the currently active table and deletes the
+  // previously active table. If the table was not scanned, transfers the
+  // entries first.
   static void finish_rehash(StringDedupTable* rehashed_table);
 
 public:
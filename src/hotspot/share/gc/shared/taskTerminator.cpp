@@ -109,7 +109,9 @@ bool TaskTerminator::exit_termination(size_t tasks, TerminatorTerminator* termin
 }
 
 size_t TaskTerminator::tasks_in_queue_set() const {
-  return _queue_set->tasks();
+  // Callers only care whether there is any work and, if so, how many of the
+  // other threads to wake up, so stop counting after _n_threads tasks.
+  return _queue_set->tasks(_n_threads);
 }
 
 void TaskTerminator::prepare_for_return(Thread* this_thread, size_t tasks) {
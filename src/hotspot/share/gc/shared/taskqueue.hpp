@@ -443,8 +443,8 @@ public:
   NOT_DEBUG(void assert_empty() const {})
   DEBUG_ONLY(virtual void assert_empty() const = 0;)
 
-  // Tasks in queue
-  virtual uint tasks() const = 0;
+  // Tasks in queue, counting at most limit tasks.
+  virtual uint tasks(uint limit) const = 0;
 };
 
 template <MEMFLAGS F> class TaskQueueSetSuperImpl: public CHeapObj<F>, public TaskQueueSetSuper {
@@ -475,7 +475,7 @@ public:
 
   DEBUG_ONLY(virtual void assert_empty() const;)
 
-  virtual uint tasks() const;
+  virtual uint tasks(uint limit) const;
 
   uint size() const { return _n; }
 };
@@ -501,9 +501,9 @@ void GenericTaskQueueSet<T, F>::assert_empty() const {
 #endif // ASSERT
 
 template<class T, MEMFLAGS F>
-uint GenericTaskQueueSet<T, F>::tasks() const {
+uint GenericTaskQueueSet<T, F>::tasks(uint limit) const {
   uint n = 0;
-  for (uint j = 0; j < _n; j++) {
+  for (uint j = 0; j < _n && n < limit; j++) {
     n += _queues[j]->size();
   }
   return n;
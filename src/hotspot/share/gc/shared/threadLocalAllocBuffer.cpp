@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/allocTracer.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "logging/log.hpp"
@@ -142,10 +143,38 @@ void ThreadLocalAllocBuffer::resize() {
                       p2i(thread()), thread()->osthread()->thread_id(),
                       _target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
 
-  set_desired_size(aligned_new_size);
+  update_desired_size(aligned_new_size);
+}
+
+void ThreadLocalAllocBuffer::update_desired_size(size_t new_size) {
+  if (new_size != desired_size()) {
+    AllocTracer::send_tlab_resize_event(thread(),
+                                        desired_size() * HeapWordSize,
+                                        new_size * HeapWordSize,
+                                        _number_of_refills);
+  }
+  set_desired_size(new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+void ThreadLocalAllocBuffer::grow_if_refilling_too_often() {
+  if (!ResizeTLAB || desired_size() >= max_size()) {
+    return;
+  }
+  // Double the size each time another target_refills() refills have been used.
+  if (_number_of_refills <= _target_refills || (_number_of_refills % _target_refills) != 0) {
+    return;
+  }
+  size_t new_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+
+  log_trace(gc, tlab)("TLAB grow: thread: " INTPTR_FORMAT " [id: %2d]"
+                      " refills %d  desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      _number_of_refills, desired_size(), new_size);
+
+  update_desired_size(new_size);
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _fast_refill_waste = 0;
@@ -167,6 +196,8 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
+
+  grow_if_refilling_too_often();
 }
 
 void ThreadLocalAllocBuffer::initialize(HeapWord* start,
@@ -85,6 +85,14 @@ private:
   static int    target_refills()                 { return _target_refills; }
   size_t initial_desired_size();
 
+  // Change the desired size, reporting the change.
+  void update_desired_size(size_t new_size);
+
+  // A thread that already used up its target number of refills allocates much
+  // faster than its allocation history predicted. Grow its TLAB right away
+  // instead of waiting for the next GC to resize it.
+  void grow_if_refilling_too_often();
+
   size_t remaining();
 
   // Make parsable and release it.
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/timeHistogramCounters.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+
+TimeHistogramCounters::TimeHistogramCounters(const char* name_space, const char* name) :
+  _count(NULL),
+  _sum(NULL) {
+
+  for (uint i = 0; i < NumBuckets; i++) {
+    _buckets[i] = NULL;
+  }
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+
+    const char* hns = PerfDataManager::name_space(name_space, name);
+
+    stringStream limits;
+    for (uint i = 0; i < NumBuckets - 1; i++) {
+      limits.print("%s" JLONG_FORMAT, i == 0 ? "" : ",", FirstBucketLimitMicros << i);
+    }
+    char* cname = PerfDataManager::counter_name(hns, "bucketLimits");
+    PerfDataManager::create_string_constant(SUN_GC, cname, limits.as_string(), CHECK);
+
+    for (uint i = 0; i < NumBuckets; i++) {
+      cname = PerfDataManager::name_space(hns, "bucket", (int)i);
+      _buckets[i] = PerfDataManager::create_counter(SUN_GC, cname, PerfData::U_Events, CHECK);
+    }
+
+    cname = PerfDataManager::counter_name(hns, "count");
+    _count = PerfDataManager::create_counter(SUN_GC, cname, PerfData::U_Events, CHECK);
+
+    cname = PerfDataManager::counter_name(hns, "sum");
+    _sum = PerfDataManager::create_counter(SUN_GC, cname, PerfData::U_Ticks, CHECK);
+  }
+}
+
+uint TimeHistogramCounters::bucket_index(jlong micros) {
+  uint index = 0;
+  jlong limit = FirstBucketLimitMicros;
+  while (micros >= limit && index < NumBuckets - 1) {
+    limit <<= 1;
+    index++;
+  }
+  return index;
+}
+
+void TimeHistogramCounters::record(double duration_ms) {
+  if (UsePerfData) {
+    const jlong micros = (jlong)(duration_ms * MICROUNITS / MILLIUNITS);
+    _buckets[bucket_index(micros)]->inc();
+    _count->inc();
+    _sum->inc((jlong)(duration_ms * os::elapsed_frequency() / MILLIUNITS));
+  }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_TIMEHISTOGRAMCOUNTERS_HPP
+#define SHARE_GC_SHARED_TIMEHISTOGRAMCOUNTERS_HPP
+
+#include "runtime/perfData.hpp"
+
+// TimeHistogramCounters is a holder class for performance counters that
+// keep a histogram of durations, e.g. of pause or pause phase times.
+//
+// Buckets are exponential: bucket i counts the durations below
+// (FirstBucketLimitMicros << i) microseconds that do not fit into a lower
+// bucket, the last bucket counts everything longer. The counters are
+// cumulative since VM start; percentiles over a window are derived by the
+// consumer from the difference of two samples, like for any other counter.
+//
+// Counters, below <name_space>.<name>:
+//   bucketLimits - the upper limits of the buckets in microseconds
+//   bucket.<i>   - the number of durations in bucket i
+//   count        - the total number of durations
+//   sum          - the sum of all durations in ticks, like the other
+//                  collector time counters
+
+class TimeHistogramCounters: public CHeapObj<mtGC> {
+  friend class TimeHistogramCountersTest;
+
+ public:
+  static const uint NumBuckets = 20;
+  static const jlong FirstBucketLimitMicros = 128;
+
+ private:
+  PerfCounter* _buckets[NumBuckets];
+  PerfCounter* _count;
+  PerfCounter* _sum;
+
+  static uint bucket_index(jlong micros);
+
+ public:
+  TimeHistogramCounters(const char* name_space, const char* name);
+
+  void record(double duration_ms);
+};
+
+#endif // SHARE_GC_SHARED_TIMEHISTOGRAMCOUNTERS_HPP
@@ -33,6 +33,8 @@
 
 uint WorkerPolicy::_parallel_worker_threads = 0;
 bool WorkerPolicy::_parallel_worker_threads_initialized = false;
+uint WorkerPolicy::_active_processor_count = 0;
+jlong WorkerPolicy::_active_processor_count_next_sample = 0;
 
 uint WorkerPolicy::nof_parallel_worker_threads(uint num,
                                                uint den,
@@ -83,6 +85,18 @@ uint WorkerPolicy::parallel_worker_threads() {
   return _parallel_worker_threads;
 }
 
+uint WorkerPolicy::active_processor_count() {
+  // os::active_processor_count() may have to read the container's cgroup
+  // files, so sample it at most once a second. Races between GC threads
+  // only cause an extra sample or a slightly stale count.
+  jlong now = os::javaTimeNanos();
+  if (_active_processor_count == 0 || now >= _active_processor_count_next_sample) {
+    _active_processor_count = (uint) os::active_processor_count();
+    _active_processor_count_next_sample = now + NANOSECS_PER_SEC;
+  }
+  return _active_processor_count;
+}
+
 //  If the number of GC threads was set on the command line, use it.
 //  Else
 //    Calculate the number of GC threads based on the number of Java threads.
@@ -128,6 +142,18 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // Unless ParallelGCThreads was set explicitly, never use more workers
+  // than there are processors currently available to the VM.
+  // total_workers was sized from the processor count at startup; a
+  // container CPU quota may since have shrunk, and workers beyond it only
+  // add scheduling and termination overhead.
+  if (FLAG_IS_DEFAULT(ParallelGCThreads)) {
+    uintx active_processors = (uintx) active_processor_count();
+    if (new_active_workers > active_processors) {
+      new_active_workers = MAX2(min_workers, active_processors);
+    }
+  }
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -34,6 +34,8 @@ class WorkerPolicy : public AllStatic {
   static bool _debug_perturbation;
   static uint _parallel_worker_threads;
   static bool _parallel_worker_threads_initialized;
+  static uint _active_processor_count;
+  static jlong _active_processor_count_next_sample;
 
   static uint nof_parallel_worker_threads(uint num,
                                           uint den,
@@ -43,6 +45,9 @@ class WorkerPolicy : public AllStatic {
   // be CPU-architecture-specific.
   static uint calc_parallel_worker_threads();
 
+  // Returns os::active_processor_count(), re-sampled at most once a second.
+  static uint active_processor_count();
+
 public:
   // Returns the number of parallel threads to be used as default value of
   // ParallelGCThreads. If that number has not been calculated, do so and
@@ -34,7 +34,8 @@
 #include "utilities/quickSort.hpp"
 
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
-  ShenandoahHeuristics() {}
+  ShenandoahHeuristics(),
+  _available_below_min_at_cycle_end(0) {}
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -100,15 +101,56 @@ void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
 }
 
-bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
+void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
+  ShenandoahHeuristics::record_success_concurrent();
+
+  size_t capacity = ShenandoahHeap::heap()->soft_max_capacity();
+  size_t min_threshold = capacity / 100 * ShenandoahMinFreeThreshold;
+  size_t available = this->available();
+  _available_below_min_at_cycle_end = (available < min_threshold) ? available : 0;
+  if (_available_below_min_at_cycle_end > 0) {
+    log_debug(gc)("Deferring trigger: Free (" SIZE_FORMAT "%s) after cycle is below minimum threshold (" SIZE_FORMAT "%s), "
+                  "wait for half of it to be allocated",
+                  byte_size_in_proper_unit(available),     proper_unit_for_byte_size(available),
+                  byte_size_in_proper_unit(min_threshold), proper_unit_for_byte_size(min_threshold));
+  }
+}
+
+void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
+  ShenandoahHeuristics::record_success_degenerated();
+  _available_below_min_at_cycle_end = 0;
+}
+
+void ShenandoahAdaptiveHeuristics::record_success_full() {
+  ShenandoahHeuristics::record_success_full();
+  _available_below_min_at_cycle_end = 0;
+}
+
+// Free memory, without the soft tail.
+size_t ShenandoahAdaptiveHeuristics::available() const {
   ShenandoahHeap* heap = ShenandoahHeap::heap();
-  size_t max_capacity = heap->max_capacity();
-  size_t capacity = heap->soft_max_capacity();
   size_t available = heap->free_set()->available();
+  size_t soft_tail = heap->max_capacity() - heap->soft_max_capacity();
+  return (available > soft_tail) ? (available - soft_tail) : 0;
+}
 
-  // Make sure the code below treats available without the soft tail.
-  size_t soft_tail = max_capacity - capacity;
-  available = (available > soft_tail) ? (available - soft_tail) : 0;
+bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t capacity = heap->soft_max_capacity();
+  size_t available = this->available();
+
+  // If the last cycle could not bring free memory above the minimum threshold,
+  // most of the heap is live. The triggers below would then start the next
+  // cycle right away, which marks the whole heap again, only to find the garbage
+  // allocated since. Wait until the application has allocated at least half
+  // of the memory that was left free. Allocation failures still start a
+  // degenerated cycle if the application runs out of memory before that.
+  if (_available_below_min_at_cycle_end > 0) {
+    size_t allocated = heap->bytes_allocated_since_gc_start();
+    if (allocated < _available_below_min_at_cycle_end / 2) {
+      return ShenandoahHeuristics::should_start_gc();
+    }
+  }
 
   // Check if we are falling below the worst limit, time to trigger the GC, regardless of
   // anything else.
@@ -30,6 +30,13 @@
 #include "utilities/numberSeq.hpp"
 
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
+private:
+  // Free memory after the last concurrent cycle, if that was below
+  // the minimum free threshold. Zero otherwise.
+  size_t _available_below_min_at_cycle_end;
+
+  size_t available() const;
+
 public:
   ShenandoahAdaptiveHeuristics();
 
@@ -41,6 +48,10 @@ public:
 
   void record_cycle_start();
 
+  virtual void record_success_concurrent();
+  virtual void record_success_degenerated();
+  virtual void record_success_full();
+
   virtual bool should_start_gc() const;
 
   virtual const char* name()     { return "Adaptive"; }
@@ -410,3 +410,20 @@ void ShenandoahAsserts::assert_heaplocked_or_safepoint(const char* file, int lin
   ShenandoahMessageBuffer msg("Heap lock must be owned by current thread, or be at safepoint");
   report_vm_error(file, line, msg.buffer());
 }
+
+void ShenandoahAsserts::assert_heaplocked_or_fullgc_safepoint(const char* file, int line) {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+
+  if (heap->lock()->owned_by_self()) {
+    return;
+  }
+
+  // Full GC workers update region states in parallel, while the VM thread
+  // holds the heap lock on their behalf.
+  if (ShenandoahSafepoint::is_at_shenandoah_safepoint() && heap->is_full_gc_in_progress()) {
+    return;
+  }
+
+  ShenandoahMessageBuffer msg("Heap lock must be owned by current thread, or be at Full GC safepoint");
+  report_vm_error(file, line, msg.buffer());
+}
@@ -256,28 +256,35 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
   // inclusive. Contiguous allocations are biased to the beginning.
 
   size_t beg = _mutator_leftmost;
-  size_t end = beg;
+  size_t end = beg + num - 1;
 
   while (true) {
-    if (end >= _max) {
+    if (end > _mutator_rightmost) {
       // Hit the end, goodbye
       return NULL;
     }
 
-    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
-    // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !can_allocate_from(_heap->get_region(end))) {
-      end++;
-      beg = end;
-      continue;
+    // Check the candidate [beg; end] backwards. If region $k is not mutator free, or
+    // not completely free, no interval containing it can be used, and we may fast-forward
+    // the candidate to start right after it. This skips up to $num regions per probe.
+    // Regions already known to be free are re-checked at most once, because the next
+    // candidate either fails before reaching them or succeeds.
+    size_t k = end + 1;
+    bool usable = true;
+    while (k > beg) {
+      k--;
+      if (!is_mutator_free(k) || !can_allocate_from(_heap->get_region(k))) {
+        usable = false;
+        break;
+      }
     }
-
-    if ((end - beg + 1) == num) {
+    if (usable) {
       // found the match
       break;
     }
 
-    end++;
+    beg = k + 1;
+    end = beg + num - 1;
   };
 
   size_t remainder = words_size & ShenandoahHeapRegion::region_size_words_mask();
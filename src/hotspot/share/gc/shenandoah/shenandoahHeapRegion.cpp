@@ -99,7 +99,7 @@ void ShenandoahHeapRegion::make_regular_allocation() {
 }
 
 void ShenandoahHeapRegion::make_regular_bypass() {
-  shenandoah_assert_heaplocked();
+  shenandoah_assert_heaplocked_or_fullgc_safepoint();
   assert (ShenandoahHeap::heap()->is_full_gc_in_progress() || ShenandoahHeap::heap()->is_degenerated_gc_in_progress(),
           "only for full or degen GC");
 
@@ -238,7 +238,7 @@ void ShenandoahHeapRegion::make_cset() {
 }
 
 void ShenandoahHeapRegion::make_trash() {
-  shenandoah_assert_heaplocked();
+  shenandoah_assert_heaplocked_or_fullgc_safepoint();
   switch (_state) {
     case _cset:
       // Reclaiming cset regions
@@ -263,7 +263,7 @@ void ShenandoahHeapRegion::make_trash_immediate() {
 }
 
 void ShenandoahHeapRegion::make_empty() {
-  shenandoah_assert_heaplocked();
+  shenandoah_assert_heaplocked_or_fullgc_safepoint();
   switch (_state) {
     case _trash:
       set_state(_empty_committed);
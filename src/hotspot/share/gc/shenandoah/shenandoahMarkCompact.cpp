@@ -49,6 +49,7 @@
 #include "memory/universe.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/thread.hpp"
@@ -228,6 +229,8 @@ public:
     _ctx->capture_top_at_mark_start(r);
     r->clear_live_data();
   }
+
+  bool is_thread_safe() { return true; }
 };
 
 void ShenandoahMarkCompact::phase1_mark_heap() {
@@ -237,7 +240,7 @@ void ShenandoahMarkCompact::phase1_mark_heap() {
   ShenandoahHeap* heap = ShenandoahHeap::heap();
 
   ShenandoahPrepareForMarkClosure cl;
-  heap->heap_region_iterate(&cl);
+  heap->parallel_heap_region_iterate(&cl);
 
   ShenandoahConcurrentMark* cm = heap->concurrent_mark();
 
@@ -489,16 +492,16 @@ public:
         assert(r->has_live(),
                "Region " SIZE_FORMAT " should have live", r->index());
       }
-    } else if (r->is_humongous_continuation()) {
-      // If we hit continuation, the non-live humongous starts should have been trashed already
-      assert(r->humongous_start_region()->has_live(),
-             "Region " SIZE_FORMAT " should have live", r->index());
     } else if (r->is_regular()) {
       if (!r->has_live()) {
         r->make_trash_immediate();
       }
     }
+    // Humongous continuations are trashed along with their start region. Regions
+    // are processed in parallel, so the continuation may not have been visited yet.
   }
+
+  bool is_thread_safe() { return true; }
 };
 
 void ShenandoahMarkCompact::distribute_slices(ShenandoahHeapRegionSet** worker_slices) {
@@ -656,7 +659,7 @@ void ShenandoahMarkCompact::phase2_calculate_target_addresses(ShenandoahHeapRegi
   {
     // Trash the immediately collectible regions before computing addresses
     ShenandoahTrashImmediateGarbageClosure tigcl;
-    heap->heap_region_iterate(&tigcl);
+    heap->parallel_heap_region_iterate(&tigcl);
 
     // Make sure regions are in good state: committed, active, clean.
     // This is needed because we are potentially sliding the data through them.
@@ -843,7 +846,9 @@ public:
 class ShenandoahPostCompactClosure : public ShenandoahHeapRegionClosure {
 private:
   ShenandoahHeap* const _heap;
-  size_t _live;
+  shenandoah_padding(0);
+  volatile size_t _live;
+  shenandoah_padding(1);
 
 public:
   ShenandoahPostCompactClosure() : _heap(ShenandoahHeap::heap()), _live(0) {
@@ -882,11 +887,15 @@ public:
 
     r->set_live_data(live);
     r->reset_alloc_metadata();
-    _live += live;
+    if (live > 0) {
+      Atomic::add(&_live, live);
+    }
   }
 
+  bool is_thread_safe() { return true; }
+
   size_t get_live() {
-    return _live;
+    return Atomic::load(&_live);
   }
 };
 
@@ -1016,7 +1025,7 @@ void ShenandoahMarkCompact::phase4_compact_objects(ShenandoahHeapRegionSet** wor
     ShenandoahGCPhase phase(ShenandoahPhaseTimings::full_gc_copy_objects_rebuild);
 
     ShenandoahPostCompactClosure post_compact;
-    heap->heap_region_iterate(&post_compact);
+    heap->parallel_heap_region_iterate(&post_compact);
     heap->set_used(post_compact.get_live());
 
     heap->collection_set()->clear();
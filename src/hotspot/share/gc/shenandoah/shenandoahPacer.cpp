@@ -202,16 +202,16 @@ bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
 
   intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
 
-  intptr_t cur = 0;
-  intptr_t new_val = 0;
-  do {
-    cur = Atomic::load(&_budget);
-    if (cur < tax && !force) {
-      // Progress depleted, alas.
-      return false;
-    }
-    new_val = cur - tax;
-  } while (Atomic::cmpxchg(&_budget, cur, new_val) != cur);
+  if (!force && Atomic::load(&_budget) < tax) {
+    // Progress depleted, alas.
+    return false;
+  }
+
+  // Claim with a single atomic add instead of a CAS loop, which keeps
+  // retrying when many threads allocate at once. Racing claimers may
+  // overdraw the budget a little past the check above. That is no
+  // different from a forced claim, and GC progress pays it back.
+  Atomic::sub(&_budget, tax);
   return true;
 }
 
@@ -41,10 +41,61 @@ void ZDirector::sample_allocation_rate() const {
   // below to estimate the time we have until we run out of memory.
   const double bytes_per_second = ZStatAllocRate::sample_and_reset();
 
-  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s",
+  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s, Max: %.3fMB/s",
                        bytes_per_second / M,
                        ZStatAllocRate::avg() / M,
-                       ZStatAllocRate::avg_sd() / M);
+                       ZStatAllocRate::avg_sd() / M,
+                       ZStatAllocRate::max() / M);
+}
+
+// Calculate amount of free memory available to Java threads. Note that
+// the heap reserve is not available to Java threads and is therefore not
+// considered part of the free memory.
+size_t ZDirector::free_for_java_threads() {
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t max_reserve = ZHeap::heap()->max_reserve();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
+  return free_with_reserve - MIN2(free_with_reserve, max_reserve);
+}
+
+// The allocation rate is a moving average and we multiply that with an
+// allocation spike tolerance factor to guard against unforeseen phase
+// changes in the allocate rate. We then add ~3.3 sigma to account for
+// the allocation rate variance, which means the probability is 1 in 1000
+// that a sample is outside of the confidence interval. A burst that is
+// already under way can outrun that estimate before it shows up in the
+// average, so never assume a rate lower than the highest recent sample.
+double ZDirector::max_alloc_rate() {
+  const double predicted = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+  return MAX2(predicted, ZStatAllocRate::max());
+}
+
+// The duration of GC is a moving average, we add ~3.3 sigma to account
+// for the GC duration variance.
+double ZDirector::max_duration_of_gc() {
+  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
+  return duration_of_gc.davg() + (duration_of_gc.dsd() * one_in_1000);
+}
+
+bool ZDirector::is_gc_expected_to_stall() {
+  if (!ZStatCycle::is_normalized_duration_trustable()) {
+    // Unknown
+    return false;
+  }
+
+  // The allocation rate rule below normally starts a GC at most one sample
+  // interval before the estimated last possible moment. If we are past that
+  // moment, because the allocation rate went up or the heap filled up faster
+  // than sampled, a cycle with the normal number of worker threads will not
+  // complete in time.
+  const double time_until_oom = free_for_java_threads() / (max_alloc_rate() + 1.0);
+  const double time_until_gc = time_until_oom - max_duration_of_gc();
+
+  log_debug(gc, director)("Expected Stall Check, TimeUntilOOM: %.3fs, TimeUntilGC: %.3fs",
+                          time_until_oom, time_until_gc);
+
+  return time_until_gc < 0;
 }
 
 bool ZDirector::rule_timer() const {
@@ -95,28 +146,14 @@ bool ZDirector::rule_allocation_rate() const {
   // margin based on variations in the allocation rate and unforeseen
   // allocation spikes.
 
-  // Calculate amount of free memory available to Java threads. Note that
-  // the heap reserve is not available to Java threads and is therefore not
-  // considered part of the free memory.
-  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t max_reserve = ZHeap::heap()->max_reserve();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve);
-
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+  // of free memory available to Java threads.
+  const size_t free = free_for_java_threads();
+  const double max_alloc_rate = ZDirector::max_alloc_rate();
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
-  // Calculate max duration of a GC cycle. The duration of GC is a moving
-  // average, we add ~3.3 sigma to account for the GC duration variance.
-  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
-  const double max_duration_of_gc = duration_of_gc.davg() + (duration_of_gc.dsd() * one_in_1000);
+  // Calculate max duration of a GC cycle.
+  const double max_duration_of_gc = ZDirector::max_duration_of_gc();
 
   // Calculate time until GC given the time until OOM and max duration of GC.
   // We also deduct the sample interval, so that we don't overshoot the target
@@ -161,8 +198,7 @@ bool ZDirector::rule_proactive() const {
 
   const double assumed_throughput_drop_during_gc = 0.50; // 50%
   const double acceptable_throughput_drop = 0.01;        // 1%
-  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
-  const double max_duration_of_gc = duration_of_gc.davg() + (duration_of_gc.dsd() * one_in_1000);
+  const double max_duration_of_gc = ZDirector::max_duration_of_gc();
   const double acceptable_gc_interval = max_duration_of_gc * ((assumed_throughput_drop_during_gc / acceptable_throughput_drop) - 1.0);
   const double time_until_gc = acceptable_gc_interval - time_since_last_gc;
 
@@ -179,14 +215,8 @@ bool ZDirector::rule_high_usage() const {
   // memory is still slowly but surely heading towards zero. In this situation,
   // we start a GC cycle to avoid a potential allocation stall later.
 
-  // Calculate amount of free memory available to Java threads. Note that
-  // the heap reserve is not available to Java threads and is therefore not
-  // considered part of the free memory.
   const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t max_reserve = ZHeap::heap()->max_reserve();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve);
+  const size_t free = free_for_java_threads();
   const double free_percent = percent_of(free, soft_max_capacity);
 
   log_debug(gc, director)("Rule: High Usage, Free: " SIZE_FORMAT "MB(%.1f%%)",
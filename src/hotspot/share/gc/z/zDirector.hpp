@@ -34,6 +34,10 @@ private:
 
   ZMetronome _metronome;
 
+  static size_t free_for_java_threads();
+  static double max_alloc_rate();
+  static double max_duration_of_gc();
+
   void sample_allocation_rate() const;
 
   bool rule_timer() const;
@@ -49,6 +53,11 @@ protected:
 
 public:
   ZDirector();
+
+  // Returns true if a GC cycle started now, using the normal number of
+  // concurrent worker threads, is expected to run out of memory before
+  // it completes.
+  static bool is_gc_expected_to_stall();
 };
 
 #endif // SHARE_GC_Z_ZDIRECTOR_HPP
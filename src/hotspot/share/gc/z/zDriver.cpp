@@ -27,6 +27,7 @@
 #include "gc/shared/isGCActiveMark.hpp"
 #include "gc/z/zBreakpoint.hpp"
 #include "gc/z/zCollectedHeap.hpp"
+#include "gc/z/zDirector.hpp"
 #include "gc/z/zDriver.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zMessagePort.inline.hpp"
@@ -152,6 +153,16 @@ static bool should_boost_worker_threads() {
     return true;
   }
 
+  // Boost worker threads if allocations are expected to stall before
+  // a cycle with the normal number of worker threads would complete.
+  // This avoids the stall, instead of reacting to it.
+  if ((cause == GCCause::_z_allocation_rate ||
+       cause == GCCause::_z_high_usage) &&
+      ZDirector::is_gc_expected_to_stall()) {
+    // Boost
+    return true;
+  }
+
   // Don't boost
   return false;
 }
@@ -317,6 +328,14 @@ bool ZDriver::pause_mark_end() {
 
 void ZDriver::concurrent_mark_continue() {
   ZStatTimer timer(ZPhaseConcurrentMarkContinue);
+
+  // Marking did not complete in Pause Mark End. If allocations have started
+  // to stall, or are now expected to, boost the worker threads for the rest
+  // of marking instead of waiting for the next cycle.
+  if (ZHeap::heap()->is_alloc_stalled() || ZDirector::is_gc_expected_to_stall()) {
+    ZHeap::heap()->set_boost_worker_threads(true);
+  }
+
   ZHeap::heap()->mark(false /* initial */);
 }
 
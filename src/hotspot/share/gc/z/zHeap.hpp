@@ -110,6 +110,7 @@ public:
   ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
   void undo_alloc_page(ZPage* page);
   void free_page(ZPage* page, bool reclaimed);
+  ZPage* page(uintptr_t addr) const;
 
   // Object allocation
   uintptr_t alloc_tlab(size_t size);
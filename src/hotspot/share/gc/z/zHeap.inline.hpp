@@ -48,6 +48,10 @@ inline uint32_t ZHeap::hash_oop(uintptr_t addr) const {
   return ZHash::address_to_uint32(offset);
 }
 
+inline ZPage* ZHeap::page(uintptr_t addr) const {
+  return _page_table.get(addr);
+}
+
 inline bool ZHeap::is_object_live(uintptr_t addr) const {
   ZPage* page = _page_table.get(addr);
   return page->is_object_live(addr);
@@ -27,21 +27,29 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zGranuleMap.inline.hpp"
+#include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "memory/iterator.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 
+// One bit per possible object start in a granule. Objects are aligned
+// according to the type of the page they are on, so granules of medium and
+// large pages need far fewer bits than granules of small pages.
 class ZHeapIteratorBitMap : public CHeapObj<mtGC> {
 private:
-  CHeapBitMap _bitmap;
+  const size_t _object_alignment_shift;
+  CHeapBitMap  _bitmap;
 
 public:
-  ZHeapIteratorBitMap(size_t size_in_bits) :
-      _bitmap(size_in_bits, mtGC) {}
+  ZHeapIteratorBitMap(size_t object_alignment_shift) :
+      _object_alignment_shift(object_alignment_shift),
+      _bitmap(ZGranuleSize >> object_alignment_shift, mtGC) {}
 
-  bool try_set_bit(size_t index) {
+  bool try_set_bit(uintptr_t offset) {
+    const size_t index = (offset & (ZGranuleSize - 1)) >> _object_alignment_shift;
     return _bitmap.par_set_bit(index);
   }
 };
@@ -213,26 +221,17 @@ ZHeapIterator::~ZHeapIterator() {
   }
 }
 
-static size_t object_index_max() {
-  return ZGranuleSize >> ZObjectAlignmentSmallShift;
-}
-
-static size_t object_index(oop obj) {
+ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
   const uintptr_t addr = ZOop::to_address(obj);
   const uintptr_t offset = ZAddress::offset(addr);
-  const uintptr_t mask = ZGranuleSize - 1;
-  return (offset & mask) >> ZObjectAlignmentSmallShift;
-}
-
-ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
-  const uintptr_t offset = ZAddress::offset(ZOop::to_address(obj));
   ZHeapIteratorBitMap* bitmap = _bitmaps.get_acquire(offset);
   if (bitmap == NULL) {
     ZLocker<ZLock> locker(&_bitmaps_lock);
     bitmap = _bitmaps.get(offset);
     if (bitmap == NULL) {
       // Install new bitmap
-      bitmap = new ZHeapIteratorBitMap(object_index_max());
+      const ZPage* const page = ZHeap::heap()->page(addr);
+      bitmap = new ZHeapIteratorBitMap(page->object_alignment_shift());
       _bitmaps.release_put(offset, bitmap);
     }
   }
@@ -246,8 +245,7 @@ bool ZHeapIterator::mark_object(oop obj) {
   }
 
   ZHeapIteratorBitMap* const bitmap = object_bitmap(obj);
-  const size_t index = object_index(obj);
-  return bitmap->try_set_bit(index);
+  return bitmap->try_set_bit(ZAddress::offset(ZOop::to_address(obj)));
 }
 
 template <bool Concurrent, bool Weak, typename RootsIterator>
@@ -35,9 +35,10 @@ void ZHeuristics::set_medium_page_size() {
   // Set ZPageSizeMedium so that a medium page occupies at most 3.125% of the
   // max heap size. ZPageSizeMedium is initially set to 0, which means medium
   // pages are effectively disabled. It is adjusted only if ZPageSizeMedium
-  // becomes larger than ZPageSizeSmall.
+  // becomes larger than ZPageSizeSmall. ZMediumPageSizeLimit can lower the
+  // upper bound, moving mid-sized objects to large pages instead.
   const size_t min = ZGranuleSize;
-  const size_t max = ZGranuleSize * 16;
+  const size_t max = MIN2(ZGranuleSize * 16, ZMediumPageSizeLimit);
   const size_t unclamped = MaxHeapSize * 0.03125;
   const size_t clamped = clamp(unclamped, min, max);
   const size_t size = round_down_power_of_2(clamped);
@@ -659,6 +659,12 @@ void ZMark::mark(bool initial) {
   if (initial) {
     ZMarkConcurrentRootsTask task(this);
     _workers->run_concurrent(&task);
+  } else {
+    // The number of concurrent workers may have been boosted since mark
+    // start. The stripes are left as they are, since entries may already
+    // be pushed to all of them, and extra workers are spread over them
+    // as spillover workers.
+    _nworkers = _workers->nconcurrent();
   }
 
   ZMarkTask task(this);
@@ -45,14 +45,20 @@ ZObjectAllocator::ZObjectAllocator() :
     _undone(0),
     _shared_medium_page(NULL),
     _shared_small_page(NULL),
+    _shared_numa_small_page(NULL),
     _worker_small_page(NULL) {}
 
+// Shared small pages are allocated by the thread that installs them, and
+// pages are preferably taken from the NUMA node the thread is running on.
+// When not using per-CPU pages, fall back to per-NUMA pages rather than a
+// single page, so that objects allocated or relocated by mutators are
+// placed on the node of the allocating thread.
 ZPage** ZObjectAllocator::shared_small_page_addr() {
-  return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
+  return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_numa_small_page.addr();
 }
 
 ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
-  return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
+  return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_numa_small_page.addr();
 }
 
 ZPage* ZObjectAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
@@ -312,7 +318,8 @@ void ZObjectAllocator::retire_pages() {
   _undone.set_all(0);
 
   // Reset allocation pages
-  _shared_medium_page.set(NULL);
+  _shared_medium_page.set_all(NULL);
   _shared_small_page.set_all(NULL);
+  _shared_numa_small_page.set_all(NULL);
   _worker_small_page.set_all(NULL);
 }
@@ -34,8 +34,9 @@ private:
   const bool         _use_per_cpu_shared_small_pages;
   ZPerCPU<size_t>    _used;
   ZPerCPU<size_t>    _undone;
-  ZContended<ZPage*> _shared_medium_page;
+  ZPerNUMA<ZPage*>   _shared_medium_page;
   ZPerCPU<ZPage*>    _shared_small_page;
+  ZPerNUMA<ZPage*>   _shared_numa_small_page;
   ZPerWorker<ZPage*> _worker_small_page;
 
   ZPage** shared_small_page_addr();
@@ -38,6 +38,9 @@ static const ZStatCounter ZCounterPageCacheHitL2("Memory", "Page Cache Hit L2",
 static const ZStatCounter ZCounterPageCacheHitL3("Memory", "Page Cache Hit L3", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheMiss("Memory", "Page Cache Miss", ZStatUnitOpsPerSecond);
 
+// Max number of cached medium pages to look at when searching for a NUMA local page
+static const uint32_t MediumPageNUMAScanLimit = 8;
+
 class ZPageCacheFlushClosure : public StackObj {
   friend class ZPageCache;
 
@@ -92,6 +95,29 @@ ZPage* ZPageCache::alloc_small_page() {
 }
 
 ZPage* ZPageCache::alloc_medium_page() {
+  if (ZNUMA::count() > 1) {
+    // Try a NUMA local page among the most recently cached pages
+    const uint32_t numa_id = ZNUMA::id();
+    uint32_t scanned = 0;
+    ZListIterator<ZPage> iter(&_medium);
+    for (ZPage* page; iter.next(&page) && scanned < MediumPageNUMAScanLimit; scanned++) {
+      if (page->numa_id() == numa_id) {
+        _medium.remove(page);
+        ZStatInc(ZCounterPageCacheHitL1);
+        return page;
+      }
+    }
+
+    // Fall back to a NUMA remote page
+    ZPage* const l2_page = _medium.remove_first();
+    if (l2_page != NULL) {
+      ZStatInc(ZCounterPageCacheHitL2);
+      return l2_page;
+    }
+
+    return NULL;
+  }
+
   ZPage* const page = _medium.remove_first();
   if (page != NULL) {
     ZStatInc(ZCounterPageCacheHitL1);
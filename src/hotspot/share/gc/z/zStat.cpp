@@ -837,6 +837,10 @@ double ZStatAllocRate::avg_sd() {
   return _rate_avg.sd();
 }
 
+double ZStatAllocRate::max() {
+  return _rate.maximum();
+}
+
 //
 // Stat thread
 //
@@ -342,6 +342,7 @@ public:
 
   static double avg();
   static double avg_sd();
+  static double max();
 };
 
 //
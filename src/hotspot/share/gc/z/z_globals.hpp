@@ -42,6 +42,12 @@
           "Maximum number of bytes allocated for mark stacks")              \
           range(32*M, 1024*G)                                               \
                                                                             \
+  product(size_t, ZMediumPageSizeLimit, 32*M, EXPERIMENTAL,                 \
+          "Maximum size of medium pages. Objects larger than 1/8 of the "   \
+          "medium page size are allocated in large pages. Medium pages "    \
+          "are disabled if this is not larger than the small page size")    \
+          range(2*M, 32*M)                                                  \
+                                                                            \
   product(double, ZCollectionInterval, 0,                                   \
           "Force GC at a fixed time interval (in seconds)")                 \
                                                                             \
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/signature.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -425,15 +426,31 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // The method idnum tells apart methods of the same class that have the
+  // same shape.
   return   ((unsigned int) bci)
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+         ^ ((unsigned int) method->size_of_parameters() << 6)
+         ^ ((unsigned int) method->method_idnum()       << 8);
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
+volatile size_t OopMapCache::_lookups = 0;
+volatile size_t OopMapCache::_misses = 0;
+volatile size_t OopMapCache::_evictions = 0;
+
+// The counters are shared by all GC worker threads, so only update them
+// when they are going to be logged.
+inline void OopMapCache::count(volatile size_t* counter) {
+  if (log_is_enabled(Info, interpreter, oopmap)) {
+    Atomic::inc(counter, memory_order_relaxed);
+  }
+}
 
-OopMapCache::OopMapCache() {
+// Allow for a few cached bcis per method
+OopMapCache::OopMapCache(int method_count) :
+  _size(clamp(round_up_power_of_2(MAX2(method_count, 1) * 4), (int)_min_size, (int)_max_size)) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
@@ -504,6 +521,8 @@ void OopMapCache::lookup(const methodHandle& method,
            method()->name_and_sig_as_C_string(), probe);
   }
 
+  count(&_lookups);
+
   // Search hashtable for match
   for(i = 0; i < _probe_depth; i++) {
     entry = entry_at(probe + i);
@@ -517,6 +536,7 @@ void OopMapCache::lookup(const methodHandle& method,
 
   // Entry is not in hashtable.
   // Compute entry
+  count(&_misses);
 
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
@@ -544,6 +564,7 @@ void OopMapCache::lookup(const methodHandle& method,
   }
 
   log_debug(interpreter, oopmap)("*** collision in oopmap cache - flushing item ***");
+  count(&_evictions);
 
   // No empty slot (uncommon case). Use (some approximation of a) LRU algorithm
   // where the first entry in the collision array is replaced with the new one.
@@ -592,6 +613,22 @@ void OopMapCache::cleanup_old_entries() {
   }
 }
 
+void OopMapCache::print_statistics(outputStream* st) {
+  size_t lookups = Atomic::load(&_lookups);
+  size_t misses = Atomic::load(&_misses);
+  st->print_cr("Interpreter oop map cache: " SIZE_FORMAT " lookups, " SIZE_FORMAT " hits, "
+               SIZE_FORMAT " misses, " SIZE_FORMAT " evictions",
+               lookups, lookups - misses, misses, Atomic::load(&_evictions));
+}
+
+void OopMapCache::log_statistics() {
+  LogTarget(Info, interpreter, oopmap) log;
+  if (log.is_enabled()) {
+    LogStream out(log);
+    print_statistics(&out);
+  }
+}
+
 void OopMapCache::compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry) {
   // Due to the invariants above it's tricky to allocate a temporary OopMapCacheEntry on the stack
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
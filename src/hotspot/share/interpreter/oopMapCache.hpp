@@ -146,11 +146,20 @@ class InterpreterOopMap: ResourceObj {
 
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+
+ // Statistics, only updated when interpreter+oopmap logging is enabled
+ static volatile size_t _lookups;
+ static volatile size_t _misses;
+ static volatile size_t _evictions;
+ static void count(volatile size_t* counter);
+
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _min_size    = 32,     // size for classes with few methods
+         _max_size    = 1024,
          _probe_depth = 3       // probe depth in case of collisions
   };
 
+  const int _size;
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
@@ -162,7 +171,9 @@ class OopMapCache : public CHeapObj<mtClass> {
   void flush();
 
  public:
-  OopMapCache();
+  // The cache holds oop maps for the methods of one class, so it is
+  // sized by the number of methods in that class.
+  explicit OopMapCache(int method_count);
   ~OopMapCache();                                // free up memory
 
   // flush cache entry is occupied by an obsolete method
@@ -175,6 +186,9 @@ class OopMapCache : public CHeapObj<mtClass> {
   // Compute an oop map without updating the cache or grabbing any locks (for debugging)
   static void compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry);
   static void cleanup_old_entries();
+
+  static void print_statistics(outputStream* st);
+  static void log_statistics();
 };
 
 #endif // SHARE_INTERPRETER_OOPMAPCACHE_HPP
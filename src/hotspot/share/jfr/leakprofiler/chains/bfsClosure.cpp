@@ -118,7 +118,7 @@ void BFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
   assert(!reference.is_null(), "invariant");
   assert(reference.dereference() == pointee, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || !_edge_store->has_unresolved_leak_candidates()) {
      return;
   }
 
@@ -184,6 +184,10 @@ void BFSClosure::step_frontier() const {
 }
 
 bool BFSClosure::is_complete() const {
+  if (!_edge_store->has_unresolved_leak_candidates()) {
+    // every sample object has been reached, the rest of the heap is irrelevant
+    return true;
+  }
   if (_edge_queue->bottom() < _next_frontier_idx) {
     return false;
   }
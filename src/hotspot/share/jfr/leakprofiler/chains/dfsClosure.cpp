@@ -77,7 +77,7 @@ void DFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
   assert(pointee != NULL, "invariant");
   assert(!reference.is_null(), "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || !_edge_store->has_unresolved_leak_candidates()) {
     return;
   }
   if (_depth == 0 && _ignore_root_set) {
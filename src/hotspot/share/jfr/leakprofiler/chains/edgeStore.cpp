@@ -36,7 +36,7 @@ StoredEdge::StoredEdge(const StoredEdge& edge) : Edge(edge), _gc_root_id(edge._g
 
 traceid EdgeStore::_edge_id_counter = 0;
 
-EdgeStore::EdgeStore() : _edges(NULL) {
+EdgeStore::EdgeStore() : _edges(NULL), _unresolved_leak_candidates(0) {
   _edges = new EdgeHashTable(this);
 }
 
@@ -251,6 +251,9 @@ void EdgeStore::put_chain(const Edge* chain, size_t length) {
   StoredEdge* const leak_context_edge = associate_leak_context_with_candidate(chain);
   assert(leak_context_edge != NULL, "invariant");
   assert(leak_context_edge->parent() == NULL, "invariant");
+  if (_unresolved_leak_candidates > 0) {
+    --_unresolved_leak_candidates;
+  }
 
   if (1 == length) {
     store_gc_root_id_in_leak_context_edge(leak_context_edge, leak_context_edge);
@@ -72,6 +72,7 @@ class EdgeStore : public CHeapObj<mtTracing> {
  private:
   static traceid _edge_id_counter;
   EdgeHashTable* _edges;
+  size_t _unresolved_leak_candidates;
 
   // Hash table callbacks
   void on_link(EdgeEntry* entry);
@@ -103,6 +104,11 @@ class EdgeStore : public CHeapObj<mtTracing> {
   bool is_empty() const;
   traceid get_id(const Edge* edge) const;
   void put_chain(const Edge* chain, size_t length);
+
+  // The number of marked sample objects that have not yet been reached.
+  // Once all of them have a chain, the reachability search can stop.
+  void set_unresolved_leak_candidates(size_t count) { _unresolved_leak_candidates = count; }
+  bool has_unresolved_leak_candidates() const { return _unresolved_leak_candidates > 0; }
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_CHAINS_EDGESTORE_HPP
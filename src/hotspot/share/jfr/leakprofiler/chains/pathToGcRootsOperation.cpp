@@ -100,10 +100,13 @@ void PathToGcRootsOperation::doit() {
   // Save the original markWord for the potential leak objects,
   // to be restored on function exit
   ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all) == 0) {
+  const int nof_candidates = ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all);
+  if (nof_candidates == 0) {
     // no valid samples to process
     return;
   }
+  // The search terminates as soon as all candidates have been reached
+  _edge_store->set_unresolved_leak_candidates((size_t)nof_candidates);
 
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
@@ -52,6 +52,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -62,6 +63,9 @@
 #include "runtime/vmThread.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/management.hpp"
+#include "services/mallocTracker.hpp"
+#include "services/memTracker.hpp"
+#include "services/virtualMemoryTracker.hpp"
 #include "services/threadService.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -461,6 +465,69 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+// Committed bytes per memory type when the last NativeMemoryUsage events
+// were sent. Only the periodic task thread reads and writes these. The
+// first events have no previous sample and report a delta of 0.
+static size_t _nmt_last_committed[mt_number_of_types];
+static bool _nmt_usage_sampled = false;
+
+// Read the summary counters that NMT maintains on every allocation, without
+// walking malloc sites or virtual memory regions. The malloc counters come
+// from an adjusted snapshot, so arena chunks are not counted twice, and the
+// malloc headers are counted under mtNMT, as in the NMT summary report.
+// Thread stacks are only as current as the last NMT report if they are
+// tracked as virtual memory.
+static void nmt_usage(MallocMemorySnapshot* malloc_snapshot, MEMFLAGS flag,
+                      size_t* reserved, size_t* committed) {
+  MallocMemory* malloc_memory = malloc_snapshot->by_type(flag);
+  VirtualMemory* virtual_memory = VirtualMemorySummary::as_snapshot()->by_type(flag);
+  size_t malloced = malloc_memory->malloc_size() + malloc_memory->arena_size();
+  if (flag == mtNMT) {
+    malloced += malloc_snapshot->malloc_overhead();
+  }
+  *reserved = malloced + virtual_memory->reserved();
+  *committed = malloced + virtual_memory->committed();
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  MallocMemorySnapshot malloc_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  JfrTicks ts = JfrTicks::now();
+  for (int index = 0; index < mt_number_of_types; index++) {
+    MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    size_t reserved;
+    size_t committed;
+    nmt_usage(&malloc_snapshot, flag, &reserved, &committed);
+    EventNativeMemoryUsage event(UNTIMED);
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(reserved);
+    event.set_committed(committed);
+    event.set_committedDelta(_nmt_usage_sampled ? (s8)committed - (s8)_nmt_last_committed[index] : 0);
+    event.set_endtime(ts);
+    event.commit();
+    _nmt_last_committed[index] = committed;
+  }
+  _nmt_usage_sampled = true;
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  MallocMemorySnapshot malloc_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  // MallocMemorySnapshot::total() includes the tracking overhead, as in
+  // MemSummaryReporter::report().
+  VirtualMemorySnapshot* vm_snapshot = VirtualMemorySummary::as_snapshot();
+  EventNativeMemoryUsageTotal event;
+  event.set_reserved(malloc_snapshot.total() + vm_snapshot->total_reserved());
+  event.set_committed(malloc_snapshot.total() + vm_snapshot->total_committed());
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -577,6 +644,10 @@ TRACE_REQUEST_FUNC(CompilerStatistics) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(DeoptimizationStatistics) {
+  Deoptimization::post_statistics_events();
+}
+
 TRACE_REQUEST_FUNC(CompilerConfiguration) {
   EventCompilerConfiguration event;
   event.set_threadCount(CICompilerCount);
@@ -363,11 +363,35 @@ static bool is_excluded(JavaThread* thread) {
   return thread->is_hidden_from_external_view() || thread->in_deopt_handler() || thread->jfr_thread_local()->is_excluded();
 }
 
+// A thread can be _thread_in_Java without being on a cpu, e.g. when it is runnable
+// but descheduled. Sampling such a thread again and again skews the execution profile
+// towards threads that are merely runnable and uses up the per-round sample budget.
+// Only threads that have consumed cpu time since they were last considered are sampled.
+static bool has_consumed_cpu_since_last_sample(JavaThread* thread) {
+  assert(thread != NULL, "invariant");
+  if (!os::is_thread_cpu_time_supported()) {
+    return true;
+  }
+  const jlong cpu_time = os::thread_cpu_time(thread);
+  if (cpu_time == -1) {
+    return true;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (cpu_time == tl->get_sampled_cpu_time()) {
+    return false;
+  }
+  tl->set_sampled_cpu_time(cpu_time);
+  return true;
+}
+
 bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type) {
   assert(Threads_lock->owned_by_self(), "Holding the thread table lock.");
   if (is_excluded(thread)) {
     return false;
   }
+  if (JAVA_SAMPLE == type && !has_consumed_cpu_since_last_sample(thread)) {
+    return false;
+  }
 
   bool ret = false;
   thread->set_trace_flag();  // Provides StoreLoad, needed to keep read of thread state from floating up.
@@ -27,6 +27,7 @@
 
 #include "jfr/utilities/jfrAllocation.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
+#include "runtime/atomic.hpp"
 
 class frame;
 class InstanceKlass;
@@ -69,7 +70,7 @@ class JfrStackTrace : public JfrCHeapObj {
   friend class OSThreadSampler;
   friend class StackTraceResolver;
  private:
-  const JfrStackTrace* _next;
+  const JfrStackTrace* volatile _next;
   JfrStackFrame* _frames;
   traceid _id;
   unsigned int _hash;
@@ -80,7 +81,9 @@ class JfrStackTrace : public JfrCHeapObj {
   mutable bool _lineno;
   mutable bool _written;
 
-  const JfrStackTrace* next() const { return _next; }
+  // The repository reads the bucket chains without holding its lock.
+  const JfrStackTrace* next() const { return Atomic::load(&_next); }
+  void set_next(const JfrStackTrace* next) { Atomic::store(&_next, next); }
 
   bool should_write() const { return !_written; }
   void write(JfrChunkWriter& cw) const;
@@ -28,13 +28,54 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 static JfrStackTraceRepository* _instance = NULL;
 
-JfrStackTraceRepository::JfrStackTraceRepository() : _next_id(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
-}
+// A bucket array of the repository. The buckets are read with acquire
+// semantics, since they are read without holding JfrStacktrace_lock.
+class JfrStackTraceTable : public JfrCHeapObj {
+ private:
+  const size_t _size;
+  const JfrStackTrace* volatile* const _buckets;
+  JfrStackTraceTable* _next_retired;
+
+ public:
+  JfrStackTraceTable(size_t size) :
+    _size(size),
+    _buckets(NEW_C_HEAP_ARRAY(const JfrStackTrace* volatile, size, mtTracing)),
+    _next_retired(NULL) {
+    memset((void*)_buckets, 0, size * sizeof(JfrStackTrace*));
+  }
+
+  ~JfrStackTraceTable() {
+    FREE_C_HEAP_ARRAY(const JfrStackTrace* volatile, _buckets);
+  }
+
+  size_t size() const { return _size; }
+  size_t index_for(unsigned int hash) const { return hash % _size; }
+
+  const JfrStackTrace* bucket(size_t index) const {
+    assert(index < _size, "invariant");
+    return Atomic::load_acquire(&_buckets[index]);
+  }
+
+  void set_bucket(size_t index, const JfrStackTrace* stacktrace) {
+    assert(index < _size, "invariant");
+    Atomic::release_store(&_buckets[index], stacktrace);
+  }
+
+  JfrStackTraceTable* next_retired() const { return _next_retired; }
+  void set_next_retired(JfrStackTraceTable* table) { _next_retired = table; }
+};
+
+JfrStackTraceRepository::JfrStackTraceRepository() :
+  _table(new JfrStackTraceTable(INITIAL_TABLE_SIZE)),
+  _retired_tables(NULL),
+  _next_id(0),
+  _entries(0) {}
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
   return *_instance;
@@ -71,6 +112,36 @@ void JfrStackTraceRepository::destroy() {
   _instance = NULL;
 }
 
+// The first table in the list owns the entries, the other ones are
+// bucket arrays retired by grow_table().
+static void reclaim(JfrStackTraceTable* tables) {
+  assert(tables != NULL, "invariant");
+  // Wait for lock-free lookups that might still see the entries.
+  GlobalCounter::write_synchronize();
+  for (size_t i = 0; i < tables->size(); ++i) {
+    const JfrStackTrace* stacktrace = tables->bucket(i);
+    while (stacktrace != NULL) {
+      const JfrStackTrace* const next = stacktrace->next();
+      delete stacktrace;
+      stacktrace = next;
+    }
+  }
+  while (tables != NULL) {
+    JfrStackTraceTable* const next = tables->next_retired();
+    delete tables;
+    tables = next;
+  }
+}
+
+JfrStackTraceRepository::~JfrStackTraceRepository() {
+  clear();
+  delete table();
+}
+
+JfrStackTraceTable* JfrStackTraceRepository::table() const {
+  return Atomic::load_acquire(&_table);
+}
+
 static traceid last_id = 0;
 
 bool JfrStackTraceRepository::is_modified() const {
@@ -81,48 +152,80 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (_entries == 0) {
     return 0;
   }
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  JfrStackTraceTable* cleared = NULL;
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    assert(_entries > 0, "invariant");
+    const JfrStackTraceTable* const current = table();
+    for (size_t i = 0; i < current->size(); ++i) {
+      for (const JfrStackTrace* stacktrace = current->bucket(i); stacktrace != NULL; stacktrace = stacktrace->next()) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
     }
+    if (clear) {
+      cleared = detach_table();
+    }
+    last_id = _next_id;
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+  // Reclaim outside of the lock, writers must not wait for readers with it held.
+  if (cleared != NULL) {
+    reclaim(cleared);
   }
-  last_id = _next_id;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear() {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (_entries == 0) {
-    return 0;
+  JfrStackTraceTable* cleared = NULL;
+  size_t processed = 0;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (_entries == 0) {
+      return 0;
+    }
+    processed = _entries;
+    cleared = detach_table();
   }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+  reclaim(cleared);
+  return processed;
+}
+
+// Replaces the table with an empty one of the same size. Returns the
+// detached table, followed by the retired tables, for reclamation.
+JfrStackTraceTable* JfrStackTraceRepository::detach_table() {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  JfrStackTraceTable* const detached = table();
+  Atomic::release_store(&_table, new JfrStackTraceTable(detached->size()));
+  detached->set_next_retired(_retired_tables);
+  _retired_tables = NULL;
+  _entries = 0;
+  return detached;
+}
+
+// Moves the entries into a bucket array of about twice the size. The entries
+// are relinked in place, so a concurrent lock-free lookup may miss an entry,
+// in which case add_trace() retries the lookup with the lock held.
+void JfrStackTraceRepository::grow_table() {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  JfrStackTraceTable* const old_table = table();
+  JfrStackTraceTable* const new_table = new JfrStackTraceTable(old_table->size() * 2 + 1);
+  for (size_t i = 0; i < old_table->size(); ++i) {
+    const JfrStackTrace* stacktrace = old_table->bucket(i);
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
+      const JfrStackTrace* const next = stacktrace->next();
+      const size_t index = new_table->index_for(stacktrace->hash());
+      const_cast<JfrStackTrace*>(stacktrace)->set_next(new_table->bucket(index));
+      new_table->set_bucket(index, stacktrace);
       stacktrace = next;
     }
   }
-  memset(_table, 0, sizeof(_table));
-  const size_t processed = _entries;
-  _entries = 0;
-  return processed;
+  Atomic::release_store(&_table, new_table);
+  // Lock-free lookups may still read the old bucket array.
+  old_table->set_next_retired(_retired_tables);
+  _retired_tables = old_table;
 }
 
 traceid JfrStackTraceRepository::record(Thread* thread, int skip /* 0 */) {
@@ -173,10 +276,30 @@ void JfrStackTraceRepository::record_and_cache(JavaThread* thread, int skip /* 0
   }
 }
 
+traceid JfrStackTraceRepository::lookup_trace(const JfrStackTrace& stacktrace) const {
+  GlobalCounter::CriticalSection cs(Thread::current());
+  const JfrStackTraceTable* const current = table();
+  const JfrStackTrace* table_entry = current->bucket(current->index_for(stacktrace._hash));
+  while (table_entry != NULL) {
+    if (table_entry->equals(stacktrace)) {
+      return table_entry->id();
+    }
+    table_entry = table_entry->next();
+  }
+  return 0;
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  // Most recorded stack traces are already in the table.
+  traceid id = lookup_trace(stacktrace);
+  if (id != 0) {
+    return id;
+  }
+
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+  JfrStackTraceTable* const current = table();
+  const size_t index = current->index_for(stacktrace._hash);
+  const JfrStackTrace* table_entry = current->bucket(index);
 
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
@@ -189,16 +312,19 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  id = ++_next_id;
+  current->set_bucket(index, new JfrStackTrace(id, stacktrace, current->bucket(index)));
   ++_entries;
+  if (_entries > 2 * current->size() && current->size() < MAX_TABLE_SIZE) {
+    grow_table();
+  }
   return id;
 }
 
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup(unsigned int hash, traceid id) const {
-  const size_t index = (hash % TABLE_SIZE);
-  const JfrStackTrace* trace = _table[index];
+  const JfrStackTraceTable* const current = table();
+  const JfrStackTrace* trace = current->bucket(current->index_for(hash));
   while (trace != NULL && trace->id() != id) {
     trace = trace->next();
   }
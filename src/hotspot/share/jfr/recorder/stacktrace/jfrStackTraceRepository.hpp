@@ -32,7 +32,16 @@
 class JavaThread;
 class JfrCheckpointWriter;
 class JfrChunkWriter;
+class JfrStackTraceTable;
 
+//
+// Interns the recorded stack traces and assigns them trace ids.
+//
+// Stack traces are looked up without taking JfrStacktrace_lock, in a
+// GlobalCounter critical section. Only adding a new stack trace takes the lock.
+// The bucket array grows with the number of entries. A grown or cleared table
+// is retired and reclaimed by the next clear, after GlobalCounter::write_synchronize().
+//
 class JfrStackTraceRepository : public JfrCHeapObj {
   friend class JfrRecorder;
   friend class JfrRecorderService;
@@ -43,12 +52,15 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   friend class StackTraceRepository;
 
  private:
-  static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
+  static const size_t INITIAL_TABLE_SIZE = 2053;
+  static const size_t MAX_TABLE_SIZE = INITIAL_TABLE_SIZE << 7;
+  JfrStackTraceTable* volatile _table;
+  JfrStackTraceTable* _retired_tables;
   traceid _next_id;
   u4 _entries;
 
   JfrStackTraceRepository();
+  ~JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
   static JfrStackTraceRepository* create();
   static void destroy();
@@ -60,6 +72,10 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
   const JfrStackTrace* lookup(unsigned int hash, traceid id) const;
 
+  JfrStackTraceTable* table() const;
+  traceid lookup_trace(const JfrStackTrace& stacktrace) const;
+  void grow_table();
+  JfrStackTraceTable* detach_table();
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
   traceid record_for(JavaThread* thread, int skip, JfrStackFrame* frames, u4 max_frames);
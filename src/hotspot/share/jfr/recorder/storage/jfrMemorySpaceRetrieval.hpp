@@ -25,7 +25,10 @@
 #ifndef SHARE_JFR_RECORDER_STORAGE_JFRMEMORYSPACERETRIEVAL_HPP
 #define SHARE_JFR_RECORDER_STORAGE_JFRMEMORYSPACERETRIEVAL_HPP
 
+#include "jfr/support/jfrThreadLocal.hpp"
 #include "jfr/utilities/jfrIterator.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 /* Some policy classes for getting mspace memory. */
 
@@ -38,23 +41,65 @@ class JfrMspaceRetrieval {
       StopOnNullCondition<typename Mspace::FreeList> iterator(mspace->free_list());
       return acquire(mspace, iterator, thread, size);
     }
-    StopOnNullCondition<typename Mspace::LiveList> iterator(mspace->live_list(previous_epoch));
-    return acquire(mspace, iterator, thread, size);
+    return acquire_live(mspace, mspace->live_list(previous_epoch), thread, size);
   }
  private:
+  static const size_t max_probe_offset = 16;
+
   template <typename Iterator>
   static Node* acquire(Mspace* mspace, Iterator& iterator, Thread* thread, size_t size) {
     assert(mspace != NULL, "invariant");
     while (iterator.has_next()) {
       Node* const node = iterator.next();
-      if (node->retired()) continue;
-      if (node->try_acquire(thread)) {
-        assert(!node->retired(), "invariant");
-        if (node->free_size() >= size) {
-          return node;
-        }
-        node->set_retired();
-        mspace->register_full(node, thread);
+      Node* const acquired = try_acquire(mspace, node, thread, size);
+      if (acquired != NULL) {
+        return acquired;
+      }
+    }
+    return NULL;
+  }
+
+  static Node* try_acquire(Mspace* mspace, Node* node, Thread* thread, size_t size) {
+    if (node->retired()) return NULL;
+    if (node->try_acquire(thread)) {
+      assert(!node->retired(), "invariant");
+      if (node->free_size() >= size) {
+        return node;
+      }
+      node->set_retired();
+      mspace->register_full(node, thread);
+    }
+    return NULL;
+  }
+
+  // Threads start probing the live list at different positions, so that
+  // concurrent acquisitions, e.g. promotions of full thread local buffers,
+  // spread over the available nodes instead of all contending on the head.
+  // The position comes from the sequentially assigned JFR thread id, which
+  // unlike the Thread address is not aligned alike for all threads.
+  // The nodes in front of the start position are probed last.
+  template <typename List>
+  static Node* acquire_live(Mspace* mspace, List& list, Thread* thread, size_t size) {
+    assert(mspace != NULL, "invariant");
+    assert(thread != NULL, "invariant");
+    Node* const head = list.head();
+    Node* start = head;
+    for (size_t i = (size_t)(thread->jfr_thread_local()->thread_id() % max_probe_offset); i > 0 && start != NULL; --i) {
+      start = (Node*)start->_next;
+    }
+    if (start == NULL) {
+      start = head;
+    }
+    for (Node* node = start; node != NULL; node = (Node*)node->_next) {
+      Node* const acquired = try_acquire(mspace, node, thread, size);
+      if (acquired != NULL) {
+        return acquired;
+      }
+    }
+    for (Node* node = head; node != NULL && node != start; node = (Node*)node->_next) {
+      Node* const acquired = try_acquire(mspace, node, thread, size);
+      if (acquired != NULL) {
+        return acquired;
       }
     }
     return NULL;
@@ -0,0 +1,151 @@
+/*
+* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeMemorySampler.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.inline.hpp"
+#include "services/nmtCommon.hpp"
+
+#include <math.h>
+
+static size_t next_sample_interval() {
+  // u is uniform in (0, 1), -log(u) is exponentially distributed with mean 1.
+  const double u = ((double)os::random() + 1.0) / ((double)max_jint + 2.0);
+  const double interval = -log(u) * (double)NativeAllocationSampleInterval;
+  return interval < 1.0 ? 1 : (size_t)interval;
+}
+
+// The sample is only recorded here. Committing it takes the stack trace
+// repository lock and walks the stack, which is not safe from an arbitrary
+// malloc site: the thread may hold locks of any rank, be in the middle of
+// deoptimization or run at a safepoint. A JavaThread in the VM is known to
+// have released its locks and to have a walkable stack when it leaves the
+// VM again, and its Java frames are then still those of the allocation.
+// Compiler threads and the VMThread have no Java frames to walk, their
+// samples are committed when the compilation or VM operation is done.
+static bool can_record(Thread* thread) {
+  if (thread->is_VM_thread()) {
+    return true;
+  }
+  if (!thread->is_Java_thread()) {
+    return false;
+  }
+  JavaThread* const jt = thread->as_Java_thread();
+  if (jt->is_Compiler_thread()) {
+    return true;
+  }
+  return !SafepointSynchronize::is_at_safepoint() &&
+         jt->thread_state() == _thread_in_vm && !jt->in_deopt_handler();
+}
+
+// Identifies the VM entry of a JavaThread by its last Java frame. A nested
+// entry, VM -> Java -> VM, has a deeper last Java frame than the outer one.
+static const void* vm_entry_of(Thread* thread) {
+  return thread->is_Java_thread() ? (const void*)thread->as_Java_thread()->last_Java_sp() : NULL;
+}
+
+void JfrNativeMemorySampler::sample(void* ptr, size_t size, MEMFLAGS flags) {
+  if (ptr == NULL || flags == mtTracing) {
+    // Allocations made by JFR itself, e.g. while committing this event, are not sampled.
+    return;
+  }
+  Thread* const thread = Thread::current_or_null();
+  if (thread == NULL) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (tl->is_dead() || tl->is_excluded()) {
+    return;
+  }
+  const size_t allocated = tl->native_bytes_since_sample() + size;
+  size_t until_sample = tl->native_bytes_until_sample();
+  if (until_sample == 0) {
+    until_sample = next_sample_interval();
+  }
+  if (size < until_sample) {
+    tl->set_native_bytes_since_sample(allocated);
+    tl->set_native_bytes_until_sample(until_sample - size);
+    return;
+  }
+  tl->set_native_bytes_since_sample(0);
+  tl->set_native_bytes_until_sample(next_sample_interval());
+  if (!can_record(thread)) {
+    return;
+  }
+  if (tl->has_native_memory_sample()) {
+    // Fold this weight into the pending sample, taken earlier in the same
+    // VM entry, compilation or VM operation.
+    tl->add_native_sample_weight(allocated);
+    return;
+  }
+  tl->set_native_memory_sample(NMTUtil::flag_to_name(flags), ptr, size, allocated, vm_entry_of(thread));
+}
+
+void JfrNativeMemorySampler::on_leaving_vm(JavaThread* jt) {
+  assert(jt->jfr_thread_local()->has_native_memory_sample(), "invariant");
+  if (jt->is_Compiler_thread()) {
+    // Committed at the end of the compilation.
+    return;
+  }
+  if (jt->jfr_thread_local()->native_sample_vm_entry() != vm_entry_of(jt)) {
+    // Taken in an outer VM entry, which is still active.
+    return;
+  }
+  commit(jt);
+}
+
+void JfrNativeMemorySampler::on_compilation_end(JavaThread* jt) {
+  assert(jt->is_Compiler_thread(), "invariant");
+  if (jt->jfr_thread_local()->has_native_memory_sample()) {
+    commit(jt);
+  }
+}
+
+void JfrNativeMemorySampler::on_vm_operation_end(Thread* thread) {
+  assert(thread->is_VM_thread(), "invariant");
+  if (thread->jfr_thread_local()->has_native_memory_sample()) {
+    commit(thread);
+  }
+}
+
+void JfrNativeMemorySampler::commit(Thread* thread) {
+  assert(thread == Thread::current(), "invariant");
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  assert(tl->has_native_memory_sample(), "invariant");
+  // Clear the sample before committing, the commit may allocate.
+  const char* const type = tl->native_sample_type();
+  tl->clear_native_memory_sample();
+  EventNativeMemoryAllocationSample event;
+  if (event.should_commit()) {
+    event.set_type(type);
+    event.set_address((u8)p2i(tl->native_sample_address()));
+    event.set_allocationSize(tl->native_sample_size());
+    event.set_weight(tl->native_sample_weight());
+    event.commit();
+  }
+}
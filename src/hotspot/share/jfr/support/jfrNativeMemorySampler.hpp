@@ -0,0 +1,69 @@
+/*
+* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEMEMORYSAMPLER_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEMEMORYSAMPLER_HPP
+
+#include "jfrfiles/jfrEventClasses.hpp"
+#include "memory/allocation.hpp"
+
+//
+// Byte-sampled NativeMemoryAllocationSample events for allocations made
+// through os::malloc and os::realloc. Each thread draws exponentially
+// distributed distances between samples, with a mean of
+// NativeAllocationSampleInterval bytes, so the sampled allocations are
+// a Poisson process over the allocated bytes and the sample weights give
+// an unbiased estimate of where the native memory goes.
+//
+// Allocations are sampled in JavaThreads that are in the VM, in compiler
+// threads and in the VMThread. The sample is kept in the thread local and
+// committed later, where the thread holds no locks:
+//  - a JavaThread commits it, with the Java stack trace, when it leaves the
+//    VM entry that was current at the allocation, by returning or by calling
+//    Java (COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL),
+//  - a compiler thread commits it at the end of the compilation,
+//  - the VMThread commits it after the VM operation.
+//
+class JfrNativeMemorySampler : AllStatic {
+ private:
+  static void sample(void* ptr, size_t size, MEMFLAGS flags);
+  static void commit(Thread* thread);
+ public:
+  static void on_allocation(void* ptr, size_t size, MEMFLAGS flags) {
+    if (EventNativeMemoryAllocationSample::is_enabled()) {
+      sample(ptr, size, flags);
+    }
+  }
+  // Only the bytes a reallocation grows the block by are counted.
+  static void on_reallocation(void* ptr, size_t old_size, size_t new_size, MEMFLAGS flags) {
+    if (new_size > old_size) {
+      on_allocation(ptr, new_size - old_size, flags);
+    }
+  }
+  static void on_leaving_vm(JavaThread* jt);
+  static void on_compilation_end(JavaThread* jt);
+  static void on_vm_operation_end(Thread* thread);
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEMEMORYSAMPLER_HPP
@@ -48,4 +48,7 @@
 
 #define SUSPEND_THREAD_CONDITIONAL(thread) if ((thread)->is_trace_suspend()) JfrThreadSampling::on_javathread_suspend(thread)
 
+#define COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL(thread) \
+  if ((thread)->jfr_thread_local()->has_native_memory_sample()) JfrThreadLocal::commit_native_memory_sample(thread)
+
 #endif // SHARE_JFR_SUPPORT_JFRTHREADEXTENSION_HPP
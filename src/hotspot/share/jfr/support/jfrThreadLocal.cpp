@@ -32,6 +32,7 @@
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
+#include "jfr/support/jfrNativeMemorySampler.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "memory/allocation.inline.hpp"
 #include "runtime/os.hpp"
@@ -53,6 +54,14 @@ JfrThreadLocal::JfrThreadLocal() :
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
+  _sampled_cpu_time(0),
+  _native_bytes_until_sample(0),
+  _native_bytes_since_sample(0),
+  _native_sample_type(NULL),
+  _native_sample_address(NULL),
+  _native_sample_size(0),
+  _native_sample_weight(0),
+  _native_sample_vm_entry(NULL),
   _stack_trace_hash(0),
   _stackdepth(0),
   _entering_suspend_flag(0),
@@ -215,6 +224,11 @@ void JfrThreadLocal::include(Thread* t) {
   t->jfr_thread_local()->release(t);
 }
 
+void JfrThreadLocal::commit_native_memory_sample(JavaThread* jt) {
+  assert(jt != NULL, "invariant");
+  JfrNativeMemorySampler::on_leaving_vm(jt);
+}
+
 u4 JfrThreadLocal::stackdepth() const {
   return _stackdepth != 0 ? _stackdepth : (u4)JfrOptionSet::stackdepth();
 }
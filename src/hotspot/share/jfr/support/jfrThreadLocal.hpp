@@ -49,6 +49,14 @@ class JfrThreadLocal {
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  jlong _sampled_cpu_time;
+  size_t _native_bytes_until_sample;
+  size_t _native_bytes_since_sample;
+  const char* _native_sample_type;
+  void* _native_sample_address;
+  size_t _native_sample_size;
+  size_t _native_sample_weight;
+  const void* _native_sample_vm_entry;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
@@ -191,6 +199,72 @@ class JfrThreadLocal {
     _cpu_time = cpu_time;
   }
 
+  jlong get_sampled_cpu_time() const {
+    return _sampled_cpu_time;
+  }
+
+  void set_sampled_cpu_time(jlong cpu_time) {
+    _sampled_cpu_time = cpu_time;
+  }
+
+  size_t native_bytes_until_sample() const {
+    return _native_bytes_until_sample;
+  }
+
+  void set_native_bytes_until_sample(size_t bytes) {
+    _native_bytes_until_sample = bytes;
+  }
+
+  size_t native_bytes_since_sample() const {
+    return _native_bytes_since_sample;
+  }
+
+  void set_native_bytes_since_sample(size_t bytes) {
+    _native_bytes_since_sample = bytes;
+  }
+
+  // A native allocation sample taken inside the VM, committed when the
+  // thread leaves the VM. See JfrNativeMemorySampler.
+  bool has_native_memory_sample() const {
+    return _native_sample_type != NULL;
+  }
+
+  const char* native_sample_type() const {
+    return _native_sample_type;
+  }
+
+  void* native_sample_address() const {
+    return _native_sample_address;
+  }
+
+  size_t native_sample_size() const {
+    return _native_sample_size;
+  }
+
+  size_t native_sample_weight() const {
+    return _native_sample_weight;
+  }
+
+  const void* native_sample_vm_entry() const {
+    return _native_sample_vm_entry;
+  }
+
+  void set_native_memory_sample(const char* type, void* address, size_t size, size_t weight, const void* vm_entry) {
+    _native_sample_type = type;
+    _native_sample_address = address;
+    _native_sample_size = size;
+    _native_sample_weight = weight;
+    _native_sample_vm_entry = vm_entry;
+  }
+
+  void add_native_sample_weight(size_t weight) {
+    _native_sample_weight += weight;
+  }
+
+  void clear_native_memory_sample() {
+    _native_sample_type = NULL;
+  }
+
   jlong get_wallclock_time() const {
     return _wallclock_time;
   }
@@ -229,6 +303,8 @@ class JfrThreadLocal {
   static void on_start(Thread* t);
   static void on_exit(Thread* t);
 
+  static void commit_native_memory_sample(JavaThread* jt);
+
   // Code generation
   static ByteSize trace_id_offset();
   static ByteSize java_event_writer_offset();
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileOutput.hpp"
+#include "logging/logHandle.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+
+AsyncLogWriter* AsyncLogWriter::_instance = NULL;
+
+class AsyncLogLocker : public StackObj {
+  os::PlatformMonitor* const _lock;
+ public:
+  AsyncLogLocker(os::PlatformMonitor* lock) : _lock(lock) { _lock->lock(); }
+  ~AsyncLogLocker() { _lock->unlock(); }
+};
+
+AsyncLogMessage::~AsyncLogMessage() {
+  os::free(_message);
+}
+
+void AsyncLogMessage::writeback() {
+  assert(!is_flush_token(), "a flush token has nothing to write");
+  _output->write_blocking(_decorations, _message);
+}
+
+size_t AsyncLogMessage::size() const {
+  return sizeof(AsyncLogMessage) + (_message == NULL ? 0 : strlen(_message) + 1);
+}
+
+AsyncLogWriter::AsyncLogWriter() :
+  _flush_sem(0),
+  _initialized(false),
+  _data_available(false),
+  _buffer_bytes(0),
+  _buffer(new AsyncLogBuffer(64)),
+  _spare(new AsyncLogBuffer(64)),
+  _stats() {
+  if (os::create_thread(this, os::os_thread)) {
+    _initialized = true;
+  } else {
+    log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
+  }
+}
+
+void AsyncLogWriter::enqueue_locked(AsyncLogMessage* msg) {
+  size_t size = msg->size();
+  if (_buffer_bytes + size > AsyncLogBufferSize) {
+    bool created;
+    uint32_t* counter = _stats.put_if_absent(msg->output(), 0, &created);
+    *counter += 1;
+    delete msg;
+    return;
+  }
+
+  _buffer_bytes += size;
+  _buffer->append(msg);
+  _data_available = true;
+  _lock.notify();
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  AsyncLogMessage* m = new AsyncLogMessage(&output, decorations, os::strdup_check_oom(msg, mtLogging));
+  AsyncLogLocker locker(&_lock);
+  enqueue_locked(m);
+}
+
+// LogMessageBuffer consists of a multiple-part/multiple-line message.
+// The lock here guarantees its integrity.
+void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator) {
+  AsyncLogLocker locker(&_lock);
+
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    AsyncLogMessage* m = new AsyncLogMessage(&output, msg_iterator.decorations(),
+                                             os::strdup_check_oom(msg_iterator.message(), mtLogging));
+    enqueue_locked(m);
+  }
+}
+
+class AsyncLogDroppedCollector : public StackObj {
+  GrowableArray<LogFileOutput*>* _outputs;
+  GrowableArray<uint32_t>*       _counts;
+ public:
+  AsyncLogDroppedCollector(GrowableArray<LogFileOutput*>* outputs, GrowableArray<uint32_t>* counts) :
+    _outputs(outputs), _counts(counts) { }
+
+  bool do_entry(LogFileOutput* const& output, const uint32_t& count) {
+    _outputs->append(output);
+    _counts->append(count);
+    return true;
+  }
+};
+
+void AsyncLogWriter::write() {
+  ResourceMark rm;
+  GrowableArray<LogFileOutput*> dropped_outputs;
+  GrowableArray<uint32_t> dropped_counts;
+
+  // Take the buffered messages and the dropped counts with the lock held,
+  // but write them without it, so logging threads are never blocked by I/O.
+  {
+    AsyncLogLocker locker(&_lock);
+    AsyncLogBuffer* tmp = _buffer;
+    _buffer = _spare;
+    _spare = tmp;
+    _buffer_bytes = 0;
+    _data_available = false;
+
+    AsyncLogDroppedCollector collector(&dropped_outputs, &dropped_counts);
+    _stats.iterate(&collector);
+    for (int i = 0; i < dropped_outputs.length(); i++) {
+      _stats.remove(dropped_outputs.at(i));
+    }
+  }
+
+  uint flush_requests = 0;
+  for (int i = 0; i < _spare->length(); i++) {
+    AsyncLogMessage* msg = _spare->at(i);
+    if (msg->is_flush_token()) {
+      flush_requests++;
+    } else {
+      msg->writeback();
+    }
+    delete msg;
+  }
+  _spare->clear();
+
+  for (int i = 0; i < dropped_outputs.length(); i++) {
+    LogFileOutput* output = dropped_outputs.at(i);
+    char buf[64];
+    jio_snprintf(buf, sizeof(buf), UINT32_FORMAT " messages dropped due to async logging", dropped_counts.at(i));
+    LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LogTag::_logging>::tagset(),
+                               output->decorators());
+    output->write_blocking(decorations, buf);
+  }
+
+  if (flush_requests > 0) {
+    _flush_sem.signal(flush_requests);
+  }
+}
+
+void AsyncLogWriter::run() {
+  while (true) {
+    {
+      AsyncLogLocker locker(&_lock);
+      while (!_data_available) {
+        _lock.wait(0 /* no timeout */);
+      }
+    }
+
+    write();
+  }
+}
+
+AsyncLogWriter* AsyncLogWriter::instance() {
+  return Atomic::load_acquire(&_instance);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!LogConfiguration::is_async_mode()) {
+    return;
+  }
+
+  assert(_instance == NULL, "initialize() should only be invoked once");
+  AsyncLogWriter* self = new AsyncLogWriter();
+  if (self->_initialized) {
+    Atomic::release_store_fence(&_instance, self);
+    os::start_thread(self);
+    log_debug(logging, thread)("Async logging thread started");
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = instance();
+  if (writer != NULL) {
+    assert(Thread::current_or_null() != writer, "the writer thread must not wait for itself");
+    LogDecorations none(LogLevel::Off, LogTagSetMapping<LogTag::_logging>::tagset(), LogDecorators::None);
+    AsyncLogMessage* token = new AsyncLogMessage(NULL, none, NULL);
+    {
+      // The token bypasses the buffer limit, since it must not be dropped.
+      AsyncLogLocker locker(&writer->_lock);
+      writer->_buffer->append(token);
+      writer->_data_available = true;
+      writer->_lock.notify();
+    }
+
+    writer->_flush_sem.wait();
+  }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+
+class LogFileOutput;
+
+// A log message waiting to be written by the AsyncLogWriter. The decorations
+// are captured when the message is logged, so the timestamps and the thread
+// decorations describe the logging event and not the write.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+  LogFileOutput* const _output;     // NULL for a flush token
+  const LogDecorations _decorations;
+  char* const          _message;
+
+ public:
+  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, char* msg) :
+    _output(output), _decorations(decorations), _message(msg) { }
+
+  ~AsyncLogMessage();
+
+  LogFileOutput* output() const { return _output; }
+  bool is_flush_token() const   { return _output == NULL; }
+
+  // Writes the message to its output.
+  void writeback();
+
+  // Bytes accounted against AsyncLogBufferSize.
+  size_t size() const;
+};
+
+typedef GrowableArrayCHeap<AsyncLogMessage*, mtLogging> AsyncLogBuffer;
+typedef ResourceHashtable<LogFileOutput*, uint32_t,
+                          primitive_hash<LogFileOutput*>,
+                          primitive_equals<LogFileOutput*>,
+                          17, ResourceObj::C_HEAP, mtLogging> AsyncLogMap;
+
+// Asynchronous Logging (-Xlog:async)
+//
+// With async logging, a log call on a file output only copies the message and
+// its decorations into a buffer. The "AsyncLog Thread" writes the buffered
+// messages to the files, so disk latency no longer stalls the logging thread,
+// e.g. a GC worker or the VM thread at a safepoint. The buffer is bounded by
+// AsyncLogBufferSize. If it is full, new messages are dropped and the number
+// of dropped messages is reported to the affected output.
+//
+// Only file outputs are asynchronous, stdout and stderr are written directly.
+// Messages still in the buffer when the VM crashes are lost.
+class AsyncLogWriter : public NonJavaThread {
+  static AsyncLogWriter* _instance;
+
+  // _lock protects _buffer, _buffer_bytes, _data_available and _stats.
+  // It is a native monitor, since logging can happen with any VM lock held.
+  os::PlatformMonitor _lock;
+  // Signaled by the writer thread when it has handled a flush token.
+  Semaphore           _flush_sem;
+  volatile bool       _initialized;
+  bool                _data_available;
+  size_t              _buffer_bytes;
+  AsyncLogBuffer*     _buffer;
+  AsyncLogBuffer*     _spare;      // only used by the writer thread
+  AsyncLogMap         _stats;      // dropped message counts per output
+
+  AsyncLogWriter();
+  ~AsyncLogWriter() { ShouldNotReachHere(); }
+
+  void enqueue_locked(AsyncLogMessage* msg);
+  void write();
+
+  virtual void run();
+
+ public:
+  char* name() const { return (char*)"AsyncLog Thread"; }
+
+  void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+  void enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator);
+
+  // Returns the writer if async logging is active, or NULL.
+  static AsyncLogWriter* instance();
+  // Starts the writer thread if -Xlog:async has been given.
+  static void initialize();
+  // Blocks until the messages buffered so far have been written.
+  static void flush();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -48,6 +48,9 @@ class LogDecorations {
  public:
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
 
+  // Copies the decorations, e.g. to write them later on another thread.
+  LogDecorations(const LogDecorations& other);
+
   void set_level(LogLevelType level) {
     _level = level;
   }
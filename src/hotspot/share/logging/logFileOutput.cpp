@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
 #include "memory/allocation.inline.hpp"
@@ -109,15 +110,6 @@ static bool is_regular_file(const char* filename) {
   return (st.st_mode & S_IFMT) == S_IFREG;
 }
 
-static bool is_fifo_file(const char* filename) {
-  struct stat st;
-  int ret = os::stat(filename, &st);
-  if (ret != 0) {
-    return false;
-  }
-  return S_ISFIFO(st.st_mode);
-}
-
 // Try to find the next number that should be used for file rotation.
 // Return UINT_MAX on error.
 static uint next_file_number(const char* filename,
@@ -233,7 +225,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
   }
 
   bool file_exist = file_exists(_file_name);
-  if (file_exist && _is_default_file_count && is_fifo_file(_file_name)) {
+  if (file_exist && _is_default_file_count && os::is_fifo_file(_file_name)) {
     _file_count = 0; // Prevent file rotation for fifo's such as named pipes.
   }
 
@@ -284,7 +276,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
   return true;
 }
 
-int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
@@ -302,12 +294,28 @@ int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
   return written;
 }
 
+int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+  AsyncLogWriter* aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(*this, decorations, msg);
+    return 0;
+  }
+
+  return write_blocking(decorations, msg);
+}
+
 int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
+  AsyncLogWriter* aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(*this, msg_iterator);
+    return 0;
+  }
+
   _rotation_semaphore.wait();
   int written = LogFileStreamOutput::write(msg_iterator);
   _current_size += written;
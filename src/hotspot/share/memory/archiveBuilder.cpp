@@ -25,6 +25,8 @@
 #include "precompiled.hpp"
 #include "classfile/classLoaderDataShared.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
@@ -35,9 +37,11 @@
 #include "memory/memRegion.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/oopHandle.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/hashtable.inline.hpp"
@@ -451,15 +455,111 @@ void ArchiveBuilder::dump_ro_region() {
   make_shallow_copies(_ro_region, &_ro_src_objs);
 }
 
+// Processes the objects of a SourceObjList in chunks, using the safepoint
+// workers of the heap if it has any. The work done for one object must not
+// depend on the other objects, so that the archive is the same regardless of
+// the number of threads.
+class ArchiveBuilder::SourceObjsTask : public AbstractGangTask {
+  static const int ChunkSize = 256;
+  const int _num_objs;
+  volatile int _claimed;
+
+protected:
+  const SourceObjList* _src_objs;
+
+  virtual void do_obj(int i) = 0;
+
+public:
+  SourceObjsTask(const char* name, const SourceObjList* src_objs) :
+    AbstractGangTask(name),
+    _num_objs(src_objs->objs()->length()),
+    _claimed(0),
+    _src_objs(src_objs) {}
+
+  void work(uint worker_id) {
+    for (;;) {
+      int start = Atomic::fetch_and_add(&_claimed, ChunkSize);
+      if (start >= _num_objs) {
+        return;
+      }
+      int end = MIN2(start + ChunkSize, _num_objs);
+      for (int i = start; i < end; i++) {
+        do_obj(i);
+      }
+    }
+  }
+
+  void run() {
+    WorkGang* workers = Universe::heap()->safepoint_workers();
+    if (workers != NULL && _num_objs > ChunkSize) {
+      workers->run_task(this);
+    } else {
+      work(0);
+    }
+  }
+};
+
+class ArchiveBuilder::ShallowCopyTask : public SourceObjsTask {
+  intptr_t** _archived_vtables;
+
+  void do_obj(int i) {
+    SourceObjInfo* src_info = _src_objs->at(i);
+    address src = src_info->obj();
+    address dest = src_info->dumped_addr();
+    memcpy(dest, src, src_info->size_in_bytes());
+
+    intptr_t* archived_vtable = _archived_vtables[i];
+    if (archived_vtable != NULL) {
+      *(address*)dest = (address)archived_vtable;
+      ArchivePtrMarker::mark_pointer((address*)dest);
+    }
+
+    log_trace(cds)("Copy: " PTR_FORMAT " ==> " PTR_FORMAT " %d", p2i(src), p2i(dest), src_info->size_in_bytes());
+  }
+
+public:
+  ShallowCopyTask(const SourceObjList* src_objs, intptr_t** archived_vtables) :
+    SourceObjsTask("CDS Shallow Copy", src_objs),
+    _archived_vtables(archived_vtables) {}
+};
+
+class ArchiveBuilder::RelocateEmbeddedPointersTask : public SourceObjsTask {
+  ArchiveBuilder* _builder;
+
+  void do_obj(int i) {
+    // relocate() only reads the source object table and the ptrmap of the
+    // list, and writes to the copy of the i-th object.
+    const_cast<SourceObjList*>(_src_objs)->relocate(i, _builder);
+  }
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, const SourceObjList* src_objs) :
+    SourceObjsTask("CDS Relocate Embedded Pointers", src_objs),
+    _builder(builder) {}
+};
+
 void ArchiveBuilder::make_shallow_copies(DumpRegion *dump_region,
                                          const ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    make_shallow_copy(dump_region, src_objs->objs()->at(i));
+  int num_objs = src_objs->objs()->length();
+
+  // Lay out all the copies in order first. Only the copying itself is done
+  // in parallel, so the layout does not depend on the number of threads.
+  intptr_t** archived_vtables = NEW_C_HEAP_ARRAY(intptr_t*, num_objs, mtClassShared);
+  for (int i = 0; i < num_objs; i++) {
+    archived_vtables[i] = allocate_shallow_copy(dump_region, src_objs->objs()->at(i));
   }
-  log_info(cds)("done (%d objects)", src_objs->objs()->length());
+
+  ArchivePtrMarker::ensure_capacity((address*)dump_region->top());
+  ShallowCopyTask task(src_objs, archived_vtables);
+  task.run();
+  FREE_C_HEAP_ARRAY(intptr_t*, archived_vtables);
+
+  log_info(cds)("done (%d objects)", num_objs);
 }
 
-void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info) {
+// Allocates the space for the copy of the object, and returns the archived
+// C++ vtable to install in the copy, if any.
+intptr_t* ArchiveBuilder::allocate_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info) {
   MetaspaceClosure::Ref* ref = src_info->ref();
   address src = ref->obj();
   int bytes = src_info->size_in_bytes();
@@ -482,18 +582,12 @@ void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* s
   dest = dump_region->allocate(bytes);
   newtop = dump_region->top();
 
-  memcpy(dest, src, bytes);
-
-  intptr_t* archived_vtable = CppVtables::get_archived_vtable(ref->msotype(), (address)dest);
-  if (archived_vtable != NULL) {
-    *(address*)dest = (address)archived_vtable;
-    ArchivePtrMarker::mark_pointer((address*)dest);
-  }
-
-  log_trace(cds)("Copy: " PTR_FORMAT " ==> " PTR_FORMAT " %d", p2i(src), p2i(dest), bytes);
   src_info->set_dumped_addr((address)dest);
 
   _alloc_stats->record(ref->msotype(), int(newtop - oldtop), src_info->read_only());
+
+  // The copy has the same C++ vtable as the source object.
+  return CppVtables::get_archived_vtable(ref->msotype(), src);
 }
 
 address ArchiveBuilder::get_dumped_addr(address src_obj) const {
@@ -504,9 +598,9 @@ address ArchiveBuilder::get_dumped_addr(address src_obj) const {
 }
 
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
-  }
+  ArchivePtrMarker::ensure_capacity((address*)MAX2(_rw_region->top(), _ro_region->top()));
+  RelocateEmbeddedPointersTask task(this, src_objs);
+  task.run();
 }
 
 void ArchiveBuilder::update_special_refs() {
@@ -139,6 +139,9 @@ private:
   };
 
   class CDSMapLogger;
+  class SourceObjsTask;
+  class ShallowCopyTask;
+  class RelocateEmbeddedPointersTask;
 
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
@@ -186,7 +189,7 @@ private:
   static int compare_klass_by_name(Klass** a, Klass** b);
 
   void make_shallow_copies(DumpRegion *dump_region, const SourceObjList* src_objs);
-  void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
+  intptr_t* allocate_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
 
   void update_special_refs();
   void relocate_embedded_pointers(SourceObjList* src_objs);
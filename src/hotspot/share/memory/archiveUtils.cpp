@@ -79,12 +79,27 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
         _ptrmap->resize((idx + 1) * 2);
       }
       assert(idx < _ptrmap->size(), "must be");
-      _ptrmap->set_bit(idx);
+      // Pointers may be marked in parallel, see ensure_capacity().
+      _ptrmap->par_set_bit(idx);
       //tty->print_cr("Marking pointer [" PTR_FORMAT "] -> " PTR_FORMAT " @ " SIZE_FORMAT_W(5), p2i(ptr_loc), p2i(*ptr_loc), idx);
     }
   }
 }
 
+void ArchivePtrMarker::ensure_capacity(address* ptr_end) {
+  assert(_ptrmap != NULL, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  if (ptr_end > _ptr_end) {
+    ptr_end = _ptr_end;
+  }
+  if (ptr_end > _ptr_base) {
+    size_t size = ptr_end - _ptr_base;
+    if (_ptrmap->size() < size) {
+      _ptrmap->resize(size);
+    }
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != NULL, "not initialized");
   assert(!_compacted, "cannot clear anymore");
@@ -69,6 +69,10 @@ public:
     _ptr_end = new_ptr_end;
   }
 
+  // Resize the bitmap up front so that the pointers below ptr_end can be
+  // marked by multiple threads concurrently.
+  static void ensure_capacity(address* ptr_end);
+
   static CHeapBitMap* ptrmap() {
     return _ptrmap;
   }
@@ -142,6 +146,11 @@ class SharedDataRelocator: public BitMapClosure {
   }
 
   inline bool do_bit(size_t offset);
+
+  // Patch all the pointers marked in the bitmap words [map, map + size_in_bits).
+  // This is used at run time instead of BitMap::iterate(), and walks the bitmap
+  // a word at a time without a virtual call for each pointer.
+  inline void patch_all(const BitMap::bm_word_t* map, size_t size_in_bits);
 };
 
 class DumpRegion {
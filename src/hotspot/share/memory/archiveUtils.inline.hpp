@@ -26,7 +26,9 @@
 #define SHARE_MEMORY_ARCHIVEUTILS_INLINE_HPP
 
 #include "memory/archiveUtils.hpp"
+#include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 
 template <bool COMPACTING>
 inline bool SharedDataRelocator<COMPACTING>::do_bit(size_t offset) {
@@ -65,4 +67,23 @@ inline bool SharedDataRelocator<COMPACTING>::do_bit(size_t offset) {
   return true; // keep iterating
 }
 
+template <bool COMPACTING>
+inline void SharedDataRelocator<COMPACTING>::patch_all(const BitMap::bm_word_t* map, size_t size_in_bits) {
+  STATIC_ASSERT(!COMPACTING);
+  size_t size_in_words = align_up(size_in_bits, BitsPerWord) / BitsPerWord;
+  for (size_t i = 0; i < size_in_words; i++) {
+    BitMap::bm_word_t w = map[i];
+    size_t base = i * BitsPerWord;
+    if (base + BitsPerWord > size_in_bits) {
+      // Ignore the bits past the end of the last, partial word.
+      w &= (BitMap::bm_word_t(1) << (size_in_bits - base)) - 1;
+    }
+    while (w != 0) {
+      // Qualified call, so that it is bound statically and can be inlined.
+      SharedDataRelocator<COMPACTING>::do_bit(base + count_trailing_zeros(w));
+      w &= w - 1; // clear the lowest set bit
+    }
+  }
+}
+
 #endif // SHARE_MEMORY_ARCHIVEUTILS_INLINE_HPP
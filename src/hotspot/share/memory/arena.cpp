@@ -27,6 +27,7 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadCritical.hpp"
@@ -44,7 +45,8 @@ class ChunkPool: public CHeapObj<mtInternal> {
   size_t       _num_used;     // number of chunks currently checked out
   const size_t _size;         // size of each chunk (must be uniform)
 
-  // Our four static pools
+  // Our five static pools
+  static ChunkPool* _big_pool;
   static ChunkPool* _large_pool;
   static ChunkPool* _medium_pool;
   static ChunkPool* _small_pool;
@@ -74,7 +76,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
       _num_used++;
       p = get_first();
     }
-    if (p == NULL) p = os::malloc(bytes, mtChunk, CURRENT_PC);
+    if (p == NULL) p = os::malloc(bytes, mtChunk, MALLOC_CURRENT_PC);
     if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "ChunkPool::allocate");
     }
@@ -124,12 +126,14 @@ class ChunkPool: public CHeapObj<mtInternal> {
   }
 
   // Accessors to preallocated pool's
+  static ChunkPool* big_pool()    { assert(_big_pool    != NULL, "must be initialized"); return _big_pool;    }
   static ChunkPool* large_pool()  { assert(_large_pool  != NULL, "must be initialized"); return _large_pool;  }
   static ChunkPool* medium_pool() { assert(_medium_pool != NULL, "must be initialized"); return _medium_pool; }
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
   static void initialize() {
+    _big_pool    = new ChunkPool(Chunk::big_size    + Chunk::aligned_overhead_size());
     _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
     _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
     _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
@@ -142,9 +146,11 @@ class ChunkPool: public CHeapObj<mtInternal> {
      _small_pool->free_all_but(BlocksToKeep);
      _medium_pool->free_all_but(BlocksToKeep);
      _large_pool->free_all_but(BlocksToKeep);
+     _big_pool->free_all_but(BlocksToKeep);
   }
 };
 
+ChunkPool* ChunkPool::_big_pool    = NULL;
 ChunkPool* ChunkPool::_large_pool  = NULL;
 ChunkPool* ChunkPool::_medium_pool = NULL;
 ChunkPool* ChunkPool::_small_pool  = NULL;
@@ -185,12 +191,13 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
   switch (length) {
+   case Chunk::big_size:    return ChunkPool::big_pool()->allocate(bytes, alloc_failmode);
    case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
    default: {
-     void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+     void* p = os::malloc(bytes, mtChunk, MALLOC_CALLER_PC);
      if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
        vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
      }
@@ -202,6 +209,7 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
   switch (c->length()) {
+   case Chunk::big_size:    ChunkPool::big_pool()->free(c); break;
    case Chunk::size:        ChunkPool::large_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
@@ -242,6 +250,52 @@ void Chunk::start_chunk_pool_cleaner_task() {
   cleaner->enroll();
 }
 
+bool Chunk::trim_native_heap() {
+  // Free the pooled chunks first so that the C heap can give their memory back.
+  ChunkPool::clean();
+  return os::trim_native_heap();
+}
+
+//--------------------------------------------------------------------------------------
+// NativeHeapTrimmer implementation
+//
+
+// PeriodicTask intervals are limited to a few seconds, so tick once a
+// second and request a trim when TrimNativeHeapInterval seconds have passed.
+// malloc_trim can take long on large heaps, so the trim itself is done by
+// the ServiceThread rather than delaying the other tasks of the WatcherThread.
+class NativeHeapTrimmer : public PeriodicTask {
+  enum { TickInterval = 1000 };          // tick interval in ms
+
+  uintx _seconds;
+
+ public:
+   NativeHeapTrimmer() : PeriodicTask(TickInterval), _seconds(0) {}
+   void task() {
+     if (++_seconds >= TrimNativeHeapInterval) {
+       _seconds = 0;
+       MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+       Chunk::_native_heap_trim_requested = true;
+       Service_lock->notify_all();
+     }
+   }
+};
+
+bool Chunk::_native_heap_trim_requested = false;
+
+bool Chunk::has_native_heap_trim_request_and_reset() {
+  assert_lock_strong(Service_lock);
+  bool requested = _native_heap_trim_requested;
+  _native_heap_trim_requested = false;
+  return requested;
+}
+
+void Chunk::start_native_heap_trimmer_task() {
+  assert(TrimNativeHeapInterval > 0, "trimming is disabled");
+  NativeHeapTrimmer* trimmer = new NativeHeapTrimmer();
+  trimmer->enroll();
+}
+
 //------------------------------Arena------------------------------------------
 
 Arena::Arena(MEMFLAGS flag, size_t init_size) : _flags(flag), _size_in_bytes(0)  {
@@ -296,11 +350,11 @@ void* Arena::operator new (size_t size, const std::nothrow_t&  nothrow_constant)
 
   // dynamic memory type binding
 void* Arena::operator new(size_t size, MEMFLAGS flags) throw() {
-  return (void *) AllocateHeap(size, flags, CALLER_PC);
+  return (void *) AllocateHeap(size, flags, MALLOC_CALLER_PC);
 }
 
 void* Arena::operator new(size_t size, const std::nothrow_t& nothrow_constant, MEMFLAGS flags) throw() {
-  return (void*)AllocateHeap(size, flags, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+  return (void*)AllocateHeap(size, flags, MALLOC_CALLER_PC, AllocFailStrategy::RETURN_NULL);
 }
 
 void Arena::operator delete(void* p) {
@@ -349,6 +403,11 @@ void Arena::signal_out_of_memory(size_t sz, const char* whence) const {
 void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   size_t len = MAX2(x, (size_t) Chunk::size);
+  // Moderately large requests, e.g. the node and type arrays of big C2
+  // compilations, come from a pooled chunk rather than from os::malloc.
+  if (len > Chunk::size && len <= Chunk::big_size) {
+    len = Chunk::big_size;
+  }
 
   Chunk *k = _chunk;            // Get filled-up chunk address
   _chunk = new (alloc_failmode, len) Chunk(len);
@@ -44,10 +44,12 @@
 //------------------------------Chunk------------------------------------------
 // Linked list of raw memory chunks
 class Chunk: CHeapObj<mtChunk> {
+  friend class NativeHeapTrimmer;
 
  private:
   Chunk*       _next;     // Next Chunk in list
   const size_t _len;      // Size of this Chunk
+  static bool  _native_heap_trim_requested; // Set by NativeHeapTrimmer, reset by the ServiceThread
  public:
   void* operator new(size_t size, AllocFailType alloc_failmode, size_t length) throw();
   void  operator delete(void* p);
@@ -67,6 +69,7 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
+    big_size   = 128*K - slack, // Size of chunks for allocations that do not fit a default chunk
     non_pool_size = init_size + 32 // An initial size which is not one of above
   };
 
@@ -87,6 +90,17 @@ class Chunk: CHeapObj<mtChunk> {
   static void start_chunk_pool_cleaner_task();
 
   static void clean_chunk_pool();
+
+  // Start the task that asks the ServiceThread to trim the chunk pools and
+  // the C heap every TrimNativeHeapInterval seconds
+  static void start_native_heap_trimmer_task();
+
+  // Called by the ServiceThread under the Service_lock
+  static bool has_native_heap_trim_request_and_reset();
+
+  // Release pooled chunks and free C heap memory to the operating system.
+  // Returns false if the C heap could not be trimmed on this platform.
+  static bool trim_native_heap();
 };
 
 //------------------------------Arena------------------------------------------
@@ -1693,8 +1693,6 @@ bool FileMapInfo::relocate_pointers(intx addr_delta) {
     log_debug(cds, reloc)("mapped relocation bitmap @ " INTPTR_FORMAT " (" SIZE_FORMAT " bits)",
                           p2i(bitmap_base), ptrmap_size_in_bits);
 
-    BitMapView ptrmap((BitMap::bm_word_t*)bitmap_base, ptrmap_size_in_bits);
-
     // Patch all pointers in the the mapped region that are marked by ptrmap.
     address patch_base = (address)mapped_base();
     address patch_end  = (address)mapped_end();
@@ -1712,7 +1710,7 @@ bool FileMapInfo::relocate_pointers(intx addr_delta) {
 
     SharedDataRelocator<false> patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                        valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    patcher.patch_all((BitMap::bm_word_t*)bitmap_base, ptrmap_size_in_bits);
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
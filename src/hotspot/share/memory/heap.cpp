@@ -222,6 +222,7 @@ bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_s
     return false;
   }
 
+  os::advise_huge_pages(_memory.low(), _memory.committed_size(), mtCode);
   on_code_mapping(_memory.low(), _memory.committed_size());
   _number_of_committed_segments = size_to_segments(_memory.committed_size());
   _number_of_reserved_segments  = size_to_segments(_memory.reserved_size());
@@ -260,6 +261,7 @@ bool CodeHeap::expand_by(size_t size) {
     }
     char* base = _memory.low() + _memory.committed_size();
     if (!_memory.expand_by(dm)) return false;
+    os::advise_huge_pages(base, dm, mtCode);
     on_code_mapping(base, dm);
     size_t i = _number_of_committed_segments;
     _number_of_committed_segments = size_to_segments(_memory.committed_size());
@@ -278,14 +280,14 @@ bool CodeHeap::expand_by(size_t size) {
 }
 
 
-void* CodeHeap::allocate(size_t instance_size) {
+void* CodeHeap::allocate(size_t instance_size, bool lowest_address) {
   size_t number_of_segments = size_to_segments(instance_size + header_size());
   assert(segments_to_size(number_of_segments) >= sizeof(FreeBlock), "not enough room for FreeList");
   assert_locked_or_safepoint(CodeCache_lock);
 
   // First check if we can satisfy request from freelist
   NOT_PRODUCT(verify());
-  HeapBlock* block = search_freelist(number_of_segments);
+  HeapBlock* block = search_freelist(number_of_segments, lowest_address);
   NOT_PRODUCT(verify());
 
   if (block != NULL) {
@@ -302,6 +304,10 @@ void* CodeHeap::allocate(size_t instance_size) {
   // Ensure minimum size for allocation to the heap.
   number_of_segments = MAX2((int)CodeCacheMinBlockLength, (int)number_of_segments);
 
+  // A free block at the end of the used part of the heap can be combined
+  // with the following unused segments.
+  release_freelist_tail();
+
   if (_next_segment + number_of_segments <= _number_of_committed_segments) {
     mark_segmap_as_used(_next_segment, _next_segment + number_of_segments, false);
     block = block_at(_next_segment);
@@ -664,11 +670,47 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   _last_insert_point = prev;
 }
 
+/**
+ * If the last block on the freelist ends at _next_segment, remove it from
+ * the freelist and unallocate it, i.e. move _next_segment down to its start.
+ * Otherwise a request that does not fit into any free block would be served
+ * above that block, leaving it as a hole.
+ */
+void CodeHeap::release_freelist_tail() {
+  if (_freelist == NULL) {
+    return;
+  }
+  FreeBlock* prev = NULL;
+  FreeBlock* last = _freelist;
+  while (last->link() != NULL) {
+    prev = last;
+    last = last->link();
+  }
+  size_t beg = segment_for(last);
+  size_t end = beg + last->length();
+  if (end != _next_segment) {
+    return;
+  }
+
+  if (prev == NULL) {
+    _freelist = NULL;
+  } else {
+    prev->set_link(NULL);
+  }
+  if (_last_insert_point == last) {
+    _last_insert_point = prev;
+  }
+  _freelist_length--;
+  _freelist_segments -= last->length();
+  mark_segmap_as_free(beg, end);
+  _next_segment = beg;
+}
+
 /**
  * Search freelist for an entry on the list with the best fit.
  * @return NULL, if no one was found
  */
-HeapBlock* CodeHeap::search_freelist(size_t length) {
+HeapBlock* CodeHeap::search_freelist(size_t length, bool lowest_address) {
   FreeBlock* found_block  = NULL;
   FreeBlock* found_prev   = NULL;
   size_t     found_length = _next_segment; // max it out to begin with
@@ -682,8 +724,9 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
   // Search for best-fitting block
   while(cur != NULL) {
     size_t cur_length = cur->length();
-    if (cur_length == length) {
-      // We have a perfect fit
+    if (cur_length == length || (lowest_address && cur_length > length)) {
+      // We have a perfect fit, or the first fit at the lowest address
+      // (the list is sorted by increasing addresses)
       found_block  = cur;
       found_prev   = prev;
       found_length = cur_length;
@@ -135,7 +135,8 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
-  HeapBlock* search_freelist(size_t length);
+  HeapBlock* search_freelist(size_t length, bool lowest_address);
+  void release_freelist_tail();
 
   // Iteration helpers
   void*      next_used(HeapBlock* b) const;
@@ -152,7 +153,9 @@ class CodeHeap : public CHeapObj<mtCode> {
   bool  expand_by(size_t size);                  // expands committed memory by size
 
   // Memory allocation
-  void* allocate (size_t size); // Allocate 'size' bytes in the code cache or return NULL
+  // Allocate 'size' bytes in the code cache or return NULL. With 'lowest_address'
+  // the free block at the lowest address is used instead of the best fitting one.
+  void* allocate (size_t size, bool lowest_address = false);
   void  deallocate(void* p);    // Deallocate memory
   // Free the tail of segments allocated by the last call to 'allocate()' which exceed 'used_size'.
   // ATTENTION: this is only safe to use if there was no other call to 'allocate()' after
@@ -174,7 +174,7 @@ KlassInfoTable::KlassInfoTable(bool add_all_classes) {
   _ref = (HeapWord*) Universe::boolArrayKlassObj();
   _buckets =
     (KlassInfoBucket*)  AllocateHeap(sizeof(KlassInfoBucket) * _num_buckets,
-       mtInternal, CURRENT_PC, AllocFailStrategy::RETURN_NULL);
+       mtInternal, MALLOC_CURRENT_PC, AllocFailStrategy::RETURN_NULL);
   if (_buckets != NULL) {
     for (int index = 0; index < _num_buckets; index++) {
       _buckets[index].initialize();
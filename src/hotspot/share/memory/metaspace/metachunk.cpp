@@ -174,6 +174,16 @@ MetaWord* Metachunk::allocate(size_t request_word_size) {
   return p;
 }
 
+bool Metachunk::attempt_rollback_allocation(MetaWord* p, size_t word_size) {
+  if (p + word_size != top()) {
+    return false;
+  }
+  assert(p >= base() && word_size <= used_words(), "Not allocated from this chunk.");
+  _used_words -= word_size;
+  SOMETIMES(verify();)
+  return true;
+}
+
 #ifdef ASSERT
 
 // Zap this structure.
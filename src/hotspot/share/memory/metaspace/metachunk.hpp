@@ -322,6 +322,11 @@ public:
   //
   MetaWord* allocate(size_t request_word_size);
 
+  // Undo the allocation of [p, p + word_size) if it is the last one carved
+  // from this chunk, making the space available to allocate() again.
+  // Returns false if the range does not end at the top of the chunk.
+  bool attempt_rollback_allocation(MetaWord* p, size_t word_size);
+
   // Initialize structure for reuse.
   void initialize(VirtualSpaceNode* node, MetaWord* base, chunklevel_t lvl) {
     clear();
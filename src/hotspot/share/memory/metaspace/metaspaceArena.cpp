@@ -355,7 +355,16 @@ void MetaspaceArena::deallocate_locked(MetaWord* p, size_t word_size) {
       p2i(p), word_size);
 
   size_t raw_word_size = get_raw_word_size_for_requested_word_size(word_size);
-  add_allocation_to_fbl(p, raw_word_size);
+
+  // If this was the most recent allocation from the current chunk, just give
+  // the space back to the chunk. That keeps it in one piece with the chunk's
+  // free tail instead of fragmenting the free block list.
+  if (current_chunk()->attempt_rollback_allocation(p, raw_word_size)) {
+    _total_used_words_counter->decrement_by(raw_word_size);
+    UL2(trace, "rolled back allocation at top of current chunk.");
+  } else {
+    add_allocation_to_fbl(p, raw_word_size);
+  }
 
   DEBUG_ONLY(verify_locked();)
 }
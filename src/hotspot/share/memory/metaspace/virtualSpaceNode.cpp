@@ -107,6 +107,7 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
   if (os::commit_memory((char*)p, word_size * BytesPerWord, false) == false) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
+  os::advise_huge_pages((char*)p, word_size * BytesPerWord, mtClass);
 
   if (AlwaysPreTouch) {
     os::pretouch_memory(p, p + word_size);
@@ -30,6 +30,7 @@
 #include "code/codeCache.hpp"
 #include "code/debugInfoRec.hpp"
 #include "compiler/compilationPolicy.hpp"
+#include "compiler/profileSnapshot.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/bytecodeTracer.hpp"
@@ -560,6 +561,9 @@ MethodCounters* Method::build_method_counters(Method* m, TRAPS) {
     ClassLoaderDataGraph::set_metaspace_oom(true);
     return NULL;   // return the exception (which is cleared)
   }
+  if (ProfileSnapshot::is_loaded()) {
+    ProfileSnapshot::seed(mh(), counters);
+  }
   if (!mh->init_method_counters(counters)) {
     MetadataFactory::free_metadata(mh->method_holder()->class_loader_data(), counters);
   }
@@ -2490,7 +2494,7 @@ void Method::log_touched(TRAPS) {
   MutexLocker ml(THREAD, TouchedMethodLog_lock);
   if (_touched_method_table == NULL) {
     _touched_method_table = NEW_C_HEAP_ARRAY2(TouchedMethodRecord*, table_size,
-                                              mtTracing, CURRENT_PC);
+                                              mtTracing, MALLOC_CURRENT_PC);
     memset(_touched_method_table, 0, sizeof(TouchedMethodRecord*)*table_size);
   }
 
@@ -546,7 +546,7 @@ int MultiBranchData::compute_cell_count(BytecodeStream* stream) {
     Bytecode_lookupswitch sw(stream->method()(), stream->bcp());
     cell_count = 1 + per_case_cell_count * (sw.number_of_pairs() + 1); // 1 for default
   }
-  return cell_count;
+  return cell_count + sample_counter_cell_count();
 }
 
 void MultiBranchData::post_initialize(BytecodeStream* stream,
@@ -559,7 +559,7 @@ void MultiBranchData::post_initialize(BytecodeStream* stream,
   if (stream->code() == Bytecodes::_tableswitch) {
     Bytecode_tableswitch sw(stream->method()(), stream->bcp());
     int len = sw.length();
-    assert(array_len() == per_case_cell_count * (len + 1), "wrong len");
+    assert(array_len() == per_case_cell_count * (len + 1) + sample_counter_cell_count(), "wrong len");
     for (int count = 0; count < len; count++) {
       target = sw.dest_offset_at(count) + bci();
       my_di = mdo->dp_to_di(dp());
@@ -576,7 +576,7 @@ void MultiBranchData::post_initialize(BytecodeStream* stream,
   } else {
     Bytecode_lookupswitch sw(stream->method()(), stream->bcp());
     int npairs = sw.number_of_pairs();
-    assert(array_len() == per_case_cell_count * (npairs + 1), "wrong len");
+    assert(array_len() == per_case_cell_count * (npairs + 1) + sample_counter_cell_count(), "wrong len");
     for (int count = 0; count < npairs; count++) {
       LookupswitchPair pair = sw.pair_at(count);
       target = pair.offset() + bci();
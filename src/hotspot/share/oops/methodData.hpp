@@ -1637,8 +1637,14 @@ public:
 
   static int compute_cell_count(BytecodeStream* stream);
 
+  // With Tier3ProfileSampleFreqLog, a cell after the cases counts the
+  // executions of the switch in tier 3 code to pick the sampled ones.
+  static int sample_counter_cell_count() {
+    return Tier3ProfileSampleFreqLog > 0 ? 1 : 0;
+  }
+
   int number_of_cases() const {
-    int alen = array_len() - 2; // get rid of default case here.
+    int alen = array_len() - 2 - sample_counter_cell_count(); // get rid of default case here.
     assert(alen % per_case_cell_count == 0, "must be even");
     return (alen / per_case_cell_count);
   }
@@ -1685,6 +1691,10 @@ public:
   static ByteSize relative_displacement_offset() {
     return in_ByteSize(relative_displacement_off_set) * cell_size;
   }
+  static ByteSize sample_counter_offset(int number_of_cases) {
+    assert(sample_counter_cell_count() > 0, "no sample counter");
+    return array_element_offset(case_array_start + number_of_cases * per_case_cell_count);
+  }
 
   // Specific initialization.
   void post_initialize(BytecodeStream* stream, MethodData* mdo);
@@ -335,8 +335,11 @@
   product(bool, UseSuperWord, true,                                         \
           "Transform scalar operations into superword operations")          \
                                                                             \
-  develop(bool, SuperWordRTDepCheck, false,                                 \
-          "Enable runtime dependency checks.")                              \
+  product(bool, SuperWordRTDepCheck, false, DIAGNOSTIC,                     \
+          "Vectorize loops with possibly overlapping array references "     \
+          "behind a runtime check that the arrays are different. Off by "   \
+          "default, since each such loop then also keeps a reserved "       \
+          "scalar copy, and that code size cost has not been measured")     \
                                                                             \
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
@@ -533,6 +536,10 @@
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
+  product(bool, ReduceAllocationMerges, true, DIAGNOSTIC,                   \
+          "Split field loads through Phis of allocations before escape "    \
+          "analysis so that the merged allocations can be eliminated")      \
+                                                                            \
   product(intx, EliminateAllocationArraySizeLimit, 64,                      \
           "Array size (number of elements) limit for scalar replacement")   \
           range(0, max_jint)                                                \
@@ -1408,6 +1408,7 @@ AllocateNode::AllocateNode(Compile* C, const TypeFunc *atype,
   _is_scalar_replaceable = false;
   _is_non_escaping = false;
   _is_allocation_MemBar_redundant = false;
+  _not_eliminated_reason = NULL;
   Node *topnode = C->top();
 
   init_req( TypeFunc::Control  , ctrl );
@@ -88,10 +88,134 @@ bool ConnectionGraph::has_candidates(Compile *C) {
   return false;
 }
 
+// Returns true if phi only merges allocations on the paths of a non-loop
+// region and is only used to load fields. The memory of each load must be
+// a memory Phi on the same region, so that the memory state at the end of
+// each path is known.
+static bool is_reducible_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  if (region == NULL || !region->is_Region() || region->is_Loop() ||
+      !phi->type()->isa_oopptr() || phi->outcnt() == 0) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (region->in(i) == NULL || region->in(i)->is_top() ||
+        in == NULL || !in->is_CheckCastPP() ||
+        AllocateNode::Ideal_allocation(in, igvn) == NULL) {
+      return false;
+    }
+  }
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    if (!addp->is_AddP() ||
+        addp->in(AddPNode::Base) != phi ||
+        addp->in(AddPNode::Address) != phi ||
+        addp->in(AddPNode::Offset)->find_intptr_t_con(-1) < 0) {
+      return false;
+    }
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      Node* load = addp->fast_out(j);
+      if (!load->is_Load() || load->in(MemNode::Address) != addp) {
+        return false;
+      }
+      Node* mem = load->in(MemNode::Memory);
+      if (!mem->is_Phi() || mem->in(0) != region) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// An object merged from several allocation sites, as in
+//
+//   Point p = cond ? new Point(a) : new Point(b);
+//   return p.x;
+//
+// is not scalar replaceable because its Phi references more than one
+// allocation. If the merged pointer is only used to load fields, loading the
+// fields on each path instead leaves the Phi dead and the allocations
+// unreferenced by it:
+//
+//   Load(AddP(Phi(o1, o2), off), Phi(m1, m2))
+//     ==> Phi(Load(AddP(o1, off), m1), Load(AddP(o2, off), m2))
+//
+// Merges that are also compared, passed or recorded in debug info are left
+// alone.
+bool ConnectionGraph::reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn) {
+  if (!ReduceAllocationMerges || !EliminateAllocations) {
+    return false;
+  }
+  Unique_Node_List merges;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast jmax, j = res->fast_outs(jmax); j < jmax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi() && is_reducible_allocation_merge(use->as_Phi(), igvn)) {
+        merges.push(use);
+      }
+    }
+  }
+
+  for (uint i = 0; i < merges.size(); i++) {
+    PhiNode* phi = merges.at(i)->as_Phi();
+    if (!is_reducible_allocation_merge(phi, igvn)) {
+      continue; // Changed by an earlier reduction
+    }
+    Node* region = phi->in(0);
+    Node_List loads;
+    for (DUIterator_Fast jmax, j = phi->fast_outs(jmax); j < jmax; j++) {
+      Node* addp = phi->fast_out(j);
+      for (DUIterator_Fast kmax, k = addp->fast_outs(kmax); k < kmax; k++) {
+        loads.push(addp->fast_out(k));
+      }
+    }
+    while (loads.size() > 0) {
+      Node* load = loads.pop();
+      Node* offset = load->in(MemNode::Address)->in(AddPNode::Offset);
+      Node* mem = load->in(MemNode::Memory);
+      PhiNode* value = new PhiNode(region, load->bottom_type());
+      for (uint k = 1; k < phi->req(); k++) {
+        Node* base = phi->in(k);
+        Node* adr = igvn->transform(new AddPNode(base, base, offset));
+        Node* path_load = load->clone();
+        path_load->set_req(0, region->in(k));
+        path_load->set_req(MemNode::Memory, mem->in(k));
+        path_load->set_req(MemNode::Address, adr);
+        value->init_req(k, igvn->transform(path_load));
+      }
+#ifndef PRODUCT
+      if (PrintEliminateAllocations) {
+        tty->print("Split load through allocation merge: ");
+        load->dump();
+      }
+#endif
+      igvn->replace_node(load, igvn->transform(value));
+    }
+  }
+  return merges.size() > 0;
+}
+
 void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase tp("escapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
   ResourceMark rm;
 
+  if (reduce_allocation_merges(C, igvn)) {
+    // Remove the merges that became dead before building the graph.
+    igvn->optimize();
+    if (C->failing()) {
+      return;
+    }
+  }
+
   // Add ConP#NULL and ConN#NULL nodes before ConnectionGraph construction
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
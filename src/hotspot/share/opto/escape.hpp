@@ -573,6 +573,9 @@ public:
   // Perform escape analysis
   static void do_analysis(Compile *C, PhaseIterGVN *igvn);
 
+  // Replace field loads from Phis of allocations by Phis of loads
+  static bool reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn);
+
   bool not_global_escape(Node *n);
 
   // To be used by, e.g., BarrierSetC2 impls
@@ -388,6 +388,58 @@ CountedLoopReserveKit::~CountedLoopReserveKit() {
   }
 }
 
+// Make entry to the new loop conditional on 'bol' in addition to any
+// condition added before. If 'bol' is false the reserved copy is executed.
+void CountedLoopReserveKit::add_condition(BoolNode* bol) {
+  assert(has_reserved(), "no reserved copy of the loop");
+  PhaseIterGVN& igvn = _phase->_igvn;
+
+  if (_iff->in(1)->Opcode() == Op_ConI) {
+    // The first condition replaces the constant that selects the new loop
+    igvn.replace_input_of(_iff, 1, bol);
+    return;
+  }
+
+  IdealLoopTree* outer_loop = _lp->is_strip_mined() ? _lpt->_parent->_parent : _lpt->_parent;
+  LoopNode* head = _lp->skip_strip_mined();
+  LoopNode* slow_head = _lp_reserved->skip_strip_mined();
+
+  Node* entry = head->in(LoopNode::EntryControl);
+  IfNode* iff = new IfNode(entry, bol, PROB_MAX, COUNT_UNKNOWN);
+  _phase->register_control(iff, outer_loop, entry);
+  ProjNode* iffast = new IfTrueNode(iff);
+  _phase->register_control(iffast, outer_loop, iff);
+  ProjNode* ifslow = new IfFalseNode(iff);
+  _phase->register_control(ifslow, outer_loop, iff);
+
+  igvn.replace_input_of(head, LoopNode::EntryControl, iffast);
+  _phase->set_idom(head, iffast, _phase->dom_depth(iffast));
+
+  // All failing conditions merge into the entry of the reserved copy
+  Node* slow_entry = slow_head->in(LoopNode::EntryControl);
+  if (slow_entry->is_Region()) {
+    igvn.rehash_node_delayed(slow_entry);
+    slow_entry->add_req(ifslow);
+  } else {
+    assert(slow_entry->is_IfFalse() && slow_entry->in(0) == _iff, "reserved copy not entered from the reserve if");
+    RegionNode* r = new RegionNode(3);
+    r->init_req(1, slow_entry);
+    r->init_req(2, ifslow);
+    _phase->register_control(r, outer_loop, _iff);
+    igvn.replace_input_of(slow_head, LoopNode::EntryControl, r);
+    _phase->set_idom(slow_head, r, _phase->dom_depth(r));
+  }
+
+  _phase->recompute_dom_depth();
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print_cr("CountedLoopReserveKit::add_condition");
+    tty->print("\t iff = %d, ", iff->_idx); iff->dump();
+  }
+#endif
+}
+
 bool CountedLoopReserveKit::create_reserve() {
   if (!_active) {
     return false;
@@ -1584,6 +1584,10 @@ private:
 //
 // Keep in mind, that by default if create_reserve() is not followed by use_new()
 // the dtor will "switch to the original" loop.
+//
+// Instead of discarding one of the two copies, the modified loop can also be
+// guarded by runtime conditions with add_condition(). The modified loop then
+// runs only if all of the conditions hold and the reserved copy runs otherwise.
 // NOTE. You you modify outside of the original loop this class is no help.
 //
 class CountedLoopReserveKit {
@@ -1602,6 +1606,7 @@ class CountedLoopReserveKit {
     ~CountedLoopReserveKit();
     void use_new()                {_use_new = true;}
     void set_iff(IfNode* x)       {_iff = x;}
+    void add_condition(BoolNode* bol);
     bool has_reserved()     const { return _active && _has_reserved;}
   private:
     bool create_reserve();
@@ -1050,13 +1050,35 @@ void PhaseMacroExpand::process_users_of_allocation(CallNode *alloc) {
   }
 }
 
+// Record in the compilation log why an allocation stays on the heap, so
+// that allocations which only escape on some paths can be found.
+// Elimination may be attempted several times, so this is done once, when
+// the allocation is expanded.
+void PhaseMacroExpand::log_allocation_not_eliminated(AllocateNode* alloc) {
+  CompileLog* log = C->log();
+  if (log == NULL || alloc->_not_eliminated_reason == NULL) {
+    return;
+  }
+  const TypeKlassPtr* tklass = _igvn.type(alloc->in(AllocateNode::KlassNode))->is_klassptr();
+  log->head("eliminate_allocation_failed type='%d' reason='%s'",
+            log->identify(tklass->klass()), alloc->_not_eliminated_reason);
+  for (JVMState* p = alloc->jvms(); p != NULL; p = p->caller()) {
+    log->elem("jvms bci='%d' method='%d'", p->bci(), log->identify(p->method()));
+  }
+  log->tail("eliminate_allocation_failed");
+}
+
 bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
   // If reallocation fails during deoptimization we'll pop all
   // interpreter frames for this compiled frame and that won't play
   // nice with JVMTI popframe.
   // We avoid this issue by eager reallocation when the popframe request
   // is received.
-  if (!EliminateAllocations || !alloc->_is_non_escaping) {
+  if (!EliminateAllocations) {
+    return false;
+  }
+  if (!alloc->_is_non_escaping) {
+    alloc->_not_eliminated_reason = "escapes";
     return false;
   }
   Node* klass = alloc->in(AllocateNode::KlassNode);
@@ -1068,6 +1090,7 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
                       tklass->klass()->is_instance_klass()  &&
                       tklass->klass()->as_instance_klass()->is_box_klass();
   if (!alloc->_is_scalar_replaceable && (!boxing_alloc || (res != NULL))) {
+    alloc->_not_eliminated_reason = "not_scalar_replaceable";
     return false;
   }
 
@@ -1075,6 +1098,7 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
 
   GrowableArray <SafePointNode *> safepoints;
   if (!can_eliminate_allocation(alloc, safepoints)) {
+    alloc->_not_eliminated_reason = "unsupported_use";
     return false;
   }
 
@@ -1084,11 +1108,13 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
     // are already replaced with SafePointScalarObject because
     // we can't search for a fields value without instance_id.
     if (safepoints.length() > 0) {
+      alloc->_not_eliminated_reason = "debug_info";
       return false;
     }
   }
 
   if (!scalar_replacement(alloc, safepoints)) {
+    alloc->_not_eliminated_reason = "field_values";
     return false;
   }
 
@@ -1317,6 +1343,8 @@ void PhaseMacroExpand::expand_allocate_common(
     }
   }
 
+  log_allocation_not_eliminated(alloc);
+
   enum { too_big_or_final_path = 1, need_gc_path = 2 };
   Node *slow_region = NULL;
   Node *toobig_false = ctrl;
@@ -526,6 +526,21 @@ void SuperWord::SLP_extract() {
 
     filter_packs();
 
+    if (!_disjoint_ptrs.is_empty()) {
+      // The dependence graph has no edges between the pointers that are
+      // disambiguated at runtime, so schedule() may reorder them. The
+      // reserved copy that runs when they alias must keep the original
+      // order, so take it before the memory graph is changed.
+      Node* entry = lp()->skip_strip_mined()->in(LoopNode::EntryControl);
+      CountedLoopReserveKit make_reversable(_phase, _lpt, do_reserve_copy());
+      if (!make_reversable.has_reserved()) {
+        return; // The graph is still unchanged, give up vectorizing
+      }
+      schedule();
+      output(&make_reversable, entry);
+      return;
+    }
+
     schedule();
   } else if (post_loop_allowed) {
     int saved_mapped_unroll_factor = cl->slp_max_unroll();
@@ -1086,15 +1101,16 @@ void SuperWord::dependence_graph() {
         SWPointer p2(s2->as_Mem(), this, NULL, false);
 
         int cmp = p1.cmp(p2);
-        if (SuperWordRTDepCheck &&
-            p1.base() != p2.base() && p1.valid() && p2.valid()) {
-          // Create a runtime check to disambiguate
-          OrderedPair pp(p1.base(), p2.base());
-          _disjoint_ptrs.append_if_missing(pp);
-        } else if (!SWPointer::not_equal(cmp)) {
-          // Possibly same address
-          _dg.make_edge(s1, s2);
-          sink_dependent = false;
+        if (!SWPointer::not_equal(cmp)) {
+          if (can_disambiguate_at_runtime(p1, p2)) {
+            // Create a runtime check to disambiguate
+            OrderedPair pp(p1.base(), p2.base());
+            _disjoint_ptrs.append_if_missing(pp);
+          } else {
+            // Possibly same address
+            _dg.make_edge(s1, s2);
+            sink_dependent = false;
+          }
         }
       }
       if (sink_dependent) {
@@ -1124,6 +1140,44 @@ void SuperWord::dependence_graph() {
 
 }
 
+//------------------------------can_disambiguate_at_runtime---------------------------
+// Possibly overlapping references into two different arrays can be treated as
+// independent if the vectorized loop is only entered after a runtime check
+// that the arrays are different objects. The reserved copy of the loop runs
+// when they are the same.
+bool SuperWord::can_disambiguate_at_runtime(SWPointer& p1, SWPointer& p2) {
+  if (!SuperWordRTDepCheck || !do_reserve_copy() || !lp()->as_CountedLoop()->is_main_loop()) {
+    return false;
+  }
+  if (!p1.valid() || !p2.valid()) {
+    return false;
+  }
+  Node* base1 = p1.base();
+  Node* base2 = p2.base();
+  if (base1 == base2 || base1->is_top() || base2->is_top() ||
+      base1->bottom_type()->isa_aryptr() == NULL || base2->bottom_type()->isa_aryptr() == NULL) {
+    return false;
+  }
+  // The check is placed in front of the loop
+  Node* entry = lp()->skip_strip_mined()->in(LoopNode::EntryControl);
+  if (!_phase->is_dominator(_phase->get_ctrl(base1), entry) ||
+      !_phase->is_dominator(_phase->get_ctrl(base2), entry)) {
+    return false;
+  }
+  OrderedPair pp(base1, base2);
+  return _disjoint_ptrs.contains(pp) || _disjoint_ptrs.length() < max_disjoint_ptrs;
+}
+
+//------------------------------disjoint_ptrs_check---------------------------
+// Test that the two array bases of 'pp' are different objects.
+BoolNode* SuperWord::disjoint_ptrs_check(OrderedPair& pp, Node* ctrl) {
+  Node* cmp = new CmpPNode(pp.p1(), pp.p2());
+  _phase->register_new_node(cmp, ctrl);
+  BoolNode* bol = new BoolNode(cmp, BoolTest::ne);
+  _phase->register_new_node(bol, ctrl);
+  return bol;
+}
+
 //---------------------------mem_slice_preds---------------------------
 // Return a memory slice (node list) in predecessor order starting at "start"
 void SuperWord::mem_slice_preds(Node* start, Node* stop, GrowableArray<Node*> &preds) {
@@ -1785,6 +1839,8 @@ void SuperWord::filter_packs() {
 //------------------------------merge_packs_to_cmovd---------------------------
 // Merge CMoveD into new vector-nodes
 // We want to catch this pattern and subsume CmpD and Bool into CMoveD
+// (CMoveI and CMoveL with CmpI and CmpL of arbitrary inputs are merged the
+// same way, and later become a VectorMaskCmp feeding a VectorBlend)
 //
 //                   SubD             ConD
 //                  /  |               /
@@ -1852,7 +1908,8 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
   if (!cmovd->is_CMove()) {
     return NULL;
   }
-  if (cmovd->Opcode() != Op_CMoveF && cmovd->Opcode() != Op_CMoveD) {
+  if (cmovd->Opcode() != Op_CMoveF && cmovd->Opcode() != Op_CMoveD &&
+      !is_blend_candidate(cmovd, cmovd_pk->size())) {
     return NULL;
   }
   if (pack(cmovd) != NULL) { // already in the cmov pack
@@ -1919,6 +1976,33 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
   return new_cmpd_pk;
 }
 
+// CMoveI and CMoveL packs are vectorized as a blend of the two inputs
+// selected by a vector compare of the condition's inputs, rather than as a
+// CMoveV node.
+bool CMoveKit::is_blend_candidate(Node* cmov, uint vlen) const {
+  int cmp_op;
+  BasicType bt;
+  if (cmov->Opcode() == Op_CMoveI) {
+    cmp_op = Op_CmpI;
+    bt = T_INT;
+  } else if (cmov->Opcode() == Op_CMoveL) {
+    cmp_op = Op_CmpL;
+    bt = T_LONG;
+  } else {
+    return false;
+  }
+  if (_sw->velt_basic_type(cmov) != bt) {
+    return false;
+  }
+  // Unsigned compares have no vector counterpart.
+  Node* bol = cmov->in(CMoveNode::Condition);
+  if (!bol->is_Bool() || bol->in(1)->Opcode() != cmp_op) {
+    return false;
+  }
+  return Matcher::match_rule_supported_vector(Op_VectorMaskCmp, vlen, bt) &&
+         Matcher::match_rule_supported_vector(Op_VectorBlend, vlen, bt);
+}
+
 bool CMoveKit::test_cmpd_pack(Node_List* cmpd_pk, Node_List* cmovd_pk) {
   Node* cmpd0 = cmpd_pk->at(0);
   assert(cmpd0->is_Cmp(), "CMoveKit::test_cmpd_pack: should be CmpDNode");
@@ -1950,6 +2034,17 @@ bool CMoveKit::test_cmpd_pack(Node_List* cmpd_pk, Node_List* cmovd_pk) {
       }
     }//for: in2_pk is not pack but all CmpD nodes in the pack have the same in(2)
   }
+  if (is_blend_candidate(cmovd_pk->at(0), cmovd_pk->size())) {
+    // The inputs of the compare are vectorized on their own, they only
+    // need to hold elements of the same type as the CMove.
+    BasicType bt = _sw->velt_basic_type(cmovd_pk->at(0));
+    if ((in1_pk != NULL && _sw->velt_basic_type(in1) != bt) ||
+        (in2_pk != NULL && _sw->velt_basic_type(in2) != bt)) {
+      return false;
+    }
+    NOT_PRODUCT(if(_sw->is_trace_cmov()) { tty->print("CMoveKit::test_cmpd_pack: cmp pack for 1st Cmp %d is OK for blend vectorization: ", cmpd0->_idx); cmpd0->dump(); })
+    return true;
+  }
   //now check if cmpd_pk may be subsumed in vector built for cmovd_pk
   int cmovd_ind1, cmovd_ind2;
   if (cmpd_pk->at(0)->in(1) == cmovd_pk->at(0)->as_CMove()->in(CMoveNode::IfFalse)
@@ -2374,7 +2469,7 @@ void SuperWord::print_loop(bool whole) {
 
 //------------------------------output---------------------------
 // Convert packs into vector node operations
-void SuperWord::output() {
+void SuperWord::output(CountedLoopReserveKit* reserve, Node* reserve_entry) {
   CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
   Compile* C = _phase->C;
   if (_packset.length() == 0) {
@@ -2412,7 +2507,15 @@ void SuperWord::output() {
 
   NOT_PRODUCT(if(is_trace_loop_reverse()) {tty->print_cr("SWPointer::output: print loop before create_reserve_version_of_loop"); print_loop(true);})
 
-  CountedLoopReserveKit make_reversable(_phase, _lpt, do_reserve_copy());
+  // A loop versioned on _disjoint_ptrs comes with its reserved copy, taken
+  // before schedule(). The runtime checks go in front of the reserve if.
+  assert(_disjoint_ptrs.is_empty() == (reserve == NULL), "reserve copy must be taken early");
+  CountedLoopReserveKit local_reserve(_phase, _lpt, do_reserve_copy() && reserve == NULL);
+  CountedLoopReserveKit& make_reversable = reserve != NULL ? *reserve : local_reserve;
+
+  // Vector reductions and their scalar opcodes, for move_reductions_out_of_loop()
+  Node_List reductions;
+  GrowableArray<int> reduction_opcs;
 
   NOT_PRODUCT(if(is_trace_loop_reverse()) {tty->print_cr("SWPointer::output: print loop after create_reserve_version_of_loop"); print_loop(true);})
 
@@ -2530,6 +2633,8 @@ void SuperWord::output() {
         if (node_isa_reduction) {
           const Type *arith_type = n->bottom_type();
           vn = ReductionNode::make(opc, NULL, in1, in2, arith_type->basic_type());
+          reductions.push(vn);
+          reduction_opcs.append(opc);
           if (in2->is_Load()) {
             vlen_in_bytes = in2->as_LoadVector()->memory_size();
           } else {
@@ -2598,8 +2703,26 @@ void SuperWord::output() {
         }
         BasicType bt = velt_basic_type(n);
         const TypeVect* vt = TypeVect::make(bt, vlen);
-        assert(bt == T_FLOAT || bt == T_DOUBLE, "Only vectorization for FP cmovs is supported");
-        if (bt == T_FLOAT) {
+        if (bt == T_INT || bt == T_LONG) {
+          // Blend the inputs under the mask computed by comparing the
+          // vectorized inputs of the compares.
+          Node_List* cmp_pk = my_pack(bol->in(1));
+          Node* cmp_src1 = cmp_pk != NULL ? vector_cmov_cmp_opd(cmp_pk, 1, velt_type(n)) : NULL;
+          Node* cmp_src2 = cmp_pk != NULL ? vector_cmov_cmp_opd(cmp_pk, 2, velt_type(n)) : NULL;
+          if (cmp_src1 == NULL || cmp_src2 == NULL) {
+            if (do_reserve_copy()) {
+              NOT_PRODUCT(if(is_trace_loop_reverse() || TraceLoopOpts) {tty->print_cr("SWPointer::output: compare inputs are not vectorized, exiting SuperWord");})
+              return; //and reverse to backup IG
+            }
+            ShouldNotReachHere();
+          }
+          Node* mask = new VectorMaskCmpNode(bol->as_Bool()->_test._test, cmp_src1, cmp_src2, (ConINode*)in_cc, vt);
+          _igvn.register_new_node_with_optimizer(mask);
+          _phase->set_ctrl(mask, _phase->get_ctrl(p->at(0)));
+          vn = new VectorBlendNode(src1, src2, mask);
+          cc->disconnect_inputs(_phase->C); // only used by CMoveV nodes
+          NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created new VectorBlend node %d: ", vn->_idx); vn->dump();})
+        } else if (bt == T_FLOAT) {
           vn = new CMoveVFNode(cc, src1, src2, vt);
         } else {
           assert(bt == T_DOUBLE, "Expected double");
@@ -2662,6 +2785,10 @@ void SuperWord::output() {
     }
   }//for (int i = 0; i < _block.length(); i++)
 
+  if (cl->is_main_loop()) {
+    move_reductions_out_of_loop(reductions, reduction_opcs);
+  }
+
   if (max_vlen_in_bytes > C->max_vector_size()) {
     C->set_max_vector_size(max_vlen_in_bytes);
   }
@@ -2713,12 +2840,102 @@ void SuperWord::output() {
   }
 
   if (do_reserve_copy()) {
+    // Only enter the vectorized loop if the arrays that were assumed not to
+    // overlap are different objects, otherwise run the reserved copy.
+    for (int i = 0; i < _disjoint_ptrs.length(); i++) {
+      make_reversable.add_condition(disjoint_ptrs_check(_disjoint_ptrs.at(i), reserve_entry));
+    }
     make_reversable.use_new();
   }
   NOT_PRODUCT(if(is_trace_loop_reverse()) {tty->print_cr("\n Final loop after SuperWord"); print_loop(true);})
   return;
 }
 
+//------------------------------move_reductions_out_of_loop---------------------------
+// A vector reduction in the main loop folds all lanes into the scalar
+// accumulator in every iteration, which serializes the loop on the
+// reduction. For associative operations, accumulate in the lanes of a vector
+// phi instead and fold the lanes once after the loop:
+//
+//   phi = Phi(init, red)                 vphi = Phi(identity, vop)
+//   red = Reduction(phi, vec)    ==>     vop  = Op(vphi, vec)
+//   ... red used after the loop          ... Reduction(init, vop) used after the loop
+//
+// Floating point additions and multiplications are not associative and
+// keep their reduction order.
+void SuperWord::move_reductions_out_of_loop(Node_List& reductions, GrowableArray<int>& reduction_opcs) {
+  CountedLoopNode* cl = lpt()->_head->as_CountedLoop();
+  for (uint i = 0; i < reductions.size(); i++) {
+    Node* red = reductions.at(i);
+    int opc = reduction_opcs.at(i);
+    if (opc == Op_AddF || opc == Op_AddD || opc == Op_MulF || opc == Op_MulD) {
+      continue;
+    }
+    Node* phi = red->in(1);
+    if (!phi->is_Phi() || phi->in(0) != cl ||
+        phi->in(LoopNode::LoopBackControl) != red || phi->outcnt() != 1) {
+      continue; // Not the only reduction of the accumulator
+    }
+    Node* vec = red->in(2);
+    const TypeVect* vt = vec->bottom_type()->is_vect();
+    BasicType bt = red->bottom_type()->basic_type();
+    if (vt->element_basic_type() != bt || !VectorNode::implemented(opc, vt->length(), bt)) {
+      continue; // Sub-word lanes would overflow, or no vector operation
+    }
+    bool used_in_loop = false;
+    for (DUIterator_Fast jmax, j = red->fast_outs(jmax); j < jmax; j++) {
+      Node* use = red->fast_out(j);
+      if (use != phi && lpt()->is_member(_phase->get_loop(_phase->ctrl_or_self(use)))) {
+        used_in_loop = true;
+        break;
+      }
+    }
+    if (used_in_loop) {
+      continue;
+    }
+
+    Node* ctrl = _phase->get_ctrl(red);
+    Node* identity = ReductionNode::make_reduction_input(_igvn, opc, bt);
+    _phase->set_ctrl(identity, _phase->C->root());
+    Node* videntity = VectorNode::scalar2vector(identity, vt->length(), Type::get_const_basic_type(bt));
+    _igvn.register_new_node_with_optimizer(videntity);
+    _phase->set_ctrl(videntity, _phase->C->root());
+
+    PhiNode* vphi = PhiNode::make(cl, videntity, vt);
+    _igvn.register_new_node_with_optimizer(vphi);
+    _phase->set_ctrl(vphi, cl);
+
+    Node* vop = VectorNode::make(opc, vphi, vec, vt->length(), bt);
+    _igvn.register_new_node_with_optimizer(vop);
+    _phase->set_ctrl(vop, ctrl);
+    _igvn.replace_input_of(vphi, LoopNode::LoopBackControl, vop);
+
+    Node* exit = cl->loopexit()->proj_out(false);
+    Node* final_red = ReductionNode::make(opc, NULL, phi->in(LoopNode::EntryControl), vop, bt);
+    _igvn.register_new_node_with_optimizer(final_red);
+    _phase->set_ctrl(final_red, exit);
+
+    // Everything after the loop uses the folded value, and the scalar
+    // accumulator dies with the reduction in the loop.
+    for (DUIterator_Last jmin, j = red->last_outs(jmin); j >= jmin; --j) {
+      Node* use = red->last_out(j);
+      if (use != phi) {
+        _igvn.rehash_node_delayed(use);
+        j -= use->replace_edge(red, final_red);
+      }
+    }
+    _igvn.replace_node(phi, phi->in(LoopNode::EntryControl));
+    _igvn._worklist.push(red);
+
+#ifdef ASSERT
+    if (TraceNewVectors) {
+      tty->print("new Vector node: ");
+      vop->dump();
+    }
+#endif
+  }
+}
+
 //------------------------------vector_opd---------------------------
 // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
 Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
@@ -2845,6 +3062,30 @@ Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
   return pk;
 }
 
+//------------------------------vector_cmov_cmp_opd---------------------------
+// Vector operand opd_idx of the compares of a CMoveI or CMoveL pack. The
+// compares are not vectorized themselves, so their inputs are either already
+// replaced by vectors or promoted from a scalar here.
+Node* SuperWord::vector_cmov_cmp_opd(Node_List* cmp_pk, int opd_idx, const Type* elem_t) {
+  Node* opd = cmp_pk->at(0)->in(opd_idx);
+  if (!same_inputs(cmp_pk, opd_idx)) {
+    return NULL;
+  }
+  if (opd->is_Vector() || opd->is_LoadVector()) {
+    return opd;
+  }
+  VectorNode* vn = VectorNode::scalar2vector(opd, cmp_pk->size(), elem_t);
+  _igvn.register_new_node_with_optimizer(vn);
+  _phase->set_ctrl(vn, _phase->get_ctrl(opd));
+#ifdef ASSERT
+  if (TraceNewVectors) {
+    tty->print("new Vector node: ");
+    vn->dump();
+  }
+#endif
+  return vn;
+}
+
 //------------------------------insert_extracts---------------------------
 // If a use of pack p is not a vector use, then replace the
 // use with an extract operation.
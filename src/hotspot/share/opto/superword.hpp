@@ -216,6 +216,7 @@ class CMoveKit {
   Node* is_Bool_candidate(Node* nd) const; // if it is the right candidate return corresponding CMove* ,
   Node* is_CmpD_candidate(Node* nd) const; // otherwise return NULL
   Node_List* make_cmovevd_pack(Node_List* cmovd_pk);
+  bool is_blend_candidate(Node* cmov, uint vlen) const;
   bool test_cmpd_pack(Node_List* cmpd_pk, Node_List* cmovd_pk);
 };//class CMoveKit
 
@@ -236,6 +237,9 @@ class OrderedPair {
     }
   }
 
+  Node* p1() const { return _p1; }
+  Node* p2() const { return _p2; }
+
   bool operator==(const OrderedPair &rhs) {
     return _p1 == rhs._p1 && _p2 == rhs._p2;
   }
@@ -273,6 +277,7 @@ class SuperWord : public ResourceObj {
   MemNode* _align_to_ref;                // Memory reference that pre-loop will align to
 
   GrowableArray<OrderedPair> _disjoint_ptrs; // runtime disambiguated pointer pairs
+  static const int max_disjoint_ptrs = 4;    // limit on the runtime checks before a loop
 
   DepGraph _dg; // Dependence graph
 
@@ -434,6 +439,10 @@ class SuperWord : public ResourceObj {
   bool pack_parallel();
   // Construct dependency graph.
   void dependence_graph();
+  // Can p1 and p2 be treated as independent given a runtime check of their bases?
+  bool can_disambiguate_at_runtime(SWPointer& p1, SWPointer& p2);
+  // Test that the bases of pp are different objects
+  BoolNode* disjoint_ptrs_check(OrderedPair& pp, Node* ctrl);
   // Return a memory slice (node list) in predecessor order starting at "start"
   void mem_slice_preds(Node* start, Node* stop, GrowableArray<Node*> &preds);
   // Can s1 and s2 be in a pack with s1 immediately preceding s2 and  s1 aligned at "align"
@@ -489,9 +498,15 @@ class SuperWord : public ResourceObj {
   Node* find_last_mem_state(Node_List* pk, Node* first_mem);
 
   // Convert packs into vector node operations
-  void output();
+  // If the loop is versioned on _disjoint_ptrs, 'reserve' holds its reserved
+  // copy and 'reserve_entry' the original entry control of the loop.
+  void output(CountedLoopReserveKit* reserve = NULL, Node* reserve_entry = NULL);
+  // Accumulate associative reductions in vector lanes and fold them after the loop
+  void move_reductions_out_of_loop(Node_List& reductions, GrowableArray<int>& reduction_opcs);
   // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
   Node* vector_opd(Node_List* p, int opd_idx);
+  // Vector operand for the compares of an integral CMove pack
+  Node* vector_cmov_cmp_opd(Node_List* cmp_pk, int opd_idx, const Type* elem_t);
   // Can code be generated for pack p?
   bool implemented(Node_List* p);
   // For pack p, are all operands and all uses (with in the block) vector?
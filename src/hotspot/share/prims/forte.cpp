@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "code/debugInfoRec.hpp"
 #include "code/pcDesc.hpp"
+#include "code/perfMap.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
@@ -649,6 +650,7 @@ void Forte::register_stub(const char* name, address start, address end) {
   collector_func_load((char*)name, NULL, NULL, start,
     pointer_delta(end, start, sizeof(jbyte)), 0, NULL);
 #endif // !_WINDOWS && !IA64
+  LINUX_ONLY(PerfMap::write(name, start, end);)
 }
 
 #else // INCLUDE_JVMTI
@@ -28,6 +28,8 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -156,6 +158,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
   float _load_factor;                   // load factor as a % of the size
   int _resize_threshold;                // computed threshold to trigger resizing.
   bool _resizing_enabled;               // indicates if hashmap can resize
+  bool _needs_rehashing;                // objects have moved since last hashed
 
   int _trace_threshold;                 // threshold for trace messages
 
@@ -175,6 +178,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
     _load_factor = load_factor;
     _resize_threshold = (int)(_load_factor * _size);
     _resizing_enabled = true;
+    _needs_rehashing = false;
     size_t s = initial_size * sizeof(JvmtiTagHashmapEntry*);
     _table = (JvmtiTagHashmapEntry**)os::malloc(s, mtInternal);
     if (_table == NULL) {
@@ -250,6 +254,36 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
     // compute new resize threshold
     _resize_threshold = (int)(_load_factor * _size);
+
+    // all entries are at their current hash position now
+    _needs_rehashing = false;
+  }
+
+  // re-hash all entries in place. The GC only updates the entries of moved
+  // objects, leaving them in their old positions, so that the pause does not
+  // pay for re-hashing the table.
+  void rehash() {
+    JvmtiTagHashmapEntry* list = NULL;
+    for (int i = 0; i < _size; i++) {
+      JvmtiTagHashmapEntry* entry = _table[i];
+      while (entry != NULL) {
+        JvmtiTagHashmapEntry* next = entry->next();
+        entry->set_next(list);
+        list = entry;
+        entry = next;
+      }
+      _table[i] = NULL;
+    }
+    while (list != NULL) {
+      JvmtiTagHashmapEntry* next = list->next();
+      oop key = list->object_peek();
+      assert(key != NULL, "jni weak reference cleared!!");
+      unsigned int h = hash(key);
+      list->set_next(_table[h]);
+      _table[h] = list;
+      list = next;
+    }
+    _needs_rehashing = false;
   }
 
 
@@ -535,6 +569,14 @@ JvmtiTagMap* JvmtiTagMap::tag_map_for(JvmtiEnv* env) {
   return tag_map;
 }
 
+JvmtiTagHashmap* JvmtiTagMap::hashmap() {
+  assert(SafepointSynchronize::is_at_safepoint() || is_locked(), "checking");
+  if (_hashmap->_needs_rehashing) {
+    _hashmap->rehash();
+  }
+  return _hashmap;
+}
+
 // iterate over all entries in the tag map.
 void JvmtiTagMap::entry_iterate(JvmtiTagHashmapEntryClosure* closure) {
   hashmap()->entry_iterate(closure);
@@ -543,7 +585,7 @@ void JvmtiTagMap::entry_iterate(JvmtiTagHashmapEntryClosure* closure) {
 // returns true if the hashmaps are empty
 bool JvmtiTagMap::is_empty() {
   assert(SafepointSynchronize::is_at_safepoint() || is_locked(), "checking");
-  return hashmap()->entry_count() == 0;
+  return _hashmap->entry_count() == 0;
 }
 
 
@@ -737,7 +779,7 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
   oop o = JNIHandles::resolve_non_null(object);
 
   // see if the object is already tagged
-  JvmtiTagHashmap* hashmap = _hashmap;
+  JvmtiTagHashmap* hashmap = this->hashmap();
   JvmtiTagHashmapEntry* entry = hashmap->find(o);
 
   // if the object is not already tagged then we tag it
@@ -1253,13 +1295,123 @@ static jint invoke_primitive_field_callback_for_instance_fields(
 }
 
 
+// Tells if an object passes the klass and heap filters of an
+// IterateThroughHeap call. Only reads the tag map, so it can be
+// applied by several GC worker threads at once.
+class HeapFilterClosure : public BoolObjectClosure {
+ private:
+  JvmtiTagMap* _tag_map;
+  JvmtiTagHashmap* _hashmap;
+  Klass* _klass;
+  int _heap_filter;
+
+  jlong tag_for(oop o) const {
+    JvmtiTagHashmapEntry* entry = _hashmap->find(o);
+    return entry == NULL ? 0 : entry->tag();
+  }
+
+ public:
+  HeapFilterClosure(JvmtiTagMap* tag_map, Klass* klass, int heap_filter) :
+    _tag_map(tag_map),
+    _hashmap(NULL),
+    _klass(klass),
+    _heap_filter(heap_filter)
+  {
+  }
+
+  // Called at the safepoint before the workers start, so that any pending
+  // re-hash is done before the tag map is read concurrently.
+  void prepare() {
+    assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+    _hashmap = _tag_map->hashmap();
+  }
+
+  bool do_object_b(oop obj) {
+    if (is_filtered_by_klass_filter(obj, _klass)) {
+      return false;
+    }
+    return !is_filtered_by_heap_filter(tag_for(obj), tag_for(obj->klass()->java_mirror()), _heap_filter);
+  }
+};
+
+// Collects the objects accepted by a filter into one array per worker.
+class ParallelHeapCollectTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  BoolObjectClosure* _filter;
+  GrowableArray<oop>** _collected;
+
+  class CollectClosure : public ObjectClosure {
+    BoolObjectClosure* _filter;
+    GrowableArray<oop>* _objects;
+   public:
+    CollectClosure(BoolObjectClosure* filter, GrowableArray<oop>* objects) :
+      _filter(filter), _objects(objects) {}
+    void do_object(oop obj) {
+      if (_filter->do_object_b(obj)) {
+        _objects->append(obj);
+      }
+    }
+  };
+
+ public:
+  ParallelHeapCollectTask(ParallelObjectIterator* poi,
+                          BoolObjectClosure* filter,
+                          GrowableArray<oop>** collected) :
+    AbstractGangTask("JVMTI heap iteration"),
+    _poi(poi),
+    _filter(filter),
+    _collected(collected) {}
+
+  virtual void work(uint worker_id) {
+    CollectClosure cl(_filter, _collected[worker_id]);
+    _poi->object_iterate(&cl, worker_id);
+  }
+};
+
 // VM operation to iterate over all objects in the heap (both reachable
 // and unreachable)
 class VM_HeapIterateOperation: public VM_Operation {
  private:
   ObjectClosure* _blk;
+  // If set, objects rejected by this filter are skipped by _blk anyway.
+  // The filter is then applied in parallel, and _blk only sees the objects
+  // that pass it, on the VM thread as before.
+  HeapFilterClosure* _filter;
+
+  bool parallel_iterate() {
+    WorkGang* gang = Universe::heap()->safepoint_workers();
+    if (gang == NULL || gang->active_workers() <= 1) {
+      return false;
+    }
+    uint workers = gang->active_workers();
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(workers);
+    if (poi == NULL) {
+      return false;
+    }
+    GrowableArray<oop>** collected = NEW_C_HEAP_ARRAY(GrowableArray<oop>*, workers, mtServiceability);
+    for (uint i = 0; i < workers; i++) {
+      collected[i] = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<oop>(64, mtServiceability);
+    }
+    _filter->prepare();
+    ParallelHeapCollectTask task(poi, _filter, collected);
+    gang->run_task(&task);
+    delete poi;
+
+    for (uint i = 0; i < workers; i++) {
+      GrowableArray<oop>* objects = collected[i];
+      for (int j = 0; j < objects->length(); j++) {
+        _blk->do_object(objects->at(j));
+      }
+      delete objects;
+    }
+    FREE_C_HEAP_ARRAY(GrowableArray<oop>*, collected);
+    return true;
+  }
+
  public:
-  VM_HeapIterateOperation(ObjectClosure* blk) { _blk = blk; }
+  VM_HeapIterateOperation(ObjectClosure* blk, HeapFilterClosure* filter = NULL) :
+    _blk(blk), _filter(filter) { }
 
   VMOp_Type type() const { return VMOp_HeapIterateOperation; }
   void doit() {
@@ -1276,7 +1428,9 @@ class VM_HeapIterateOperation: public VM_Operation {
     }
 
     // do the iteration
-    Universe::heap()->object_iterate(_blk);
+    if (_filter == NULL || !parallel_iterate()) {
+      Universe::heap()->object_iterate(_blk);
+    }
   }
 
 };
@@ -1514,7 +1668,12 @@ void JvmtiTagMap::iterate_through_heap(jint heap_filter,
                                       heap_filter,
                                       callbacks,
                                       user_data);
-  VM_HeapIterateOperation op(&blk);
+  // When the filters select a subset of the heap, such as the instances of
+  // a class or the tagged objects, find that subset in parallel.
+  bool selective = klass != NULL ||
+                   (heap_filter & (JVMTI_HEAP_FILTER_UNTAGGED | JVMTI_HEAP_FILTER_CLASS_UNTAGGED)) != 0;
+  HeapFilterClosure filter(this, klass, heap_filter);
+  VM_HeapIterateOperation op(&blk, selective ? &filter : NULL);
   VMThread::execute(&op);
 }
 
@@ -3326,7 +3485,7 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
   int freed = 0;
   int moved = 0;
 
-  JvmtiTagHashmap* hashmap = this->hashmap();
+  JvmtiTagHashmap* hashmap = _hashmap;
 
   // reenable sizing (if disabled)
   hashmap->set_resizing_enabled(true);
@@ -3336,13 +3495,12 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
     return;
   }
 
-  // now iterate through each entry in the table
+  // now iterate through each entry in the table. Entries of moved objects
+  // are left where they are; the table is re-hashed lazily on next use.
 
   JvmtiTagHashmapEntry** table = hashmap->table();
   int size = hashmap->size();
 
-  JvmtiTagHashmapEntry* delayed_add = NULL;
-
   for (int pos = 0; pos < size; ++pos) {
     JvmtiTagHashmapEntry* entry = table[pos];
     JvmtiTagHashmapEntry* prev = NULL;
@@ -3368,47 +3526,19 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
 
         ++freed;
       } else {
+        oop old_oop = entry->object_raw();
         f->do_oop(entry->object_addr());
-        oop new_oop = entry->object_raw();
-
-        // if the object has moved then re-hash it and move its
-        // entry to its new location.
-        unsigned int new_pos = JvmtiTagHashmap::hash(new_oop, size);
-        if (new_pos != (unsigned int)pos) {
-          if (prev == NULL) {
-            table[pos] = next;
-          } else {
-            prev->set_next(next);
-          }
-          if (new_pos < (unsigned int)pos) {
-            entry->set_next(table[new_pos]);
-            table[new_pos] = entry;
-          } else {
-            // Delay adding this entry to it's new position as we'd end up
-            // hitting it again during this iteration.
-            entry->set_next(delayed_add);
-            delayed_add = entry;
-          }
+        if (entry->object_raw() != old_oop) {
+          hashmap->_needs_rehashing = true;
           moved++;
-        } else {
-          // object didn't move
-          prev = entry;
         }
+        prev = entry;
       }
 
       entry = next;
     }
   }
 
-  // Re-add all the entries which were kept aside
-  while (delayed_add != NULL) {
-    JvmtiTagHashmapEntry* next = delayed_add->next();
-    unsigned int pos = JvmtiTagHashmap::hash(delayed_add->object_raw(), size);
-    delayed_add->set_next(table[pos]);
-    table[pos] = delayed_add;
-    delayed_add = next;
-  }
-
   log_debug(jvmti, objecttagging)("(%d->%d, %d freed, %d total moves)",
                                   hashmap->_entry_count + freed, hashmap->_entry_count, freed, moved);
 }
@@ -68,7 +68,8 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   // indicates if this tag map is locked
   bool is_locked()                          { return lock()->is_locked(); }
 
-  JvmtiTagHashmap* hashmap() { return _hashmap; }
+  // the hashmap, re-hashed first if objects have moved since the last use
+  JvmtiTagHashmap* hashmap();
 
   // create/destroy entries
   JvmtiTagHashmapEntry* create_entry(oop ref, jlong tag);
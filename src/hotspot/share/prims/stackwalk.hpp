@@ -55,8 +55,10 @@ public:
   virtual Method* method()=0;
   virtual int     bci()=0;
 
+  // method is not handleized, so that frames that only need the
+  // declaring class do not pay for a methodHandle
   virtual void    fill_frame(int index, objArrayHandle  frames_array,
-                             const methodHandle& method, TRAPS)=0;
+                             Method* method, TRAPS)=0;
 
   void setup_magic_on_entry(objArrayHandle frames_array);
   bool check_magic(objArrayHandle frames_array);
@@ -87,7 +89,7 @@ public:
   int bci()        { return _vfst.bci(); }
 
   void fill_frame(int index, objArrayHandle  frames_array,
-                  const methodHandle& method, TRAPS);
+                  Method* method, TRAPS);
 };
 
 class LiveFrameStream : public BaseFrameStream {
@@ -117,7 +119,7 @@ public:
   int bci()        { return _jvf->bci(); }
 
   void fill_frame(int index, objArrayHandle  frames_array,
-                  const methodHandle& method, TRAPS);
+                  Method* method, TRAPS);
 };
 
 class StackWalk : public AllStatic {
@@ -1811,6 +1811,19 @@ void Arguments::set_heap_size() {
                                        : (julong)MaxRAM;
   }
 
+  // Hold back the native memory reserve so that the heap, sized as a
+  // percentage of what is left, does not push a memory limited process
+  // (such as a container) over its limit.
+  if (ErgoNativeMemoryReserve != 0) {
+    if ((julong)ErgoNativeMemoryReserve < phys_mem) {
+      phys_mem -= ErgoNativeMemoryReserve;
+      log_debug(gc, heap)("Reserving " SIZE_FORMAT "M for native memory, sizing heap from " JULONG_FORMAT "M",
+                          ErgoNativeMemoryReserve / M, phys_mem / M);
+    } else {
+      log_warning(gc, heap)("ErgoNativeMemoryReserve (" SIZE_FORMAT "M) is not less than available memory ("
+                            JULONG_FORMAT "M), ignoring it", ErgoNativeMemoryReserve / M, phys_mem / M);
+    }
+  }
 
   // Convert deprecated flags
   if (FLAG_IS_DEFAULT(MaxRAMPercentage) &&
@@ -2900,6 +2913,9 @@ jint Arguments::parse_each_vm_init_arg(const JavaVMInitArgs* args, bool* patch_m
       } else if (strcmp(tail, ":disable") == 0) {
         LogConfiguration::disable_logging();
         ret = true;
+      } else if (strcmp(tail, ":async") == 0) {
+        LogConfiguration::set_async_mode(true);
+        ret = true;
       } else if (*tail == '\0') {
         ret = LogConfiguration::parse_command_line_arguments();
         assert(ret, "-Xlog without arguments should never fail to parse");
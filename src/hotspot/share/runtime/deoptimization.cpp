@@ -895,6 +895,32 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   }
 }
 
+void Deoptimization::deoptimize_marked(const GrowableArray<nmethod*>* marked) {
+  ResourceMark rm;
+  DeoptimizationMarker dm;
+
+  {
+    // The nmethods were marked under the CodeCache_lock by this thread, and
+    // they cannot be flushed until this thread has taken part in a handshake
+    // or safepoint, so it is safe to look at them again here.
+    MutexLocker mu(SafepointSynchronize::is_at_safepoint() ? NULL : CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    for (int i = 0; i < marked->length(); i++) {
+      nmethod* nm = marked->at(i);
+      assert(nm->is_marked_for_deoptimization(), "must be marked");
+      if (nm->is_alive() && !nm->is_unloading()) {
+        nm->make_not_entrant();
+      }
+    }
+  }
+
+  DeoptimizeMarkedClosure deopt;
+  if (SafepointSynchronize::is_at_safepoint()) {
+    Threads::java_threads_do(&deopt);
+  } else {
+    Handshake::execute(&deopt);
+  }
+}
+
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
@@ -2692,15 +2718,56 @@ jint Deoptimization::total_deoptimization_count() {
   return _deoptimization_hist[Reason_none][0][0];
 }
 
+juint Deoptimization::deoptimization_count(DeoptReason reason, DeoptAction action) {
+  assert(reason >= 0 && reason < Reason_LIMIT, "oob");
+  assert(action >= 0 && action < Action_LIMIT, "oob");
+  juint count = 0;
+  juint* cases = _deoptimization_hist[reason][1+action];
+  for (int bc_case = 0; bc_case < BC_CASE_LIMIT; bc_case++) {
+    count += cases[bc_case] >> LSB_BITS;
+  }
+  return count;
+}
+
+#if INCLUDE_JFR
+void Deoptimization::post_statistics_events() {
+  if (total_deoptimization_count() == 0) {
+    return;
+  }
+  // Only called when the periodic event is enabled. register_serializers()
+  // registers the type serializers once.
+  register_serializers();
+  for (int reason = 0; reason < Reason_LIMIT; reason++) {
+    for (int action = 0; action < Action_LIMIT; action++) {
+      juint count = deoptimization_count((DeoptReason)reason, (DeoptAction)action);
+      if (count != 0) {
+        EventDeoptimizationStatistics event;
+        event.set_reason(reason);
+        event.set_action(action);
+        event.set_count(count);
+        event.commit();
+      }
+    }
+  }
+}
+#endif // INCLUDE_JFR
+
 void Deoptimization::print_statistics() {
+  if (total_deoptimization_count() != 0) {
+    ttyLocker ttyl;
+    if (xtty != NULL)  xtty->head("statistics type='deoptimization'");
+    print_statistics_on(tty);
+    if (xtty != NULL)  xtty->tail("statistics");
+  }
+}
+
+void Deoptimization::print_statistics_on(outputStream* st) {
   juint total = total_deoptimization_count();
   juint account = total;
   if (total != 0) {
-    ttyLocker ttyl;
-    if (xtty != NULL)  xtty->head("statistics type='deoptimization'");
-    tty->print_cr("Deoptimization traps recorded:");
+    st->print_cr("Deoptimization traps recorded:");
     #define PRINT_STAT_LINE(name, r) \
-      tty->print_cr("  %4d (%4.1f%%) %s", (int)(r), ((r) * 100.0) / total, name);
+      st->print_cr("  %4d (%4.1f%%) %s", (int)(r), ((r) * 100.0) / total, name);
     PRINT_STAT_LINE("total", total);
     // For each non-zero entry in the histogram, print the reason,
     // the action, and (if specifically known) the type of bytecode.
@@ -2719,7 +2786,7 @@ void Deoptimization::print_statistics() {
                     trap_action_name(action),
                     Bytecodes::is_defined(bc)? Bytecodes::name(bc): "other");
             juint r = counter >> LSB_BITS;
-            tty->print_cr("  %40s: " UINT32_FORMAT " (%.1f%%)", name, r, (r * 100.0) / total);
+            st->print_cr("  %40s: " UINT32_FORMAT " (%.1f%%)", name, r, (r * 100.0) / total);
             account -= r;
           }
         }
@@ -2729,7 +2796,8 @@ void Deoptimization::print_statistics() {
       PRINT_STAT_LINE("unaccounted", account);
     }
     #undef PRINT_STAT_LINE
-    if (xtty != NULL)  xtty->tail("statistics");
+  } else {
+    st->print_cr("No deoptimization traps recorded");
   }
 }
 
@@ -2749,6 +2817,20 @@ void Deoptimization::print_statistics() {
   // no output
 }
 
+void Deoptimization::print_statistics_on(outputStream* st) {
+  st->print_cr("No deoptimization traps recorded");
+}
+
+juint Deoptimization::deoptimization_count(DeoptReason reason, DeoptAction action) {
+  return 0;
+}
+
+#if INCLUDE_JFR
+void Deoptimization::post_statistics_events() {
+  // no events
+}
+#endif // INCLUDE_JFR
+
 void
 Deoptimization::update_method_data_from_interpreter(MethodData* trap_mdo, int trap_bci, int reason) {
   // no udpate
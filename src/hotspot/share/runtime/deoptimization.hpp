@@ -28,6 +28,8 @@
 #include "memory/allocation.hpp"
 #include "runtime/frame.hpp"
 
+template <class E> class GrowableArray;
+
 class ProfileData;
 class vframeArray;
 class MonitorInfo;
@@ -150,6 +152,11 @@ class Deoptimization : AllStatic {
   // find all marked nmethods and they are made not_entrant.
   static void deoptimize_all_marked(nmethod* nmethod_only = NULL);
 
+  // Make the given nmethods, which the caller has marked_for_deoptimization,
+  // not_entrant and deoptimize any live activations using them. This avoids
+  // the scan of the code cache done by deoptimize_all_marked().
+  static void deoptimize_marked(const GrowableArray<nmethod*>* marked);
+
  private:
   // Revoke biased locks at deopt.
   static void revoke_from_deopt_handler(JavaThread* thread, frame fr, RegisterMap* map);
@@ -315,6 +322,11 @@ class Deoptimization : AllStatic {
   static void gather_statistics(DeoptReason reason, DeoptAction action,
                                 Bytecodes::Code bc = Bytecodes::_illegal);
   static void print_statistics();
+  static void print_statistics_on(outputStream* st);
+  // Number of traps recorded for the given reason and action, over all bytecodes.
+  static juint deoptimization_count(DeoptReason reason, DeoptAction action);
+  // Post one DeoptimizationStatistics event per non-zero reason/action pair.
+  JFR_ONLY(static void post_statistics_events();)
 
   // How much room to adjust the last frame's SP by, to make space for
   // the callee's interpreter frame (which expects locals to be next to
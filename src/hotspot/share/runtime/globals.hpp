@@ -171,6 +171,12 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, CleanChunkPoolAsync, true,                                  \
           "Clean the chunk pool asynchronously")                            \
                                                                             \
+  product(uintx, TrimNativeHeapInterval, 0,                                 \
+          "Interval in seconds at which pooled arena chunks and free C "    \
+          "heap memory are returned to the operating system, where "        \
+          "supported; 0 disables periodic trimming")                        \
+          range(0, max_jint)                                                \
+                                                                            \
   product(uint, HandshakeTimeout, 0, DIAGNOSTIC,                            \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
@@ -458,6 +464,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Number of ring buffer event logs")                               \
           range(1, NOT_LP64(1*K) LP64_ONLY(1*M))                            \
                                                                             \
+  product(size_t, AsyncLogBufferSize, 2*M,                                  \
+          "Memory budget (in bytes) for the buffer of Asynchronous "        \
+          "Logging (-Xlog:async)")                                          \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(bool, BytecodeVerificationRemote, true, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for remote classes")           \
                                                                             \
@@ -559,12 +570,23 @@ const intx ObjectAlignmentInBytes = 8;
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  product(int, HeapDumpMaxPrimitiveArrayLength, -1, DIAGNOSTIC,             \
+          "Truncate the contents of primitive arrays in heap dumps to at "  \
+          "most this many elements. -1 means no limit")                     \
+          range(-1, max_jint)                                               \
+                                                                            \
   develop(bool, BreakAtWarning, false,                                      \
           "Execute breakpoint upon encountering VM warning")                \
                                                                             \
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uintx, NativeMemoryTrackingStackSampleInterval, 1,                \
+          "In detail mode, record the call stack of only every n-th "       \
+          "malloc of a thread. The others are accounted to the site "       \
+          "without call stack")                                             \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -731,6 +753,12 @@ const intx ObjectAlignmentInBytes = 8;
           "MonitorUsedDeflationThreshold is exceeded (0 is off).")          \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, MonitorDeflationMax, 1000000, DIAGNOSTIC,                   \
+          "The maximum number of monitors to deflate, unlink and delete "   \
+          "at one time (minimum is 1024). Remaining idle monitors are "     \
+          "deflated in the following deflation cycles.")                    \
+          range(1024, max_jint)                                             \
+                                                                            \
   product(intx, MonitorUsedDeflationThreshold, 90, EXPERIMENTAL,            \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -798,6 +826,11 @@ const intx ObjectAlignmentInBytes = 8;
   notproduct(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
+  product(ccstrlist, HotInstanceFields, "", DIAGNOSTIC,                     \
+          "Comma separated list of instance fields, given as "              \
+          "package/Class.field, that are laid out before all other "        \
+          "fields of their class so they share cache lines")                \
+                                                                            \
   /* Need to limit the extent of the padding to reasonable size.          */\
   /* 8K is well beyond the reasonable HW cache line size, even with       */\
   /* aggressive prefetching, while still leaving the room for segregating */\
@@ -1022,6 +1055,14 @@ const intx ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(uintx, CompilerThreadsCPUPercentage, 100,                         \
+          "Percentage of the processors available to the VM (which honors " \
+          "container CPU limits) that may be occupied by dynamically "      \
+          "started compiler threads. Lower values also delay tier "         \
+          "transitions when the compile queues back up. 100 means no "      \
+          "limit")                                                          \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1086,6 +1127,14 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, PrintTouchedMethodsAtExit, false, DIAGNOSTIC,               \
           "Print all methods that have been ever touched in runtime")       \
                                                                             \
+  product(ccstr, ProfileSnapshotFile, NULL, EXPERIMENTAL,                   \
+          "Seed the invocation and backedge counters of methods from the "  \
+          "profile snapshot in this file")                                  \
+                                                                            \
+  product(bool, DumpProfileSnapshotAtExit, false, EXPERIMENTAL,             \
+          "Write the counters of the loaded methods to ProfileSnapshotFile "\
+          "at exit")                                                        \
+                                                                            \
   develop(bool, TraceMethodReplacement, false,                              \
           "Print when methods are replaced do to recompilation")            \
                                                                             \
@@ -1461,6 +1510,12 @@ const intx ObjectAlignmentInBytes = 8;
           "Delay in milliseconds for option SafepointTimeout")              \
           range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
                                                                             \
+  product(intx, SafepointSyncSampleDelay, 10, DIAGNOSTIC,                   \
+          "Delay in milliseconds after which the threads that have not "    \
+          "reached a safepoint yet are sampled and logged with "            \
+          "-Xlog:safepoint+sampling (0 means never)")                       \
+          range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
+                                                                            \
   product(intx, NmethodSweepActivity, 10,                                   \
           "Removes cold nmethods from code cache if > 0. Higher values "    \
           "result in more aggressive sweeping")                             \
@@ -1731,6 +1786,12 @@ const intx ObjectAlignmentInBytes = 8;
   notproduct(bool, ExitOnFullCodeCache, false,                              \
           "Exit the VM if we fill the code cache")                          \
                                                                             \
+  product(intx, HotCodeInvocationThreshold, 0,                              \
+          "Place nmethods of the final tier for methods invoked at least "  \
+          "this often at the lowest free address of their code heap, so "   \
+          "that hot code stays dense. 0 disables the hot code placement")   \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, UseCodeCacheFlushing, true,                                 \
           "Remove cold/old nmethods from the code cache")                   \
                                                                             \
@@ -1970,6 +2031,12 @@ const intx ObjectAlignmentInBytes = 8;
           "frequency")                                                      \
           range(0, 30)                                                      \
                                                                             \
+  product(intx, Tier3ProfileSampleFreqLog, 0,                               \
+          "C1 with MDO profiling (tier 3) updates the profile of a switch " \
+          "only once per 2^n executions of that switch, by a "              \
+          "correspondingly scaled count. 0 updates it on every execution")  \
+          range(0, 10)                                                      \
+                                                                            \
   product(intx, Tier23InlineeNotifyFreqLog, 20,                             \
           "Inlinee invocation (tiers 2 and 3) notification frequency")      \
           range(0, 30)                                                      \
@@ -2496,6 +2563,11 @@ const intx ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(size_t, NativeAllocationSampleInterval, 512*K,           \
+          "Average number of bytes a thread allocates through os::malloc "  \
+          "between two NativeMemoryAllocationSample events")                \
+          range(1, max_uintx))                                              \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -236,6 +236,19 @@ class VM_HandshakeAllThreads: public VM_Handshake {
     _op->add_target_count(number_of_threads_issued - 1);
 
     log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread");
+
+    // Most threads execute the operation themselves after noticing the
+    // armed poll. Only keep revisiting the threads that still have
+    // operations pending, so that each round costs the number of
+    // outstanding threads instead of the total number of threads.
+    ResourceMark rm;
+    JavaThread** pending = NEW_RESOURCE_ARRAY(JavaThread*, jtiwh.length());
+    int number_of_pending = 0;
+    jtiwh.rewind();
+    for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
+      pending[number_of_pending++] = thr;
+    }
+
     HandshakeSpinYield hsy(start_time_ns);
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
@@ -249,16 +262,19 @@ class VM_HandshakeAllThreads: public VM_Handshake {
       // Have VM thread perform the handshake operation for blocked threads.
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
-      jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-        // A new thread on the ThreadsList will not have an operation,
-        // hence it is skipped in handshake_try_process.
+      int still_pending = 0;
+      for (int i = 0; i < number_of_pending; i++) {
+        JavaThread* thr = pending[i];
         HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
         hsy.add_result(pr);
         if (pr == HandshakeState::_succeeded) {
           emitted_handshakes_executed++;
+        } else if (pr != HandshakeState::_no_operation) {
+          // The operation may still be pending for this thread.
+          pending[still_pending++] = thr;
         }
       }
+      number_of_pending = still_pending;
       hsy.process();
     } while (!_op->is_completed());
 
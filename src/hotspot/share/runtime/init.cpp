@@ -79,6 +79,7 @@ void vmStructs_init() NOT_DEBUG_RETURN;
 void vtableStubs_init();
 void InlineCacheBuffer_init();
 void compilerOracle_init();
+void profileSnapshot_init();
 bool compileBroker_init();
 void dependencyContext_init();
 
@@ -137,6 +138,7 @@ jint init_globals() {
   vtableStubs_init();
   InlineCacheBuffer_init();
   compilerOracle_init();
+  profileSnapshot_init();
   dependencyContext_init();
 
   if (!compileBroker_init()) {
@@ -155,6 +155,7 @@ class ThreadInVMfromJava : public ThreadStateTransition {
     trans_from_java(_thread_in_vm);
   }
   ~ThreadInVMfromJava()  {
+    JFR_ONLY(COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL(_thread);)
     if (_thread->stack_overflow_state()->stack_yellow_reserved_zone_disabled()) {
       _thread->stack_overflow_state()->enable_stack_yellow_reserved_zone();
     }
@@ -196,6 +197,7 @@ class ThreadInVMfromNative : public ThreadStateTransition {
     trans_from_native(_thread_in_vm);
   }
   ~ThreadInVMfromNative() {
+    JFR_ONLY(COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL(_thread);)
     trans(_thread_in_vm, _thread_in_native);
   }
 };
@@ -293,6 +295,7 @@ class ThreadInVMfromJavaNoAsyncException : public ThreadStateTransition {
     trans_from_java(_thread_in_vm);
   }
   ~ThreadInVMfromJavaNoAsyncException()  {
+    JFR_ONLY(COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL(_thread);)
     if (_thread->stack_overflow_state()->stack_yellow_reserved_zone_disabled()) {
       _thread->stack_overflow_state()->enable_stack_yellow_reserved_zone();
     }
@@ -33,7 +33,9 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/profileSnapshot.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
+#include "interpreter/oopMapCache.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
 #if INCLUDE_JVMCI
@@ -346,6 +348,7 @@ void print_statistics() {
   }
 
   ThreadsSMRSupport::log_statistics();
+  OopMapCache::log_statistics();
 }
 
 #else // PRODUCT MODE STATISTICS
@@ -392,6 +395,7 @@ void print_statistics() {
   }
 
   ThreadsSMRSupport::log_statistics();
+  OopMapCache::log_statistics();
 }
 
 #endif
@@ -497,6 +501,10 @@ void before_exit(JavaThread* thread) {
   }
 #endif
 
+  if (DumpProfileSnapshotAtExit && ProfileSnapshotFile != NULL) {
+    ProfileSnapshot::dump(ProfileSnapshotFile);
+  }
+
   print_statistics();
   Universe::heap()->print_tracing_info();
 
@@ -64,6 +64,10 @@ JavaCallWrapper::JavaCallWrapper(const methodHandle& callee_method, Handle recei
   // since it can potentially block.
   JNIHandleBlock* new_handles = JNIHandleBlock::allocate_block(thread);
 
+  // Commit a native allocation sample of the current VM entry while its Java
+  // frames are still the top of the stack, see JfrNativeMemorySampler.
+  JFR_ONLY(COMMIT_NATIVE_MEMORY_SAMPLE_CONDITIONAL(thread);)
+
   // After this, we are official in JavaCode. This needs to be done before we change any of the thread local
   // info, since we cannot find oops before the new information is set up completely.
   ThreadStateTransition::transition(thread, _thread_in_vm, _thread_in_Java);
@@ -1763,6 +1763,15 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     return 0;
   }
 
+  // Don't spin at all if the owner is blocked or in native. It cannot
+  // drop the lock in a timely fashion, and spinning would only burn
+  // cycles that the owner, or some other thread, could use. The caller
+  // retries the lock once more before parking.
+  if (NotRunnable(Self, (Thread *) _owner)) {
+    OM_PERFDATA_OP(SpinSkips, inc());
+    return 0;
+  }
+
   for (ctr = Knob_PreSpin + 1; --ctr >= 0;) {
     if (TryLock(Self) > 0) {
       // Increase _SpinDuration ...
@@ -1773,6 +1782,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinAcquisitions, inc());
       return 1;
     }
     SpinPause();
@@ -1793,9 +1803,13 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   // hold the duration constant but vary the frequency.
 
   ctr = _SpinDuration;
-  if (ctr <= 0) return 0;
+  if (ctr <= 0) {
+    OM_PERFDATA_OP(SpinFailures, inc());
+    return 0;
+  }
 
   if (NotRunnable(Self, (Thread *) _owner)) {
+    OM_PERFDATA_OP(SpinSkips, inc());
     return 0;
   }
 
@@ -1863,6 +1877,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinAcquisitions, inc());
         return 1;
       }
 
@@ -1915,8 +1930,12 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(Self) > 0) return 1;
+    if (TryLock(Self) > 0) {
+      OM_PERFDATA_OP(SpinAcquisitions, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2058,12 +2077,15 @@ inline void ObjectMonitor::DequeueSpecificWaiter(ObjectWaiter* node) {
 
 // -----------------------------------------------------------------------------
 // PerfData support
-PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = NULL;
-PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
-PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_ContendedLockAttempts = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_FutileWakeups        = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_Parks                = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_SpinAcquisitions     = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_SpinFailures         = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_SpinSkips            = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
 
 // One-shot global initialization for the sync subsystem.
@@ -2088,6 +2110,12 @@ void ObjectMonitor::Initialize() {
     n = PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events,  \
                                         CHECK);                          \
   }
+#define NEWSTRIPEDPERFCOUNTER(n)                                         \
+  {                                                                      \
+    n = new PerfStripedCounter();                                        \
+    PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events, n,  \
+                                    CHECK);                              \
+  }
 #define NEWPERFVARIABLE(n)                                                \
   {                                                                       \
     n = PerfDataManager::create_variable(SUN_RT, #n, PerfData::U_Events,  \
@@ -2095,12 +2123,16 @@ void ObjectMonitor::Initialize() {
   }
     NEWPERFCOUNTER(_sync_Inflations);
     NEWPERFCOUNTER(_sync_Deflations);
-    NEWPERFCOUNTER(_sync_ContendedLockAttempts);
-    NEWPERFCOUNTER(_sync_FutileWakeups);
-    NEWPERFCOUNTER(_sync_Parks);
+    NEWSTRIPEDPERFCOUNTER(_sync_ContendedLockAttempts);
+    NEWSTRIPEDPERFCOUNTER(_sync_FutileWakeups);
+    NEWSTRIPEDPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWSTRIPEDPERFCOUNTER(_sync_SpinAcquisitions);
+    NEWSTRIPEDPERFCOUNTER(_sync_SpinFailures);
+    NEWSTRIPEDPERFCOUNTER(_sync_SpinSkips);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
+#undef NEWSTRIPEDPERFCOUNTER
 #undef NEWPERFVARIABLE
   }
 
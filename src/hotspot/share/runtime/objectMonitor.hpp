@@ -201,12 +201,17 @@ class ObjectMonitor {
       }                                          \
     } while (0)
 
-  static PerfCounter * _sync_ContendedLockAttempts;
-  static PerfCounter * _sync_FutileWakeups;
-  static PerfCounter * _sync_Parks;
+  static PerfStripedCounter * _sync_ContendedLockAttempts;
+  static PerfStripedCounter * _sync_FutileWakeups;
+  static PerfStripedCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
+  // Outcomes of adaptive spinning in TrySpin(). Spinning is skipped
+  // when the owner is not runnable.
+  static PerfStripedCounter * _sync_SpinAcquisitions;
+  static PerfStripedCounter * _sync_SpinFailures;
+  static PerfStripedCounter * _sync_SpinSkips;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
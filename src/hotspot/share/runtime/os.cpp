@@ -66,6 +66,10 @@
 #include "utilities/align.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/events.hpp"
+#include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeMemorySampler.hpp"
+#endif
 
 # include <signal.h>
 # include <errno.h>
@@ -667,10 +671,16 @@ static bool has_reached_max_malloc_test_peak(size_t alloc_size) {
 }
 
 void* os::malloc(size_t size, MEMFLAGS flags) {
-  return os::malloc(size, flags, CALLER_PC);
+  return os::malloc(size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
+  void* const ptr = malloc_unsampled(size, memflags, stack);
+  JFR_ONLY(JfrNativeMemorySampler::on_allocation(ptr, size, memflags);)
+  return ptr;
+}
+
+void* os::malloc_unsampled(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
   NOT_PRODUCT(inc_stat_counter(&num_mallocs, 1));
   NOT_PRODUCT(inc_stat_counter(&alloc_bytes, size));
 
@@ -728,7 +738,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS flags) {
-  return os::realloc(memblock, size, flags, CALLER_PC);
+  return os::realloc(memblock, size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -749,10 +759,16 @@ void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCa
   NOT_PRODUCT(inc_stat_counter(&alloc_bytes, size));
    // NMT support
   NMT_TrackingLevel level = MemTracker::tracking_level();
+  // The old size is only known from the NMT header.
+  const size_t old_size = MemTracker::malloc_size(memblock, level);
   void* membase = MemTracker::record_free(memblock, level);
   size_t  nmt_header_size = MemTracker::malloc_header_size(level);
   void* ptr = ::realloc(membase, size + nmt_header_size);
-  return MemTracker::record_malloc(ptr, size, memflags, stack, level);
+  void* const user_ptr = MemTracker::record_malloc(ptr, size, memflags, stack, level);
+  if (memblock == NULL || nmt_header_size != 0) {
+    JFR_ONLY(JfrNativeMemorySampler::on_reallocation(user_ptr, old_size, size, memflags);)
+  }
+  return user_ptr;
 #else
   if (memblock == NULL) {
     return os::malloc(size, memflags, stack);
@@ -765,12 +781,13 @@ void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCa
   void* membase = MemTracker::malloc_base(memblock);
   verify_memory(membase);
   // always move the block
-  void* ptr = os::malloc(size, memflags, stack);
+  void* ptr = os::malloc_unsampled(size, memflags, stack);
   // Copy to new memory if malloc didn't fail
   if (ptr != NULL ) {
     GuardedMemory guarded(MemTracker::malloc_base(memblock));
     // Guard's user data contains NMT header
     size_t memblock_size = guarded.get_user_size() - MemTracker::malloc_header_size(memblock);
+    JFR_ONLY(JfrNativeMemorySampler::on_reallocation(ptr, memblock_size, size, memflags);)
     memcpy(ptr, memblock, MIN2(size, memblock_size));
     if (paranoid) {
       verify_memory(MemTracker::malloc_base(ptr));
@@ -1272,6 +1289,15 @@ FILE* os::fopen(const char* path, const char* mode) {
   return file;
 }
 
+bool os::is_fifo_file(const char* path) {
+  struct stat st;
+  int ret = os::stat(path, &st);
+  if (ret != 0) {
+    return false;
+  }
+  return S_ISFIFO(st.st_mode);
+}
+
 bool os::set_boot_path(char fileSep, char pathSep) {
   const char* home = Arguments::get_java_home();
   int home_len = (int)strlen(home);
@@ -1753,6 +1779,9 @@ bool os::release_memory(char* addr, size_t bytes) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
+  if (start < end && pd_pretouch_memory(start, end, page_size)) {
+    return;
+  }
   for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
     *p = 0;
   }
@@ -1797,6 +1826,10 @@ void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
 
+void os::advise_huge_pages(char *addr, size_t bytes, MEMFLAGS flag) {
+  pd_advise_huge_pages(addr, bytes, flag);
+}
+
 char* os::reserve_memory_special(size_t size, size_t alignment,
                                  char* addr, bool executable) {
 
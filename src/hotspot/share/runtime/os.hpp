@@ -140,6 +140,8 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  static void   pd_advise_huge_pages(char *addr, size_t bytes, MEMFLAGS flag);
+  static bool   pd_pretouch_memory(void* start, void* end, size_t page_size);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment,
                                           char* addr, bool executable);
@@ -155,6 +157,9 @@ class os: AllStatic {
 
   LINUX_ONLY(static void pd_init_container_support();)
 
+  // os::malloc without the JFR native allocation sample, see os::realloc
+  static void* malloc_unsampled(size_t size, MEMFLAGS flags, const NativeCallStack& stack);
+
  public:
   static void init(void);                      // Called before command line parsing
 
@@ -353,7 +358,8 @@ class os: AllStatic {
   // Touch memory pages that cover the memory range from start to end (exclusive)
   // to make the OS back the memory range with actual memory.
   // Current implementation may not touch the last page if unaligned addresses
-  // are passed.
+  // are passed. The platform may populate the whole range at once instead of
+  // touching it page by page, see pd_pretouch_memory().
   static void   pretouch_memory(void* start, void* end, size_t page_size = vm_page_size());
 
   enum ProtType { MEM_PROT_NONE, MEM_PROT_READ, MEM_PROT_RW, MEM_PROT_RWX };
@@ -383,6 +389,14 @@ class os: AllStatic {
   static bool   unmap_memory(char *addr, size_t bytes);
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Hint that the committed range [addr, addr + bytes), which holds memory
+  // of type flag, should be backed by huge pages if the platform policy
+  // for that memory type asks for it.
+  static void   advise_huge_pages(char *addr, size_t bytes, MEMFLAGS flag);
+
+  // Return free memory retained by the C heap to the operating system.
+  // Returns false if the platform does not support this.
+  static bool   trim_native_heap();
 
   // NUMA-specific interface
   static bool   numa_has_static_binding();
@@ -716,6 +730,8 @@ class os: AllStatic {
   // IO operations, non-JVM_ version.
   static int stat(const char* path, struct stat* sbuf);
   static bool dir_is_empty(const char* path);
+  // Returns true if path names an existing FIFO (named pipe).
+  static bool is_fifo_file(const char* path);
 
   // IO operations on binary files
   static int create_binary_file(const char* path, bool rewrite_existing);
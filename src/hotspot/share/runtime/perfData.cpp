@@ -28,12 +28,14 @@
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -184,6 +186,31 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   PerfMemory::mark_updated();
 }
 
+PerfStripedCounter::PerfStripedCounter() {
+  for (uint i = 0; i < NumStripes; i++) {
+    _stripes[i]._value = 0;
+  }
+}
+
+uint PerfStripedCounter::stripe_index() {
+  // Thread objects are allocated with a large alignment, so mix the high
+  // bits of the address into the index.
+  const uint64_t addr = (uint64_t)p2i(Thread::current_or_null());
+  return (uint)((addr * UCONST64(0x9E3779B97F4A7C15)) >> 60) % NumStripes;
+}
+
+void PerfStripedCounter::inc(jlong val) {
+  Atomic::add(&_stripes[stripe_index()]._value, val, memory_order_relaxed);
+}
+
+jlong PerfStripedCounter::take_sample() {
+  jlong sum = 0;
+  for (uint i = 0; i < NumStripes; i++) {
+    sum += Atomic::load(&_stripes[i]._value);
+  }
+  return sum;
+}
+
 PerfLong::PerfLong(CounterNS ns, const char* namep, Units u, Variability v)
                  : PerfData(ns, namep, u, v) {
 
@@ -351,6 +351,44 @@ class PerfLongSampleHelper : public CHeapObj<mtInternal> {
 
 typedef PerfLongSampleHelper PerfSampleHelper;
 
+/*
+ * PerfStripedCounter is a sample helper for counters that many threads
+ * increment at high rates. An increment goes to one of a few stripes,
+ * selected by the incrementing thread, and each stripe has a cache line
+ * of its own, so the updates do not contend on the PerfMemory line that
+ * also holds the neighbouring counters. The StatSampler folds the stripes
+ * into the PerfData value when it takes its periodic samples, so readers
+ * of the counter see it at the sampling interval granularity.
+ *
+ * Usage:
+ *
+ *   foo_stripes = new PerfStripedCounter();
+ *   PerfDataManager::create_counter(SUN_RT, "foo", PerfData::U_Events,
+ *                                   foo_stripes, CHECK);
+ *   ...
+ *   foo_stripes->inc();
+ */
+class PerfStripedCounter : public PerfLongSampleHelper {
+  private:
+    static const uint NumStripes = 16;
+
+    struct Stripe {
+      volatile jlong _value;
+      char _pad[DEFAULT_CACHE_LINE_SIZE - sizeof(jlong)];
+    };
+
+    char _pad_before[DEFAULT_CACHE_LINE_SIZE];
+    Stripe _stripes[NumStripes];
+
+    static uint stripe_index();
+
+  public:
+    PerfStripedCounter();
+
+    void inc(jlong val = 1);
+    virtual jlong take_sample();
+};
+
 
 /*
  * PerfLong is the base class for the various Long PerfData subtypes.
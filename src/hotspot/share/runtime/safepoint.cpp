@@ -245,12 +245,23 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
 
+  jlong sample_time = 0;
+  if (SafepointSyncSampleDelay > 0 && log_is_enabled(Info, safepoint, sampling)) {
+    sample_time = SafepointTracing::start_of_safepoint() + (jlong)SafepointSyncSampleDelay * (NANOUNITS / MILLIUNITS);
+  }
+
   do {
     // Check if this has taken too long:
     if (SafepointTimeout && safepoint_limit_time < os::javaTimeNanos()) {
       print_safepoint_timeout();
     }
 
+    // Sample the threads that are slow to reach the safepoint, once per safepoint.
+    if (sample_time != 0 && sample_time < os::javaTimeNanos()) {
+      print_running_threads_sample(tss_head);
+      sample_time = 0;
+    }
+
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != NULL) {
@@ -495,6 +506,9 @@ bool SafepointSynchronize::is_cleanup_needed() {
   if (!InlineCacheBuffer::is_empty()) return true;
   if (StringTable::needs_rehashing()) return true;
   if (SymbolTable::needs_rehashing()) return true;
+  // Lookups in an overloaded dictionary walk long bucket chains until
+  // the next safepoint resizes it, so do not wait for an unrelated one.
+  if (Dictionary::does_any_dictionary_needs_resizing()) return true;
   return false;
 }
 
@@ -535,13 +549,24 @@ public:
     _subtasks(SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS),
     _num_workers(num_workers),
     _do_lazy_roots(!VMThread::vm_operation()->skip_thread_oop_barriers() &&
-                   Universe::heap()->uses_stack_watermark_barrier()) {}
+                   Universe::heap()->uses_stack_watermark_barrier()) {
+    if (_do_lazy_roots) {
+      Threads::change_thread_claim_token();
+    }
+  }
 
   void work(uint worker_id) {
-    if (_do_lazy_roots && _subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING)) {
-      Tracer t("lazy partial thread root processing");
+    if (_do_lazy_roots) {
+      // All workers help with the lazy root processing, claiming threads
+      // one at a time. The worker claiming the subtask reports it.
       ParallelSPCleanupThreadClosure cl;
-      Threads::threads_do(&cl);
+      bool is_par = _num_workers > 1;
+      if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING)) {
+        Tracer t("lazy partial thread root processing");
+        Threads::possibly_parallel_threads_do(is_par, &cl);
+      } else {
+        Threads::possibly_parallel_threads_do(is_par, &cl);
+      }
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_DEFLATE_MONITORS)) {
@@ -780,6 +805,63 @@ void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
 }
 
 
+// Fetches the pc of a thread that is suspended while running.
+class SafepointSyncPCSampler : public os::SuspendedThreadTask {
+  address _pc;
+ public:
+  SafepointSyncPCSampler(JavaThread* thread) : os::SuspendedThreadTask(thread), _pc(NULL) {}
+  address pc() const { return _pc; }
+  // The thread is suspended, don't take locks or allocate memory.
+  void do_task(const os::SuspendedThreadTaskContext& context) {
+    if (context.ucontext() != NULL) {
+      intptr_t* sp;
+      intptr_t* fp;
+      _pc = os::fetch_frame_from_context(context.ucontext(), &sp, &fp);
+    }
+  }
+};
+
+void SafepointSynchronize::print_running_threads_sample(ThreadSafepointState* tss_head) {
+  LogTarget(Info, safepoint, sampling) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+
+  ls.print_cr("Threads not at safepoint after " INTX_FORMAT " ms (%s):",
+              SafepointSyncSampleDelay, VMThread::vm_operation()->name());
+  for (ThreadSafepointState* cur_tss = tss_head; cur_tss != NULL; cur_tss = cur_tss->get_next()) {
+    JavaThread* cur_thread = cur_tss->thread();
+    ls.print("  ");
+    cur_thread->print_on(&ls);
+    ls.cr();
+    // Only threads running compiled or interpreted code are stuck between
+    // polls, the others are in transition and will block shortly.
+    if (cur_thread->thread_state() != _thread_in_Java) {
+      continue;
+    }
+    SafepointSyncPCSampler sampler(cur_thread);
+    sampler.run();
+    address pc = sampler.pc();
+    if (pc == NULL) {
+      continue;
+    }
+    ls.print("    pc " INTPTR_FORMAT, p2i(pc));
+    CodeBlob* cb = CodeCache::find_blob_unsafe(pc);
+    if (cb != NULL && cb->is_nmethod()) {
+      nmethod* nm = cb->as_nmethod();
+      ls.print(" in compiled method (id %d, level %d) ", nm->compile_id(), nm->comp_level());
+      nm->method()->print_short_name(&ls);
+    } else if (cb != NULL) {
+      ls.print(" in %s", cb->name());
+    } else if (Interpreter::contains(pc)) {
+      ls.print(" in interpreter");
+    }
+    ls.cr();
+  }
+}
+
 void SafepointSynchronize::print_safepoint_timeout() {
   if (!timeout_error_printed) {
     timeout_error_printed = true;
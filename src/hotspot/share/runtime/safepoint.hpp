@@ -113,6 +113,7 @@ class SafepointSynchronize : AllStatic {
 
   // For debug long safepoint
   static void print_safepoint_timeout();
+  static void print_running_threads_sample(ThreadSafepointState* tss_head);
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
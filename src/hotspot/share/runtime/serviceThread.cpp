@@ -31,6 +31,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "memory/arena.hpp"
 #include "memory/universe.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -147,6 +148,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     JvmtiDeferredEvent jvmti_event;
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
+    bool native_heap_trim_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
       // will be handled by safepoint correctly when this thread is
@@ -175,6 +177,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
               (oop_handles_to_release = (_oop_handle_list != NULL)) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
+              (native_heap_trim_work = Chunk::has_native_heap_trim_request_and_reset()) |
               (deflate_idle_monitors = ObjectSynchronizer::is_async_deflation_needed())
              ) == 0) {
         // Wait until notified that there is some work to do.
@@ -244,6 +247,12 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     if (cldg_cleanup_work) {
       ClassLoaderDataGraph::safepoint_and_clean_metaspaces();
     }
+
+    if (native_heap_trim_work) {
+      // Trimming can take a while, do not hold up safepoints meanwhile.
+      ThreadBlockInVM tbivm(jt);
+      Chunk::trim_native_heap();
+    }
   }
 }
 
@@ -490,7 +490,9 @@ bool ObjectSynchronizer::quick_notify(oopDesc* obj, Thread* self, bool all) {
 
 // The LockNode emitted directly at the synchronization site would have
 // been too big if it were to have included support for the cases of inflated
-// recursive enter and exit, so they go here instead.
+// recursive enter and exit, so they go here instead. Stack-locking that the
+// inlined fast path did not manage, e.g. because of a transient CAS failure,
+// is also retried here before falling back to the blocking slow-path.
 // Note that we can't safely call AsyncPrintJavaStack() from within
 // quick_enter() as our thread state remains _in_Java.
 
@@ -507,6 +509,25 @@ bool ObjectSynchronizer::quick_enter(oop obj, Thread* self,
 
   const markWord mark = obj->mark();
 
+  if (mark.is_neutral()) {
+    // Uncontended stack-locking as in enter(). This is safe without a
+    // thread state transition since it can neither block nor reach a
+    // safepoint. A biased mark is not neutral and takes the slow-path
+    // for revocation.
+    lock->set_displaced_header(mark);
+    if (mark == obj->cas_set_mark(markWord::from_pointer(lock), mark)) {
+      return true;
+    }
+    return false;      // Lost the race, the slow-path will inflate.
+  }
+
+  if (mark.has_locker() && self->is_lock_owned((address)mark.locker())) {
+    // Recursive stack-lock by the caller.
+    assert(lock != mark.locker(), "must not re-lock the same lock");
+    lock->set_displaced_header(markWord::from_pointer(NULL));
+    return true;
+  }
+
   if (mark.has_monitor()) {
     ObjectMonitor* const m = mark.monitor();
     // An async deflation or GC can race us before we manage to make
@@ -2183,13 +2204,17 @@ bool ObjectSynchronizer::deflate_monitor(ObjectMonitor* mid,
 // list could be a per-thread in-use list or the global in-use list.
 // If self is a JavaThread and a safepoint has started, then we save state
 // via saved_mid_in_use_p and return to the caller to honor the safepoint.
+// The walk also stops early without saving state once deflation_limit
+// ObjectMonitors have been deflated; the next deflation cycle starts over
+// at the beginning of the list.
 //
 int ObjectSynchronizer::deflate_monitor_list(Thread* self,
                                              ObjectMonitor** list_p,
                                              int* count_p,
                                              ObjectMonitor** free_head_p,
                                              ObjectMonitor** free_tail_p,
-                                             ObjectMonitor** saved_mid_in_use_p) {
+                                             ObjectMonitor** saved_mid_in_use_p,
+                                             int deflation_limit) {
   ObjectMonitor* cur_mid_in_use = NULL;
   ObjectMonitor* mid = NULL;
   ObjectMonitor* next = NULL;
@@ -2270,6 +2295,18 @@ int ObjectSynchronizer::deflate_monitor_list(Thread* self,
       // All the list management is done so move on to the next one:
       mid = next;  // mid keeps non-NULL next's locked state
       next = next_next;
+
+      if (deflated_count >= deflation_limit) {
+        // We have deflated enough for this cycle. Unlock what we hold
+        // and let the next cycle deal with the rest of the list.
+        if (cur_mid_in_use != NULL) {
+          om_unlock(cur_mid_in_use);
+        }
+        if (mid != NULL) {
+          om_unlock(mid);
+        }
+        break;
+      }
     } else {
       // mid is considered in-use if mid is not old or deflation did not
       // succeed. A mid->is_new() node can be seen here when it is freshly
@@ -2337,16 +2374,24 @@ class HandshakeForDeflation : public HandshakeClosure {
 // It is also called by do_final_audit_and_print_stats() by the VMThread.
 void ObjectSynchronizer::deflate_idle_monitors() {
   Thread* self = Thread::current();
+  // The ServiceThread deflates in bounded batches so a huge population of
+  // idle monitors does not keep it (and the handshake below) busy for too
+  // long. The final audit deflates everything.
+  const int deflation_limit = self->is_Java_thread() ? (int)MonitorDeflationMax : max_jint;
+
   // Deflate any global idle monitors.
-  deflate_global_idle_monitors(self);
+  int deflated_count = deflate_global_idle_monitors(self, deflation_limit);
 
   int count = 0;
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *jt = jtiwh.next(); ) {
+    if (deflated_count >= deflation_limit) {
+      break;
+    }
     if (Atomic::load(&jt->om_in_use_count) > 0 && !jt->is_exiting()) {
       // This JavaThread is using ObjectMonitors so deflate any that
       // are idle unless this JavaThread is exiting; do not race with
       // ObjectSynchronizer::om_flush().
-      deflate_per_thread_idle_monitors(self, jt);
+      deflated_count += deflate_per_thread_idle_monitors(self, jt, deflation_limit - deflated_count);
       count++;
     }
   }
@@ -2364,9 +2409,15 @@ void ObjectSynchronizer::deflate_idle_monitors() {
   GVars.stw_random = os::random();
 
   if (self->is_Java_thread()) {
-    // The async deflation request has been processed.
+    // The async deflation request has been processed. If we stopped
+    // because of the limit, keep the request pending so that the
+    // ServiceThread continues with the next batch.
     _last_async_deflation_time_ns = os::javaTimeNanos();
-    set_is_async_deflation_requested(false);
+    bool limit_reached = deflated_count >= deflation_limit;
+    if (limit_reached) {
+      log_debug(monitorinflation)("deflated %d monitors, continuing with the next batch.", deflated_count);
+    }
+    set_is_async_deflation_requested(limit_reached);
   }
 
   if (Atomic::load(&om_list_globals._wait_count) > 0) {
@@ -2411,22 +2462,24 @@ void ObjectSynchronizer::deflate_idle_monitors() {
 
 // Deflate global idle ObjectMonitors.
 //
-void ObjectSynchronizer::deflate_global_idle_monitors(Thread* self) {
-  deflate_common_idle_monitors(self, true /* is_global */, NULL /* target */);
+int ObjectSynchronizer::deflate_global_idle_monitors(Thread* self, int deflation_limit) {
+  return deflate_common_idle_monitors(self, true /* is_global */, NULL /* target */, deflation_limit);
 }
 
 // Deflate the specified JavaThread's idle ObjectMonitors.
 //
-void ObjectSynchronizer::deflate_per_thread_idle_monitors(Thread* self,
-                                                          JavaThread* target) {
-  deflate_common_idle_monitors(self, false /* !is_global */, target);
+int ObjectSynchronizer::deflate_per_thread_idle_monitors(Thread* self,
+                                                         JavaThread* target,
+                                                         int deflation_limit) {
+  return deflate_common_idle_monitors(self, false /* !is_global */, target, deflation_limit);
 }
 
 // Deflate global or per-thread idle ObjectMonitors.
 //
-void ObjectSynchronizer::deflate_common_idle_monitors(Thread* self,
-                                                      bool is_global,
-                                                      JavaThread* target) {
+int ObjectSynchronizer::deflate_common_idle_monitors(Thread* self,
+                                                     bool is_global,
+                                                     JavaThread* target,
+                                                     int deflation_limit) {
   int deflated_count = 0;
   ObjectMonitor* free_head_p = NULL;  // Local SLL of scavenged ObjectMonitors
   ObjectMonitor* free_tail_p = NULL;
@@ -2450,12 +2503,14 @@ void ObjectSynchronizer::deflate_common_idle_monitors(Thread* self,
           deflate_monitor_list(self, &om_list_globals._in_use_list,
                                &om_list_globals._in_use_count,
                                &free_head_p, &free_tail_p,
-                               &saved_mid_in_use_p);
+                               &saved_mid_in_use_p,
+                               deflation_limit - deflated_count);
     } else {
       local_deflated_count =
           deflate_monitor_list(self, &target->om_in_use_list,
                                &target->om_in_use_count, &free_head_p,
-                               &free_tail_p, &saved_mid_in_use_p);
+                               &free_tail_p, &saved_mid_in_use_p,
+                               deflation_limit - deflated_count);
     }
     deflated_count += local_deflated_count;
 
@@ -2501,7 +2556,7 @@ void ObjectSynchronizer::deflate_common_idle_monitors(Thread* self,
         timer.start();
       }
     }
-  } while (saved_mid_in_use_p != NULL);
+  } while (saved_mid_in_use_p != NULL && deflated_count < deflation_limit);
   timer.stop();
 
   LogStreamHandle(Debug, monitorinflation) lsh_debug;
@@ -2519,6 +2574,7 @@ void ObjectSynchronizer::deflate_common_idle_monitors(Thread* self,
       ls->print_cr("jt=" INTPTR_FORMAT ": async-deflating per-thread idle monitors, %3.7f secs, %d monitors", p2i(target), timer.seconds(), deflated_count);
     }
   }
+  return deflated_count;
 }
 
 // Monitor cleanup on JavaThread::exit
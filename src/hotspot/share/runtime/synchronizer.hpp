@@ -130,18 +130,23 @@ class ObjectSynchronizer : AllStatic {
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
   static void deflate_idle_monitors();
-  static void deflate_global_idle_monitors(Thread* self);
-  static void deflate_per_thread_idle_monitors(Thread* self,
-                                               JavaThread* target);
-  static void deflate_common_idle_monitors(Thread* self, bool is_global,
-                                           JavaThread* target);
-
-  // For a given in-use monitor list: global or per-thread, deflate idle
-  // monitors.
+  // The deflate_*_idle_monitors() functions deflate at most deflation_limit
+  // monitors and return the number of deflated monitors.
+  static int deflate_global_idle_monitors(Thread* self, int deflation_limit);
+  static int deflate_per_thread_idle_monitors(Thread* self,
+                                              JavaThread* target,
+                                              int deflation_limit);
+  static int deflate_common_idle_monitors(Thread* self, bool is_global,
+                                          JavaThread* target,
+                                          int deflation_limit);
+
+  // For a given in-use monitor list: global or per-thread, deflate up to
+  // deflation_limit idle monitors.
   static int deflate_monitor_list(Thread* self, ObjectMonitor** list_p,
                                   int* count_p, ObjectMonitor** free_head_p,
                                   ObjectMonitor** free_tail_p,
-                                  ObjectMonitor** saved_mid_in_use_p);
+                                  ObjectMonitor** saved_mid_in_use_p,
+                                  int deflation_limit);
   static bool deflate_monitor(ObjectMonitor* mid, ObjectMonitor** free_head_p,
                               ObjectMonitor** free_tail_p);
   static bool is_async_deflation_needed();
@@ -46,6 +46,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -180,9 +181,9 @@ void* Thread::allocate(size_t size, bool throw_excpt, MEMFLAGS flags) {
   if (UseBiasedLocking) {
     const size_t alignment = markWord::biased_lock_alignment;
     size_t aligned_size = size + (alignment - sizeof(intptr_t));
-    void* real_malloc_addr = throw_excpt? AllocateHeap(aligned_size, flags, CURRENT_PC)
-                                          : AllocateHeap(aligned_size, flags, CURRENT_PC,
-                                                         AllocFailStrategy::RETURN_NULL);
+    void* real_malloc_addr = throw_excpt? AllocateHeap(aligned_size, flags, MALLOC_CURRENT_PC)
+                                          : AllocateHeap(aligned_size, flags, MALLOC_CURRENT_PC,
+                                                                AllocFailStrategy::RETURN_NULL);
     void* aligned_addr     = align_up(real_malloc_addr, alignment);
     assert(((uintptr_t) aligned_addr + (uintptr_t) size) <=
            ((uintptr_t) real_malloc_addr + (uintptr_t) aligned_size),
@@ -195,8 +196,8 @@ void* Thread::allocate(size_t size, bool throw_excpt, MEMFLAGS flags) {
     ((Thread*) aligned_addr)->_real_malloc_address = real_malloc_addr;
     return aligned_addr;
   } else {
-    return throw_excpt? AllocateHeap(size, flags, CURRENT_PC)
-                       : AllocateHeap(size, flags, CURRENT_PC, AllocFailStrategy::RETURN_NULL);
+    return throw_excpt? AllocateHeap(size, flags, MALLOC_CURRENT_PC)
+                       : AllocateHeap(size, flags, MALLOC_CURRENT_PC, AllocFailStrategy::RETURN_NULL);
   }
 }
 
@@ -258,6 +259,7 @@ Thread::Thread() {
   NOT_PRODUCT(_skip_gcalot = false;)
   _jvmti_env_iteration_count = 0;
   set_allocated_bytes(0);
+  _nmt_stack_sample_counter = 0;
   _current_pending_monitor = NULL;
   _current_pending_monitor_is_from_java = true;
   _current_waiting_monitor = NULL;
@@ -3548,6 +3550,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // crash Linux VM, see notes in os_linux.cpp.
   main_thread->stack_overflow_state()->create_stack_guard_pages();
 
+  // Start the asynchronous log writer, if -Xlog:async is given.
+  AsyncLogWriter::initialize();
+
   // Initialize Java-Level synchronization subsystem
   ObjectMonitor::Initialize();
 
@@ -3662,6 +3667,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     Chunk::start_chunk_pool_cleaner_task();
   }
 
+  if (TrimNativeHeapInterval > 0) {
+    Chunk::start_native_heap_trimmer_task();
+  }
+
   // Start the service thread
   // The service thread enqueues JVMTI deferred events and does various hashtable
   // and other cleanups.  Needs to start before the compilers start posting events.
@@ -404,6 +404,8 @@ class Thread: public ThreadShadow {
 
   ThreadStatisticalInfo _statistical_info;      // Statistics about the thread
 
+  uintx _nmt_stack_sample_counter;              // Mallocs since the last NMT call stack sample
+
   JFR_ONLY(DEFINE_THREAD_LOCAL_FIELD_JFR;)      // Thread-local data for jfr
 
   ObjectMonitor* _current_pending_monitor;      // ObjectMonitor this thread
@@ -618,6 +620,8 @@ class Thread: public ThreadShadow {
 
   ThreadStatisticalInfo& statistical_info() { return _statistical_info; }
 
+  uintx inc_nmt_stack_sample_counter()  { return ++_nmt_stack_sample_counter; }
+
   JFR_ONLY(DEFINE_THREAD_LOCAL_ACCESSOR_JFR;)
 
   bool is_trace_suspend()               { return (_suspend_flags & _trace_flag) != 0; }
@@ -177,9 +177,7 @@ inline ThreadsList* ThreadsSMRSupport::xchg_java_thread_list(ThreadsList* new_li
 }
 
 // Hash table of pointers found by a scan. Used for collecting hazard
-// pointers (ThreadsList references). Also used for collecting JavaThreads
-// that are indirectly referenced by hazard ptrs. An instance of this
-// class only contains one type of pointer.
+// pointers (ThreadsList references).
 //
 class ThreadScanHashtable : public CHeapObj<mtThread> {
  private:
@@ -219,43 +217,34 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
+// Closure to find out whether a specific JavaThread is indirectly
+// referenced by a hazard ptr (ThreadsList reference). Most hazard ptrs
+// refer to the same (current) ThreadsList so each distinct ThreadsList
+// is only searched once in a row, and the search stops at the first match.
 //
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
+class ScanHazardPtrMatchProtectedThreadClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
-
+  JavaThread* _thread;
+  ThreadsList* _last_searched;
+  bool _found;
  public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrMatchProtectedThreadClosure(JavaThread* thread) :
+    _thread(thread), _last_searched(NULL), _found(false) {}
 
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
+  bool found() const { return _found; }
+
+  // Search the ThreadsList for the JavaThread unless that was just done.
+  void search(ThreadsList* list) {
+    if (list != _last_searched) {
+      _last_searched = list;
+      _found = list->includes(_thread);
     }
   }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
-//
-class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
- public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
-    if (thread == NULL) return;
+    if (thread == NULL || _found) return;
 
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
@@ -287,8 +276,7 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    search(current_list);
   }
 };
 
@@ -864,39 +852,28 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
 
-  // Hash table size should be first power of two higher than twice
-  // the length of the Threads list.
-  int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
-  hash_table_size = round_up_power_of_2(hash_table_size);
-
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
-  ThreadScanHashtable *scan_table = new ThreadScanHashtable(hash_table_size);
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  // Search the ThreadsLists referenced by hazard ptrs for the JavaThread.
+  ScanHazardPtrMatchProtectedThreadClosure scan_cl(thread);
   threads_do(&scan_cl);
+  if (scan_cl.found()) {
+    return true;
+  }
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
 
   // Walk through the linked list of pending freeable ThreadsLists
-  // and include the ones that are currently in use by a nested
-  // ThreadsListHandle in the search set.
+  // and search the ones that are currently in use by a nested
+  // ThreadsListHandle.
   ThreadsList* current = _to_delete_list;
   while (current != NULL) {
-    if (current->_nested_handle_cnt != 0) {
+    if (current->_nested_handle_cnt != 0 && current->includes(thread)) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+      return true;
     }
     current = current->next_list();
   }
-
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
-  }
-  delete scan_table;
-  return thread_is_protected;
+  return false;
 }
 
 // Wake up portion of the release stable ThreadsList protocol;
@@ -47,6 +47,9 @@
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
 #include "utilities/vmError.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeMemorySampler.hpp"
+#endif
 
 
 //------------------------------------------------------------------------------------------------------------------
@@ -88,6 +91,8 @@ Monitor*          VMThread::_terminate_lock     = NULL;
 VMThread*         VMThread::_vm_thread          = NULL;
 VM_Operation*     VMThread::_cur_vm_operation   = NULL;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
+VM_Operation*     VMThread::_pending_operations[VMThread::MaxPendingOperations];
+int               VMThread::_num_pending_operations = 0;
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = NULL;
 VMOperationTimeoutTask* VMThread::_timeout_task = NULL;
 
@@ -267,6 +272,7 @@ void VMThread::evaluate_operation(VM_Operation* op) {
     if (event.should_commit()) {
       post_vm_operation_event(&event, op);
     }
+    JFR_ONLY(JfrNativeMemorySampler::on_vm_operation_end(this);)
 
     HOTSPOT_VMOPS_END(
                      (char *) op->name(), strlen(op->name()),
@@ -335,6 +341,52 @@ bool VMThread::set_next_operation(VM_Operation *op) {
   return true;
 }
 
+bool VMThread::add_pending_operation(VM_Operation* op) {
+  assert_lock_strong(VMOperation_lock);
+  if (_num_pending_operations == MaxPendingOperations) {
+    return false;
+  }
+  log_debug(vmthread)("Adding pending VM operation: %s", op->name());
+
+  _pending_operations[_num_pending_operations++] = op;
+
+  HOTSPOT_VMOPS_REQUEST(
+                   (char *) op->name(), strlen(op->name()),
+                   op->evaluate_at_safepoint() ? 0 : 1);
+  return true;
+}
+
+bool VMThread::is_pending_operation(VM_Operation* op) {
+  assert_lock_strong(VMOperation_lock);
+  for (int i = 0; i < _num_pending_operations; i++) {
+    if (_pending_operations[i] == op) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void VMThread::remove_pending_operation(int index) {
+  assert_lock_strong(VMOperation_lock);
+  assert(index < _num_pending_operations, "invariant");
+  // Keep the remaining operations in request order.
+  for (int i = index + 1; i < _num_pending_operations; i++) {
+    _pending_operations[i - 1] = _pending_operations[i];
+  }
+  _num_pending_operations--;
+}
+
+bool VMThread::install_pending_operation() {
+  assert_lock_strong(VMOperation_lock);
+  assert(_next_vm_operation == NULL, "Already have an op");
+  if (_num_pending_operations == 0) {
+    return false;
+  }
+  _next_vm_operation = _pending_operations[0];
+  remove_pending_operation(0);
+  return true;
+}
+
 void VMThread::wait_until_executed(VM_Operation* op) {
   MonitorLocker ml(VMOperation_lock,
                    Thread::current()->is_Java_thread() ?
@@ -343,7 +395,14 @@ void VMThread::wait_until_executed(VM_Operation* op) {
   {
     TraceTime timer("Installing VM operation", TRACETIME_LOG(Trace, vmthread));
     while (true) {
-      if (VMThread::vm_thread()->set_next_operation(op)) {
+      // Earlier pending operations go first.
+      if (_num_pending_operations == 0 && VMThread::vm_thread()->set_next_operation(op)) {
+        ml.notify_all();
+        break;
+      }
+      // Let the VM Thread install this operation later, or evaluate it in
+      // the safepoint of the current operation.
+      if (add_pending_operation(op)) {
         ml.notify_all();
         break;
       }
@@ -356,8 +415,9 @@ void VMThread::wait_until_executed(VM_Operation* op) {
     // Wait until the operation has been processed
     TraceTime timer("Waiting for VM operation to be completed", TRACETIME_LOG(Trace, vmthread));
     // _next_vm_operation is cleared holding VMOperation_lock after it has been
-    // executed. We wait until _next_vm_operation is not our op.
-    while (_next_vm_operation == op) {
+    // executed, and pending operations are removed after they have been
+    // executed. We wait until our op is neither of them.
+    while (_next_vm_operation == op || is_pending_operation(op)) {
       // VM Thread can process it once we unlock the mutex on wait.
       ml.wait();
     }
@@ -412,6 +472,7 @@ void VMThread::inner_execute(VM_Operation* op) {
   evaluate_operation(_cur_vm_operation);
 
   if (end_safepoint) {
+    evaluate_pending_operations_at_safepoint(_cur_vm_operation->skip_thread_oop_barriers());
     if (_timeout_task != NULL) {
       _timeout_task->disarm();
     }
@@ -421,6 +482,51 @@ void VMThread::inner_execute(VM_Operation* op) {
   _cur_vm_operation = prev_vm_operation;
 }
 
+// Evaluate the pending safepoint operations in the current safepoint, instead
+// of starting a new safepoint for each of them after the current operation.
+// If the thread oop barriers were skipped when synchronizing, only operations
+// that also skip them can be evaluated.
+void VMThread::evaluate_pending_operations_at_safepoint(bool skipped_thread_oop_barriers) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  VM_Operation* prev_vm_operation = _cur_vm_operation;
+  while (true) {
+    VM_Operation* op = NULL;
+    {
+      MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+      for (int i = 0; i < _num_pending_operations; i++) {
+        VM_Operation* pending = _pending_operations[i];
+        if (pending->evaluate_at_safepoint() &&
+            (!skipped_thread_oop_barriers || pending->skip_thread_oop_barriers())) {
+          op = pending;
+          break;
+        }
+      }
+    }
+    if (op == NULL) {
+      break;
+    }
+
+    _cur_vm_operation = op;
+    {
+      EventMark em("Executing coalesced VM operation: %s", op->name());
+      log_debug(vmthread)("Evaluating coalesced safepoint VM operation: %s", op->name());
+      evaluate_operation(op);
+    }
+
+    // The operation stays pending while it is evaluated so that its
+    // requester keeps waiting. Only the VM Thread removes operations.
+    MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+    for (int i = 0; i < _num_pending_operations; i++) {
+      if (_pending_operations[i] == op) {
+        remove_pending_operation(i);
+        break;
+      }
+    }
+    ml.notify_all();
+  }
+  _cur_vm_operation = prev_vm_operation;
+}
+
 void VMThread::wait_for_operation() {
   assert(Thread::current()->is_VM_thread(), "Must be the VM thread");
   MonitorLocker ml_op_lock(VMOperation_lock, Mutex::_no_safepoint_check_flag);
@@ -436,6 +542,9 @@ void VMThread::wait_for_operation() {
     if (_next_vm_operation != NULL) {
       return;
     }
+    if (install_pending_operation()) {
+      return;
+    }
     if (handshake_alot()) {
       {
         MutexUnlocker mul(VMOperation_lock);
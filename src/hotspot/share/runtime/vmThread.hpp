@@ -71,6 +71,7 @@ class VMThread: public NamedThread {
   static void setup_periodic_safepoint_if_needed();
 
   void evaluate_operation(VM_Operation* op);
+  void evaluate_pending_operations_at_safepoint(bool skipped_thread_oop_barriers);
   void inner_execute(VM_Operation* op);
   void wait_for_operation();
 
@@ -136,6 +137,19 @@ class VMThread: public NamedThread {
 
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
 
+  // Operations requested while _next_vm_operation was already set. A pending
+  // operation is either installed as _next_vm_operation once that is free, or
+  // evaluated in the safepoint of the current operation. All accesses are
+  // protected by the VMOperation_lock.
+  static const int MaxPendingOperations = 16;
+  static VM_Operation* _pending_operations[MaxPendingOperations];
+  static int           _num_pending_operations;
+
+  static bool add_pending_operation(VM_Operation* op);
+  static bool is_pending_operation(VM_Operation* op);
+  static void remove_pending_operation(int index);
+  static bool install_pending_operation();
+
   // Pointer to single-instance of VM thread
   static VMThread*     _vm_thread;
 };
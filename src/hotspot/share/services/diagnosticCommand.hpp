@@ -270,6 +270,20 @@ public:
     virtual void execute(DCmdSource source, TRAPS);
 };
 
+class TrimNativeHeapDCmd : public DCmd {
+public:
+  TrimNativeHeapDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+    static const char* name() { return "System.trim_native_heap"; }
+    static const char* description() {
+      return "Release pooled arena chunks and free C heap memory to the operating system.";
+    }
+    static const char* impact() {
+      return "Medium: Depends on the size of the C heap.";
+    }
+    static int num_arguments() { return 0; }
+    virtual void execute(DCmdSource source, TRAPS);
+};
+
 class RunFinalizationDCmd : public DCmd {
 public:
   RunFinalizationDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -331,6 +345,7 @@ protected:
   DCmdArgument<char*> _filename;
   DCmdArgument<bool>  _all;
   DCmdArgument<jlong> _gzip;
+  DCmdArgument<jlong> _parallel;
 public:
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -357,6 +372,7 @@ public:
 class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _parallel_thread_num;
 public:
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -420,6 +436,30 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ProfileSnapshotDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  ProfileSnapshotDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.profile_snapshot";
+  }
+  static const char* description() {
+    return "Write the invocation and backedge counters of the loaded methods "
+           "to a file, for use with -XX:ProfileSnapshotFile.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded classes.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // See also: thread_dump in attachListener.cpp
 class ThreadDumpDCmd : public DCmdWithParser {
 protected:
@@ -599,6 +639,27 @@ public:
 };
 
 
+class DeoptimizationStatisticsDCmd : public DCmd {
+public:
+  DeoptimizationStatisticsDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "Compiler.deoptimization_statistics";
+  }
+  static const char* description() {
+    return "Print the number of deoptimizations per reason, action and bytecode";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CodeCacheDCmd : public DCmd {
 public:
   CodeCacheDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
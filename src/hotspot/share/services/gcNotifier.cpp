@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "oops/objArrayOop.inline.hpp"
@@ -135,15 +136,13 @@ static Handle createGcInfo(GCMemoryManager *gcManager, GCStatInfo *gcStatInfo,TR
   objArrayOop extra_args_array = oopFactory::new_objArray(SystemDictionary::Integer_klass(), 1, CHECK_NH);
   objArrayHandle extra_array (THREAD, extra_args_array);
 
-  JavaCallArguments argsInt;
-  argsInt.push_int(gcManager->num_gc_threads());
-  Handle extra_arg_val = JavaCalls::construct_new_instance(
-                            SystemDictionary::Integer_klass(),
-                            vmSymbols::int_void_signature(),
-                            &argsInt,
-                            CHECK_NH);
+  // Box the value directly rather than with an upcall to the Integer
+  // constructor; this runs once per GC notification.
+  jvalue num_gc_threads;
+  num_gc_threads.i = gcManager->num_gc_threads();
+  oop extra_arg_val = java_lang_boxing_object::create(T_INT, &num_gc_threads, CHECK_NH);
 
-  extra_array->obj_at_put(0,extra_arg_val());
+  extra_array->obj_at_put(0,extra_arg_val);
 
   InstanceKlass* gcInfoklass = Management::com_sun_management_GcInfo_klass(CHECK_NH);
 
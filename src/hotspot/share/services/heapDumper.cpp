@@ -30,6 +30,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "gc/shared/workgroup.hpp"
@@ -45,6 +46,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/thread.inline.hpp"
@@ -379,10 +381,10 @@ enum {
   INITIAL_CLASS_COUNT = 200
 };
 
-// Supports I/O operations for a dump
-
-class DumpWriter : public StackObj {
- private:
+// Base class of the dump writers. Handles the buffering and the splitting
+// of the heap dump sub-records into dump segments.
+class AbstractDumpWriter : public StackObj {
+ protected:
   enum {
     io_buffer_max_size = 1*M,
     io_buffer_max_waste = 10*K,
@@ -398,9 +400,7 @@ class DumpWriter : public StackObj {
   DEBUG_ONLY(size_t _sub_record_left;) // The bytes not written for the current sub-record.
   DEBUG_ONLY(bool _sub_record_ended;) // True if we have called the end_sub_record().
 
-  CompressionBackend _backend; // Does the actual writing.
-
-  void flush();
+  virtual void flush() = 0;
 
   char* buffer() const                          { return _buffer; }
   size_t buffer_size() const                    { return _size; }
@@ -414,15 +414,15 @@ class DumpWriter : public StackObj {
   bool can_write_fast(size_t len);
 
  public:
-  // Takes ownership of the writer and compressor.
-  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
-
-  ~DumpWriter();
+  AbstractDumpWriter() :
+    _buffer(NULL),
+    _size(0),
+    _pos(0),
+    _in_dump_segment(false) { }
 
   // total number of bytes written to the disk
-  julong bytes_written() const          { return (julong) _backend.get_written(); }
-
-  char const* error() const             { return _backend.error(); }
+  virtual julong bytes_written() const = 0;
+  virtual char const* error() const = 0;
 
   // writer functions
   void write_raw(void* s, size_t len);
@@ -441,28 +441,9 @@ class DumpWriter : public StackObj {
   void end_sub_record();
   // Finishes the current dump segment if not already finished.
   void finish_dump_segment();
-
-  // Called by threads used for parallel writing.
-  void writer_loop()                    { _backend.thread_loop(false); }
-  // Called when finished to release the threads.
-  void deactivate()                     { flush(); _backend.deactivate(); }
 };
 
-// Check for error after constructing the object and destroy it in case of an error.
-DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
-  _buffer(NULL),
-  _size(0),
-  _pos(0),
-  _in_dump_segment(false),
-  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
-  flush();
-}
-
-DumpWriter::~DumpWriter() {
-  flush();
-}
-
-void DumpWriter::write_fast(void* s, size_t len) {
+void AbstractDumpWriter::write_fast(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   assert(buffer_size() - position() >= len, "Must fit");
   debug_only(_sub_record_left -= len);
@@ -471,12 +452,12 @@ void DumpWriter::write_fast(void* s, size_t len) {
   set_position(position() + len);
 }
 
-bool DumpWriter::can_write_fast(size_t len) {
+bool AbstractDumpWriter::can_write_fast(size_t len) {
   return buffer_size() - position() >= len;
 }
 
 // write raw bytes
-void DumpWriter::write_raw(void* s, size_t len) {
+void AbstractDumpWriter::write_raw(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   debug_only(_sub_record_left -= len);
 
@@ -497,38 +478,33 @@ void DumpWriter::write_raw(void* s, size_t len) {
   set_position(position() + len);
 }
 
-// flush any buffered bytes to the file
-void DumpWriter::flush() {
-  _backend.get_new_buffer(&_buffer, &_pos, &_size);
-}
-
 // Makes sure we inline the fast write into the write_u* functions. This is a big speedup.
 #define WRITE_KNOWN_TYPE(p, len) do { if (can_write_fast((len))) write_fast((p), (len)); \
                                       else write_raw((p), (len)); } while (0)
 
-void DumpWriter::write_u1(u1 x) {
+void AbstractDumpWriter::write_u1(u1 x) {
   WRITE_KNOWN_TYPE((void*) &x, 1);
 }
 
-void DumpWriter::write_u2(u2 x) {
+void AbstractDumpWriter::write_u2(u2 x) {
   u2 v;
   Bytes::put_Java_u2((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 2);
 }
 
-void DumpWriter::write_u4(u4 x) {
+void AbstractDumpWriter::write_u4(u4 x) {
   u4 v;
   Bytes::put_Java_u4((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 4);
 }
 
-void DumpWriter::write_u8(u8 x) {
+void AbstractDumpWriter::write_u8(u8 x) {
   u8 v;
   Bytes::put_Java_u8((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 8);
 }
 
-void DumpWriter::write_objectID(oop o) {
+void AbstractDumpWriter::write_objectID(oop o) {
   address a = cast_from_oop<address>(o);
 #ifdef _LP64
   write_u8((u8)a);
@@ -537,7 +513,7 @@ void DumpWriter::write_objectID(oop o) {
 #endif
 }
 
-void DumpWriter::write_symbolID(Symbol* s) {
+void AbstractDumpWriter::write_symbolID(Symbol* s) {
   address a = (address)((uintptr_t)s);
 #ifdef _LP64
   write_u8((u8)a);
@@ -546,7 +522,7 @@ void DumpWriter::write_symbolID(Symbol* s) {
 #endif
 }
 
-void DumpWriter::write_id(u4 x) {
+void AbstractDumpWriter::write_id(u4 x) {
 #ifdef _LP64
   write_u8((u8) x);
 #else
@@ -555,11 +531,11 @@ void DumpWriter::write_id(u4 x) {
 }
 
 // We use java mirror as the class ID
-void DumpWriter::write_classID(Klass* k) {
+void AbstractDumpWriter::write_classID(Klass* k) {
   write_objectID(k->java_mirror());
 }
 
-void DumpWriter::finish_dump_segment() {
+void AbstractDumpWriter::finish_dump_segment() {
   if (_in_dump_segment) {
     assert(_sub_record_left == 0, "Last sub-record not written completely");
     assert(_sub_record_ended, "sub-record must have ended");
@@ -572,12 +548,14 @@ void DumpWriter::finish_dump_segment() {
                          (u4) (position() - dump_segment_header_size));
     }
 
-    flush();
+    // The segment is complete before the flush, so a parallel writer
+    // knows it may hand the buffer on to the shared writer.
     _in_dump_segment = false;
+    flush();
   }
 }
 
-void DumpWriter::start_sub_record(u1 tag, u4 len) {
+void AbstractDumpWriter::start_sub_record(u1 tag, u4 len) {
   if (!_in_dump_segment) {
     if (position() > 0) {
       flush();
@@ -607,20 +585,117 @@ void DumpWriter::start_sub_record(u1 tag, u4 len) {
   write_u1(tag);
 }
 
-void DumpWriter::end_sub_record() {
+void AbstractDumpWriter::end_sub_record() {
   assert(_in_dump_segment, "must be in dump segment");
   assert(_sub_record_left == 0, "sub-record not written completely");
   assert(!_sub_record_ended, "Must not have ended yet");
   debug_only(_sub_record_ended = true);
 }
 
+// Supports I/O operations for a dump
+
+class DumpWriter : public AbstractDumpWriter {
+ private:
+  CompressionBackend _backend; // Does the actual writing.
+
+  virtual void flush();
+
+ public:
+  // Takes ownership of the writer and compressor.
+  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
+
+  ~DumpWriter();
+
+  // total number of bytes written to the disk
+  virtual julong bytes_written() const  { return (julong) _backend.get_written(); }
+
+  virtual char const* error() const     { return _backend.error(); }
+
+  // Called by threads used for parallel writing.
+  void writer_loop()                    { _backend.thread_loop(false); }
+  // Called when finished to release the threads.
+  void deactivate()                     { flush(); _backend.deactivate(); }
+};
+
+// Check for error after constructing the object and destroy it in case of an error.
+DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
+  AbstractDumpWriter(),
+  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
+  flush();
+}
+
+DumpWriter::~DumpWriter() {
+  flush();
+}
+
+// flush any buffered bytes to the file
+void DumpWriter::flush() {
+  _backend.get_new_buffer(&_buffer, &_pos, &_size);
+}
+
+// Buffers the heap dump segments of one parallel dumper thread and hands
+// complete segments to the shared DumpWriter. Since every segment is a
+// self-contained HPROF_HEAP_DUMP_SEGMENT record, segments written by
+// different threads can be interleaved in the dump file.
+class ParDumpWriter : public AbstractDumpWriter {
+ private:
+  DumpWriter* const _backend_writer; // The shared writer of the dump file.
+  Mutex* const      _lock;           // Serializes access to _backend_writer.
+  bool              _holds_lock;     // True while we write a huge sub-record.
+
+  virtual void flush();
+
+ public:
+  ParDumpWriter(DumpWriter* backend_writer, Mutex* lock);
+
+  ~ParDumpWriter();
+
+  virtual julong bytes_written() const  { return _backend_writer->bytes_written(); }
+
+  virtual char const* error() const     { return _backend_writer->error(); }
+};
+
+ParDumpWriter::ParDumpWriter(DumpWriter* backend_writer, Mutex* lock) :
+  AbstractDumpWriter(),
+  _backend_writer(backend_writer),
+  _lock(lock),
+  _holds_lock(false) {
+  _buffer = NEW_C_HEAP_ARRAY(char, io_buffer_max_size, mtInternal);
+  _size = io_buffer_max_size;
+}
+
+ParDumpWriter::~ParDumpWriter() {
+  assert(!_in_dump_segment, "Dump segment must have been finished");
+  flush();
+  assert(!_holds_lock, "Must have released the lock");
+  FREE_C_HEAP_ARRAY(char, _buffer);
+}
+
+void ParDumpWriter::flush() {
+  if (position() > 0) {
+    if (!_holds_lock) {
+      _lock->lock_without_safepoint_check();
+      _holds_lock = true;
+    }
+    _backend_writer->write_raw(buffer(), position());
+    set_position(0);
+  }
+
+  // A huge sub-record is spread over several buffers. Keep the lock until
+  // its segment is finished, so no other dumper can interleave its data.
+  if (_holds_lock && !(_in_dump_segment && _is_huge_sub_record)) {
+    _lock->unlock();
+    _holds_lock = false;
+  }
+}
+
 // Support class with a collection of functions used when dumping the heap
 
 class DumperSupport : AllStatic {
  public:
 
   // write a header of the given type
-  static void write_header(DumpWriter* writer, hprofTag tag, u4 len);
+  static void write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len);
 
   // returns hprof tag for the given type signature
   static hprofTag sig2tag(Symbol* sig);
@@ -633,42 +708,42 @@ class DumperSupport : AllStatic {
   static u4 instance_size(Klass* k);
 
   // dump a jfloat
-  static void dump_float(DumpWriter* writer, jfloat f);
+  static void dump_float(AbstractDumpWriter* writer, jfloat f);
   // dump a jdouble
-  static void dump_double(DumpWriter* writer, jdouble d);
+  static void dump_double(AbstractDumpWriter* writer, jdouble d);
   // dumps the raw value of the given field
-  static void dump_field_value(DumpWriter* writer, char type, oop obj, int offset);
+  static void dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset);
   // returns the size of the static fields; also counts the static fields
   static u4 get_static_fields_size(InstanceKlass* ik, u2& field_count);
   // dumps static fields of the given class
-  static void dump_static_fields(DumpWriter* writer, Klass* k);
+  static void dump_static_fields(AbstractDumpWriter* writer, Klass* k);
   // dump the raw values of the instance fields of the given object
-  static void dump_instance_fields(DumpWriter* writer, oop o);
+  static void dump_instance_fields(AbstractDumpWriter* writer, oop o);
   // get the count of the instance fields for a given class
   static u2 get_instance_fields_count(InstanceKlass* ik);
   // dumps the definition of the instance fields for a given class
-  static void dump_instance_field_descriptors(DumpWriter* writer, Klass* k);
+  static void dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_INSTANCE_DUMP record for the given object
-  static void dump_instance(DumpWriter* writer, oop o);
+  static void dump_instance(AbstractDumpWriter* writer, oop o);
   // creates HPROF_GC_CLASS_DUMP record for the given class and each of its
   // array classes
-  static void dump_class_and_array_classes(DumpWriter* writer, Klass* k);
+  static void dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_CLASS_DUMP record for a given primitive array
   // class (and each multi-dimensional array class too)
-  static void dump_basic_type_array_class(DumpWriter* writer, Klass* k);
+  static void dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k);
 
   // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-  static void dump_object_array(DumpWriter* writer, objArrayOop array);
+  static void dump_object_array(AbstractDumpWriter* writer, objArrayOop array);
   // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-  static void dump_prim_array(DumpWriter* writer, typeArrayOop array);
+  static void dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array);
   // create HPROF_FRAME record for the given method and bci
-  static void dump_stack_frame(DumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
+  static void dump_stack_frame(AbstractDumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
 
   // check if we need to truncate an array
-  static int calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size);
+  static int calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size);
 
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-  static void end_of_dump(DumpWriter* writer);
+  static void end_of_dump(AbstractDumpWriter* writer);
 
   static oop mask_dormant_archived_object(oop o) {
     if (o != NULL && o->klass()->java_mirror() == NULL) {
@@ -682,7 +757,7 @@ class DumperSupport : AllStatic {
 };
 
 // write a header of the given type
-void DumperSupport:: write_header(DumpWriter* writer, hprofTag tag, u4 len) {
+void DumperSupport:: write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len) {
   writer->write_u1((u1)tag);
   writer->write_u4(0);                  // current ticks
   writer->write_u4(len);
@@ -736,7 +811,7 @@ u4 DumperSupport::sig2size(Symbol* sig) {
 }
 
 // dump a jfloat
-void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
+void DumperSupport::dump_float(AbstractDumpWriter* writer, jfloat f) {
   if (g_isnan(f)) {
     writer->write_u4(0x7fc00000);    // collapsing NaNs
   } else {
@@ -750,7 +825,7 @@ void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
 }
 
 // dump a jdouble
-void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
+void DumperSupport::dump_double(AbstractDumpWriter* writer, jdouble d) {
   union {
     jlong l;
     double d;
@@ -765,7 +840,7 @@ void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
 }
 
 // dumps the raw value of the given field
-void DumperSupport::dump_field_value(DumpWriter* writer, char type, oop obj, int offset) {
+void DumperSupport::dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset) {
   switch (type) {
     case JVM_SIGNATURE_CLASS :
     case JVM_SIGNATURE_ARRAY : {
@@ -883,7 +958,7 @@ u4 DumperSupport::get_static_fields_size(InstanceKlass* ik, u2& field_count) {
 }
 
 // dumps static fields of the given class
-void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_static_fields(AbstractDumpWriter* writer, Klass* k) {
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // dump the field descriptors and raw values
@@ -926,7 +1001,7 @@ void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
 }
 
 // dump the raw values of the instance fields of the given object
-void DumperSupport::dump_instance_fields(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance_fields(AbstractDumpWriter* writer, oop o) {
   InstanceKlass* ik = InstanceKlass::cast(o->klass());
 
   for (FieldStream fld(ik, false, false); !fld.eos(); fld.next()) {
@@ -949,7 +1024,7 @@ u2 DumperSupport::get_instance_fields_count(InstanceKlass* ik) {
 }
 
 // dumps the definition of the instance fields for a given class
-void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k) {
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // dump the field descriptors
@@ -964,7 +1039,7 @@ void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k
 }
 
 // creates HPROF_GC_INSTANCE_DUMP record for the given object
-void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance(AbstractDumpWriter* writer, oop o) {
   InstanceKlass* ik = InstanceKlass::cast(o->klass());
   u4 is = instance_size(ik);
   u4 size = 1 + sizeof(address) + 4 + sizeof(address) + 4 + is;
@@ -987,7 +1062,7 @@ void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
 
 // creates HPROF_GC_CLASS_DUMP record for the given class and each of
 // its array classes
-void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k) {
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // We can safepoint and do a heap dump at a point where we have a Klass,
@@ -1076,7 +1151,7 @@ void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
 
 // creates HPROF_GC_CLASS_DUMP record for a given primitive array
 // class (and each multi-dimensional array class too)
-void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k) {
  // array classes
  while (k != NULL) {
     Klass* klass = k;
@@ -1111,7 +1186,7 @@ void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
 
 // Hprof uses an u4 as record length field,
 // which means we need to truncate arrays that are too long.
-int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size) {
+int DumperSupport::calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size) {
   BasicType type = ArrayKlass::cast(array->klass())->element_type();
   assert(type >= T_BOOLEAN && type <= T_OBJECT, "invalid array element type");
 
@@ -1138,7 +1213,7 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
 }
 
 // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
+void DumperSupport::dump_object_array(AbstractDumpWriter* writer, objArrayOop array) {
   // sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID) + sizeof(classID)
   short header_size = 1 + 2 * 4 + 2 * sizeof(address);
   int length = calculate_array_max_length(writer, array, header_size);
@@ -1172,13 +1247,18 @@ void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
   for (int i = 0; i < Length; i++) { writer->write_##Size((Size)Array->Type##_at(i)); }
 
 // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
+void DumperSupport::dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array) {
   BasicType type = TypeArrayKlass::cast(array->klass())->element_type();
 
   // 2 * sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID)
   short header_size = 2 * 1 + 2 * 4 + sizeof(address);
 
   int length = calculate_array_max_length(writer, array, header_size);
+  // Large primitive arrays tend to dominate the size of the dump but are
+  // rarely needed to analyze the object graph, so optionally truncate them.
+  if (HeapDumpMaxPrimitiveArrayLength >= 0) {
+    length = MIN2(length, HeapDumpMaxPrimitiveArrayLength);
+  }
   int type_size = type2aelembytes(type);
   u4 length_in_bytes = (u4)length * type_size;
   u4 size = header_size + length_in_bytes;
@@ -1266,7 +1346,7 @@ void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
 }
 
 // create a HPROF_FRAME record of the given Method* and bci
-void DumperSupport::dump_stack_frame(DumpWriter* writer,
+void DumperSupport::dump_stack_frame(AbstractDumpWriter* writer,
                                      int frame_serial_num,
                                      int class_serial_num,
                                      Method* m,
@@ -1295,10 +1375,10 @@ void DumperSupport::dump_stack_frame(DumpWriter* writer,
 
 class SymbolTableDumper : public SymbolClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  SymbolTableDumper(DumpWriter* writer)     { _writer = writer; }
+  SymbolTableDumper(AbstractDumpWriter* writer) { _writer = writer; }
   void do_symbol(Symbol** p);
 };
 
@@ -1318,12 +1398,12 @@ void SymbolTableDumper::do_symbol(Symbol** p) {
 
 class JNILocalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
   u4 _thread_serial_num;
   int _frame_num;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  JNILocalsDumper(DumpWriter* writer, u4 thread_serial_num) {
+  JNILocalsDumper(AbstractDumpWriter* writer, u4 thread_serial_num) {
     _writer = writer;
     _thread_serial_num = thread_serial_num;
     _frame_num = -1;  // default - empty stack
@@ -1352,11 +1432,11 @@ void JNILocalsDumper::do_oop(oop* obj_p) {
 
 class JNIGlobalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
 
  public:
-  JNIGlobalsDumper(DumpWriter* writer) {
+  JNIGlobalsDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_oop(oop* obj_p);
@@ -1383,10 +1463,10 @@ void JNIGlobalsDumper::do_oop(oop* obj_p) {
 
 class StickyClassDumper : public KlassClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  StickyClassDumper(DumpWriter* writer) {
+  StickyClassDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_klass(Klass* k) {
@@ -1408,13 +1488,13 @@ class VM_HeapDumper;
 class HeapObjectDumper : public ObjectClosure {
  private:
   VM_HeapDumper* _dumper;
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
 
   VM_HeapDumper* dumper()               { return _dumper; }
-  DumpWriter* writer()                  { return _writer; }
+  AbstractDumpWriter* writer()          { return _writer; }
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
+  HeapObjectDumper(VM_HeapDumper* dumper, AbstractDumpWriter* writer) {
     _dumper = dumper;
     _writer = writer;
   }
@@ -1448,6 +1528,60 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Coordinates the VM thread with the worker threads helping it to walk the
+// heap in a parallel heap dump. The workers must not start dumping objects
+// before the VM thread has written the records preceding the heap objects,
+// and the VM thread must not write the records following them before all
+// workers are done.
+class DumperController : public CHeapObj<mtInternal> {
+ private:
+  bool     _started;
+  Monitor* _lock;
+  uint     _dumper_number;
+  uint     _complete_number;
+
+ public:
+  DumperController(uint number) :
+    _started(false),
+    _lock(new (std::nothrow) PaddedMonitor(Mutex::leaf, "Dumper Controller lock",
+                                           true, Mutex::_safepoint_check_never)),
+    _dumper_number(number),
+    _complete_number(0) { }
+
+  ~DumperController() { delete _lock; }
+
+  bool is_valid() const { return _lock != NULL; }
+
+  void wait_for_start_signal() {
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    while (!_started) {
+      ml.wait();
+    }
+  }
+
+  void start_dump() {
+    assert(!_started, "start dump with started set");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    _started = true;
+    ml.notify_all();
+  }
+
+  void dumper_complete() {
+    assert(_started, "dumper complete before start");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    _complete_number++;
+    ml.notify();
+  }
+
+  void wait_all_dumpers_complete() {
+    assert(_started, "wait for dumpers before start");
+    MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+    while (_complete_number != _dumper_number) {
+      ml.wait();
+    }
+  }
+};
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
  private:
@@ -1461,6 +1595,12 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   ThreadStackTrace** _stack_traces;
   int _num_threads;
 
+  // parallel heap dump support
+  uint                    _num_dumper_threads;
+  ParallelObjectIterator* _poi;
+  DumperController*       _dumper_controller;
+  Mutex*                  _par_writer_lock;
+
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != NULL, "Error"); return _global_dumper; }
   static DumpWriter* writer()            {  assert(_global_writer != NULL, "Error"); return _global_writer; }
@@ -1500,8 +1640,16 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // HPROF_GC_INSTANCE_DUMP, HPROF_GC_OBJ_ARRAY_DUMP and HPROF_GC_PRIM_ARRAY_DUMP
+  // records, written by the given dumper thread of a parallel heap dump
+  void dump_heap_objects(uint dumper_id);
+
+  bool is_parallel_dump() const { return _num_dumper_threads > 1; }
+  void prepare_parallel_dump(uint num_active_workers);
+  void finish_parallel_dump();
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1512,6 +1660,10 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
     _klass_map = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, mtServiceability);
     _stack_traces = NULL;
     _num_threads = 0;
+    _num_dumper_threads = MAX2(num_dump_threads, 1u);
+    _poi = NULL;
+    _dumper_controller = NULL;
+    _par_writer_lock = NULL;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -1549,7 +1701,7 @@ bool VM_HeapDumper::skip_operation() const {
 }
 
 // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-void DumperSupport::end_of_dump(DumpWriter* writer) {
+void DumperSupport::end_of_dump(AbstractDumpWriter* writer) {
   writer->finish_dump_segment();
 
   writer->write_u1(HPROF_HEAP_DUMP_END);
@@ -1771,9 +1923,12 @@ void VM_HeapDumper::doit() {
   WorkGang* gang = ch->safepoint_workers();
 
   if (gang == NULL) {
+    _num_dumper_threads = 1;
     work(0);
   } else {
+    prepare_parallel_dump(gang->active_workers());
     gang->run_task(this, gang->active_workers(), true);
+    finish_parallel_dump();
   }
 
   // Now we clear the global variables, so that a future dumper can run.
@@ -1781,8 +1936,54 @@ void VM_HeapDumper::doit() {
   clear_global_writer();
 }
 
+// The VM thread is always dumper 0 and writes all records but the heap
+// objects. In a parallel dump the first _num_dumper_threads - 1 gang workers
+// help it to dump the heap objects and then turn into compression threads
+// like the remaining gang workers.
+void VM_HeapDumper::prepare_parallel_dump(uint num_active_workers) {
+  _num_dumper_threads = MIN2(_num_dumper_threads, num_active_workers + 1);
+  if (!is_parallel_dump()) {
+    return;
+  }
+
+  _poi = Universe::heap()->parallel_object_iterator(_num_dumper_threads);
+  _dumper_controller = new DumperController(_num_dumper_threads - 1);
+  // Ranked above the compression backend lock, which is taken while held.
+  _par_writer_lock = new (std::nothrow) PaddedMutex(Mutex::nonleaf, "Parallel HProf writer lock",
+                                                    true, Mutex::_safepoint_check_never);
+
+  if (_poi == NULL || !_dumper_controller->is_valid() || _par_writer_lock == NULL) {
+    // The GC does not support parallel object iteration or we ran out of
+    // memory. Fall back to a serial dump.
+    finish_parallel_dump();
+    _num_dumper_threads = 1;
+  }
+}
+
+void VM_HeapDumper::finish_parallel_dump() {
+  delete _poi;
+  delete _dumper_controller;
+  delete _par_writer_lock;
+  _poi = NULL;
+  _dumper_controller = NULL;
+  _par_writer_lock = NULL;
+}
+
+void VM_HeapDumper::dump_heap_objects(uint dumper_id) {
+  assert(is_parallel_dump(), "only used by parallel heap dump");
+  ParDumpWriter local_writer(writer(), _par_writer_lock);
+  HeapObjectDumper obj_dumper(this, &local_writer);
+  _poi->object_iterate(&obj_dumper, dumper_id);
+  local_writer.finish_dump_segment();
+}
+
 void VM_HeapDumper::work(uint worker_id) {
   if (!Thread::current()->is_VM_thread()) {
+    if (worker_id < _num_dumper_threads - 1) {
+      _dumper_controller->wait_for_start_signal();
+      dump_heap_objects(worker_id + 1);
+      _dumper_controller->dumper_complete();
+    }
     writer()->writer_loop();
     return;
   }
@@ -1825,8 +2026,16 @@ void VM_HeapDumper::work(uint worker_id) {
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->object_iterate(&obj_dumper);
+  if (is_parallel_dump()) {
+    // The dumpers append their own dump segments, so close the current one.
+    writer()->finish_dump_segment();
+    _dumper_controller->start_dump();
+    dump_heap_objects(0);
+    _dumper_controller->wait_all_dumpers_complete();
+  } else {
+    HeapObjectDumper obj_dumper(this, writer());
+    Universe::heap()->object_iterate(&obj_dumper);
+  }
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
@@ -1907,7 +2116,7 @@ void VM_HeapDumper::dump_stack_traces() {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, uint num_dump_threads) {
   assert(path != NULL && strlen(path) > 0, "path missing");
 
   // print message in interactive case
@@ -1942,7 +2151,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression) {
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -34,7 +34,14 @@
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, false);    // don't replace existing file
+  if (os::is_fifo_file(_path)) {
+    // Allow streaming the dump to a reader of an existing named pipe (for
+    // example an uploader), so it never has to be stored on local disk.
+    // Do not follow a symbolic link planted in place of the pipe.
+    _fd = os::open(_path, O_WRONLY NOT_WINDOWS(| O_NOFOLLOW), 0);
+  } else {
+    _fd = os::create_binary_file(_path, false);    // don't replace existing file
+  }
 
   if (_fd < 0) {
     return os::strerror(errno);
@@ -54,10 +61,18 @@ char const* FileWriter::write_buf(char* buf, ssize_t size) {
   assert(_fd >= 0, "Must be open");
   assert(size > 0, "Must write at least one byte");
 
-  ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
+  // A pipe can accept fewer bytes than requested, so loop until all the
+  // data is written. A slow reader blocks the writer thread here, which
+  // gives natural backpressure on the dumping threads.
+  while (size > 0) {
+    ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
 
-  if (n <= 0) {
-    return os::strerror(errno);
+    if (n <= 0) {
+      return os::strerror(errno);
+    }
+
+    buf += n;
+    size -= n;
   }
 
   return NULL;
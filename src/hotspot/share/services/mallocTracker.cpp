@@ -28,6 +28,7 @@
 #include "services/mallocTracker.inline.hpp"
 #include "services/memTracker.hpp"
 
+ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE)
 size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
 // Total malloc'd memory amount
@@ -36,10 +37,22 @@ size_t MallocMemorySnapshot::total() const {
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += malloc_overhead() + total_arena();
   return amount;
 }
 
+size_t MallocMemorySnapshot::malloc_overhead() const {
+  // Every tracked malloc carries exactly one header. Thread stacks are
+  // accounted as mallocs, but are not allocated through os::malloc.
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    if (index != NMTUtil::flag_to_index(mtThreadStack)) {
+      count += _malloc[index].malloc_count();
+    }
+  }
+  return count * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory used by arenas
 size_t MallocMemorySnapshot::total_arena() const {
   size_t amount = 0;
@@ -54,7 +67,8 @@ size_t MallocMemorySnapshot::total_arena() const {
 void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
   int chunk_idx = NMTUtil::flag_to_index(mtChunk);
-  _malloc[chunk_idx].record_free(arena_size);
+  // Only the size is adjusted, the chunks are still individual mallocs.
+  _malloc[chunk_idx].record_malloc_size_change(-(ssize_t)arena_size);
 }
 
 
@@ -69,7 +83,6 @@ void MallocHeader::release() const {
   if (MemTracker::tracking_level() <= NMT_minimal) return;
 
   MallocMemorySummary::record_free(size(), flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
@@ -28,6 +28,7 @@
 #if INCLUDE_NMT
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/nmtCommon.hpp"
@@ -106,6 +107,10 @@ class MallocMemory {
     _malloc.deallocate(sz);
   }
 
+  inline void record_malloc_size_change(ssize_t sz) {
+    _malloc.resize(sz);
+  }
+
   inline void record_new_arena() {
     _arena.allocate(0);
   }
@@ -135,8 +140,9 @@ class MallocMemorySnapshot : public ResourceObj {
   friend class MallocMemorySummary;
 
  private:
-  MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _tracking_header;
+  // Counters of different memory types are updated concurrently by
+  // unrelated threads; keep them on separate cache lines.
+  PaddedEnd<MallocMemory> _malloc[mt_number_of_types];
 
 
  public:
@@ -145,9 +151,10 @@ class MallocMemorySnapshot : public ResourceObj {
     return &_malloc[index];
   }
 
-  inline MemoryCounter* malloc_overhead() {
-    return &_tracking_header;
-  }
+  // Memory used by malloc tracking headers. It is derived from the malloc
+  // counts instead of being counted separately, which would add another
+  // pair of atomic updates of a single shared counter to every malloc and free.
+  size_t malloc_overhead() const;
 
   // Total malloc'd memory amount
   size_t total() const;
@@ -164,7 +171,6 @@ class MallocMemorySnapshot : public ResourceObj {
     // copy is going on, because their size is adjusted using this
     // buffer in make_adjustment().
     ThreadCritical tc;
-    s->_tracking_header = _tracking_header;
     for (int index = 0; index < mt_number_of_types; index ++) {
       s->_malloc[index] = _malloc[index];
     }
@@ -180,7 +186,9 @@ class MallocMemorySnapshot : public ResourceObj {
  */
 class MallocMemorySummary : AllStatic {
  private:
-  // Reserve memory for placement of MallocMemorySnapshot object
+  // Reserve memory for placement of MallocMemorySnapshot object, aligned
+  // so that the padded per-type counters start on cache line boundaries
+  ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE)
   static size_t _snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
  public:
@@ -211,18 +219,9 @@ class MallocMemorySummary : AllStatic {
      s->make_adjustment();
    }
 
-   // Record memory used by malloc tracking header
-   static inline void record_new_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->allocate(sz);
-   }
-
-   static inline void record_free_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->deallocate(sz);
-   }
-
    // The memory used by malloc tracking headers
    static inline size_t tracking_overhead() {
-     return as_snapshot()->malloc_overhead()->size();
+     return as_snapshot()->malloc_overhead();
    }
 
   static MallocMemorySnapshot* as_snapshot() {
@@ -277,7 +276,6 @@ class MallocHeader {
     }
 
     MallocMemorySummary::record_malloc(size, flags);
-    MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader));
   }
 
   inline size_t   size()  const { return _size; }
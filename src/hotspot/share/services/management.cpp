@@ -1710,6 +1710,14 @@ JVM_END
 static Handle find_deadlocks(bool object_monitors_only, TRAPS) {
   ResourceMark rm(THREAD);
 
+  {
+    // Skip the safepoint when no thread is blocked at all.
+    ThreadsListHandle tlh;
+    if (!ThreadService::may_have_deadlocks(tlh.list(), !object_monitors_only)) {
+      return Handle();
+    }
+  }
+
   VM_FindDeadlocks op(!object_monitors_only /* also check concurrent locks? */);
   VMThread::execute(&op);
 
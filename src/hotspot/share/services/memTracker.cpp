@@ -26,6 +26,7 @@
 
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/memBaseline.hpp"
@@ -96,6 +97,17 @@ void MemTracker::init() {
   }
 }
 
+// Each thread counts its own mallocs, so the counter is neither raced on nor
+// shared between threads. Mallocs without a current Thread, e.g. during
+// startup or from unattached native threads, always record their stack.
+bool MemTracker::sample_call_stack_slow() {
+  Thread* thread = Thread::current_or_null_safe();
+  if (thread == NULL) {
+    return true;
+  }
+  return (thread->inc_nmt_stack_sample_counter() % NativeMemoryTrackingStackSampleInterval) == 0;
+}
+
 bool MemTracker::check_launcher_nmt_support(const char* value) {
   if (strcmp(value, "=detail") == 0) {
     if (MemTracker::tracking_level() != NMT_detail) {
@@ -33,6 +33,8 @@
 
 #define CURRENT_PC   NativeCallStack::empty_stack()
 #define CALLER_PC    NativeCallStack::empty_stack()
+#define MALLOC_CURRENT_PC   NativeCallStack::empty_stack()
+#define MALLOC_CALLER_PC    NativeCallStack::empty_stack()
 
 class Tracker : public StackObj {
  public:
@@ -58,6 +60,7 @@ class MemTracker : AllStatic {
     const NativeCallStack& stack, NMT_TrackingLevel level) { return mem_base; }
   static inline size_t malloc_header_size(NMT_TrackingLevel level) { return 0; }
   static inline size_t malloc_header_size(void* memblock) { return 0; }
+  static inline size_t malloc_size(void* memblock, NMT_TrackingLevel level) { return 0; }
   static inline void* malloc_base(void* memblock) { return memblock; }
   static inline void* record_free(void* memblock, NMT_TrackingLevel level) { return memblock; }
 
@@ -80,6 +83,7 @@ class MemTracker : AllStatic {
 
 #else
 
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/mallocTracker.hpp"
@@ -91,6 +95,13 @@ class MemTracker : AllStatic {
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1, true) : NativeCallStack::empty_stack())
 
+// Like CURRENT_PC and CALLER_PC, for malloc sites. Only these are subject to
+// NativeMemoryTrackingStackSampleInterval.
+#define MALLOC_CURRENT_PC ((MemTracker::tracking_level() == NMT_detail && MemTracker::sample_call_stack()) ? \
+                           NativeCallStack(0, true) : NativeCallStack::empty_stack())
+#define MALLOC_CALLER_PC  ((MemTracker::tracking_level() == NMT_detail && MemTracker::sample_call_stack()) ? \
+                           NativeCallStack(1, true) : NativeCallStack::empty_stack())
+
 class MemBaseline;
 
 // Tracker is used for guarding 'release' semantics of virtual memory operation, to avoid
@@ -173,6 +184,15 @@ class MemTracker : AllStatic {
     return 0;
   }
 
+  // Size of a malloc'ed block, or 0 if it has no malloc tracking header
+  // at this tracking level
+  static inline size_t malloc_size(void* memblock, NMT_TrackingLevel level) {
+    if (memblock == NULL || level == NMT_off) {
+      return 0;
+    }
+    return MallocTracker::get_size(memblock);
+  }
+
   // To malloc base address, which is the starting address
   // of malloc tracking header if tracking is enabled.
   // Otherwise, it returns the same address.
@@ -304,11 +324,18 @@ class MemTracker : AllStatic {
     return _cmdline_tracking_level;
   }
 
+  // In detail mode, whether the call stack of the current malloc should
+  // be walked and recorded, see NativeMemoryTrackingStackSampleInterval.
+  static inline bool sample_call_stack() {
+    return NativeMemoryTrackingStackSampleInterval <= 1 || sample_call_stack_slow();
+  }
+
   static void tuning_statistics(outputStream* out);
 
  private:
   static NMT_TrackingLevel init_tracking_level();
   static void report(bool summary_only, outputStream* output);
+  static bool sample_call_stack_slow();
 
  private:
   // Tracking level
@@ -362,6 +362,26 @@ void ThreadService::reset_contention_time_stat(JavaThread* thread) {
   }
 }
 
+// Cheap check, without a safepoint, whether find_deadlocks_at_safepoint()
+// could find anything. Every thread on a deadlock cycle is permanently
+// blocked with a pending monitor, a pending raw monitor or (if
+// concurrent_locks is true) a park blocker set, so if no thread has any of
+// these there can be no deadlock and the safepoint can be skipped.
+bool ThreadService::may_have_deadlocks(ThreadsList * t_list, bool concurrent_locks) {
+  assert(Thread::current()->is_Java_thread() &&
+         Thread::current()->as_Java_thread()->thread_state() == _thread_in_vm,
+         "must be in VM to read park blockers");
+  JavaThreadIterator jti(t_list);
+  for (JavaThread* jt = jti.first(); jt != NULL; jt = jti.next()) {
+    if (jt->current_pending_monitor() != NULL ||
+        jt->current_pending_raw_monitor() != NULL ||
+        (concurrent_locks && jt->current_park_blocker() != NULL)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Find deadlocks involving raw monitors, object monitors and concurrent locks
 // if concurrent_locks is true.
 DeadlockCycle* ThreadService::find_deadlocks_at_safepoint(ThreadsList * t_list, bool concurrent_locks) {
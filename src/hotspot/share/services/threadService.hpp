@@ -113,6 +113,7 @@ public:
   static void   reset_contention_time_stat(JavaThread* thread);
 
   static DeadlockCycle*       find_deadlocks_at_safepoint(ThreadsList * t_list, bool object_monitors_only);
+  static bool                 may_have_deadlocks(ThreadsList * t_list, bool concurrent_locks);
 
   static void   metadata_do(void f(Metadata*));
 };
@@ -25,6 +25,57 @@
 #include "precompiled.hpp"
 #include "utilities/utf8.hpp"
 
+// The ASCII fast paths below check a word of characters at a time. The
+// strings have no particular alignment, so words are loaded with memcpy.
+static const uint64_t ascii_byte_high_bits = UCONST64(0x8080808080808080);
+static const uint64_t ascii_byte_low_bits  = UCONST64(0x0101010101010101);
+static const uint64_t ascii_char_high_bits = UCONST64(0xFF80FF80FF80FF80);
+static const uint64_t ascii_char_low_bits  = UCONST64(0x0001000100010001);
+
+static inline uint64_t load_word(const void* p) {
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+  return w;
+}
+
+// Are all bytes of the word in 0x00-0x7F?
+static inline bool is_ascii_word(const char* str) {
+  return (load_word(str) & ascii_byte_high_bits) == 0;
+}
+
+// Returns the length of the prefix of characters in 0x01-0x7F, which are
+// encoded as a single byte in (modified) UTF-8. A zero character borrows
+// from its lane when subtracting the low bits, setting the high bit.
+static int ascii_prefix_length(const jbyte* base, int length) {
+  const int chars_per_word = (int)(sizeof(uint64_t) / sizeof(jbyte));
+  int index = 0;
+  for (; index + chars_per_word <= length; index += chars_per_word) {
+    uint64_t w = load_word(base + index);
+    if (((w | (w - ascii_byte_low_bits)) & ascii_byte_high_bits) != 0) {
+      break;
+    }
+  }
+  while (index < length && base[index] >= 0x01) {
+    index++;
+  }
+  return index;
+}
+
+static int ascii_prefix_length(const jchar* base, int length) {
+  const int chars_per_word = (int)(sizeof(uint64_t) / sizeof(jchar));
+  int index = 0;
+  for (; index + chars_per_word <= length; index += chars_per_word) {
+    uint64_t w = load_word(base + index);
+    if (((w | (w - ascii_char_low_bits)) & ascii_char_high_bits) != 0) {
+      break;
+    }
+  }
+  while (index < length && base[index] >= 0x0001 && base[index] <= 0x007F) {
+    index++;
+  }
+  return index;
+}
+
 // Assume the utf8 string is in legal form and has been
 // checked in the class file parser/format checker.
 template<typename T> char* UTF8::next(const char* str, T* value) {
@@ -103,6 +154,12 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
   unsigned char prev = 0;
   for (int i = 0; i < len; i++) {
     unsigned char c = str[i];
+    if (c < 0x80 && i + (int)sizeof(uint64_t) <= len && is_ascii_word(str + i)) {
+      // A word of ASCII has no continuation bytes.
+      i += sizeof(uint64_t) - 1;
+      prev = str[i];
+      continue;
+    }
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
       has_multibyte = true;
@@ -172,6 +229,12 @@ template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unic
   int index = 0;
 
   /* ASCII case loop optimization */
+  for (; index + (int)sizeof(uint64_t) <= unicode_length && is_ascii_word(ptr); index += sizeof(uint64_t)) {
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+      unicode_str[index + i] = (T)(unsigned char)ptr[i];
+    }
+    ptr += sizeof(uint64_t);
+  }
   for (; index < unicode_length; index++) {
     if((ch = ptr[0]) > 0x7F) { break; }
     unicode_str[index] = (T)ch;
@@ -427,8 +490,8 @@ int UNICODE::utf8_size(jbyte c) {
 
 template<typename T>
 int UNICODE::utf8_length(const T* base, int length) {
-  int result = 0;
-  for (int index = 0; index < length; index++) {
+  int result = ascii_prefix_length(base, length);
+  for (int index = result; index < length; index++) {
     T c = base[index];
     result += utf8_size(c);
   }
@@ -448,7 +511,14 @@ char* UNICODE::as_utf8(const T* base, int& length) {
 
 char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  // Copy the ASCII prefix that fits, one byte per character.
+  int index = MIN2(ascii_prefix_length(base, length), MAX2(buflen - 1, 0));
+  for (int i = 0; i < index; i++) {
+    p[i] = (u_char)base[i];
+  }
+  p += index;
+  buflen -= index;
+  for (; index < length; index++) {
     jchar c = base[index];
     buflen -= utf8_size(c);
     if (buflen <= 0) break; // string is truncated
@@ -460,7 +530,12 @@ char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
 
 char* UNICODE::as_utf8(const jbyte* base, int length, char* buf, int buflen) {
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  // Copy the ASCII prefix that fits (UTF-8 is ASCII compatible)
+  int index = MIN2(ascii_prefix_length(base, length), MAX2(buflen - 1, 0));
+  memcpy(p, base, index);
+  p += index;
+  buflen -= index;
+  for (; index < length; index++) {
     jbyte c = base[index];
     int sz = utf8_size(c);
     buflen -= sz;
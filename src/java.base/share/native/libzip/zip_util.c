@@ -562,6 +562,34 @@ countCENHeaders(unsigned char *beg, unsigned char *end)
     return count;
 }
 
+/*
+ * Grows zip->entries to hold total entries and rebuilds zip->table for
+ * the first count entries, whose hashes are already known.
+ * Returns non-zero in case of allocation error.
+ */
+static int
+growCEN(jzfile *zip, jint count, jint total)
+{
+    jint i;
+    const jint tablelen = ((total/2) | 1); // Odd -> fewer collisions
+    jzcell *entries = realloc(zip->entries, total * sizeof(entries[0]));
+    jint *table;
+    if (entries == NULL && total != 0) return -1;
+    zip->entries = entries;
+    free(zip->table);
+    table = zip->table = malloc(tablelen * sizeof(table[0]));
+    if (table == NULL) return -1;
+    zip->tablelen = tablelen;
+    for (i = 0; i < tablelen; i++)
+        table[i] = ZIP_ENDCHAIN;
+    for (i = 0; i < count; i++) {
+        unsigned int hsh = entries[i].hash % tablelen;
+        entries[i].next = table[hsh];
+        table[hsh] = i;
+    }
+    return 0;
+}
+
 #define ZIP_FORMAT_ERROR(message) \
 if (1) { zip->msg = message; goto Catch; } else ((void)0)
 
@@ -569,10 +597,9 @@ if (1) { zip->msg = message; goto Catch; } else ((void)0)
  * Reads zip file central directory. Returns the file position of first
  * CEN header, otherwise returns -1 if an error occurred. If zip->msg != NULL
  * then the error was a zip format error and zip->msg has the error text.
- * Always pass in -1 for knownTotal; it's used for a recursive call.
  */
 static jlong
-readCEN(jzfile *zip, jint knownTotal)
+readCEN(jzfile *zip)
 {
     /* Following are unsigned 32-bit */
     jlong endpos, end64pos, cenpos, cenlen, cenoff;
@@ -584,6 +611,7 @@ readCEN(jzfile *zip, jint knownTotal)
 #ifdef USE_MMAP
     static jlong pagesize;
     jlong offset;
+    void* mappedAddr;
 #endif
     unsigned char endbuf[ENDHDR];
     jint endhdrlen = ENDHDR;
@@ -647,24 +675,22 @@ readCEN(jzfile *zip, jint knownTotal)
         } else {
             offset = 0;
         }
-        /* When we are not calling recursively, knownTotal is -1. */
-        if (knownTotal == -1) {
-            void* mappedAddr;
-            /* Mmap the CEN and END part only. We have to figure
-               out the page size in order to make offset to be multiples of
-               page size.
-            */
-            zip->mlen = cenpos - offset + cenlen + endhdrlen;
-            zip->offset = offset;
-            mappedAddr = mmap64(0, zip->mlen, PROT_READ, MAP_SHARED, zip->zfd, (off64_t) offset);
-            zip->maddr = (mappedAddr == (void*) MAP_FAILED) ? NULL :
-                (unsigned char*)mappedAddr;
-
-            if (zip->maddr == NULL) {
-                jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
-                goto Catch;
-            }
+        /* Mmap the CEN and END part only. We have to figure
+           out the page size in order to make offset to be multiples of
+           page size.
+        */
+        zip->mlen = cenpos - offset + cenlen + endhdrlen;
+        zip->offset = offset;
+        mappedAddr = mmap64(0, zip->mlen, PROT_READ, MAP_SHARED, zip->zfd, (off64_t) offset);
+        zip->maddr = (mappedAddr == (void*) MAP_FAILED) ? NULL :
+            (unsigned char*)mappedAddr;
+
+        if (zip->maddr == NULL) {
+            jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
+            goto Catch;
         }
+        /* The whole CEN is read right below, fault it in ahead of the scan. */
+        madvise(mappedAddr, zip->mlen, MADV_WILLNEED);
         cenbuf = zip->maddr + cenpos - offset;
     } else
 #endif
@@ -680,14 +706,13 @@ readCEN(jzfile *zip, jint knownTotal)
      * of central directory entries as stored in ENDTOT.  Since this
      * is a 2-byte field, but we (and other zip implementations)
      * support approx. 2**31 entries, we do not trust ENDTOT, but
-     * treat it only as a strong hint.  When we call ourselves
-     * recursively, knownTotal will have the "true" value.
+     * treat it only as a strong hint; the tables are grown when
+     * more headers are found.
      *
      * Keep this path alive even with the Zip64 END support added, just
      * for zip files that have more than 0xffff entries but don't have
      * the Zip64 enabled.
      */
-    total = (knownTotal != -1) ? knownTotal : total;
     entries  = zip->entries  = calloc(total, sizeof(entries[0]));
     tablelen = zip->tablelen = ((total/2) | 1); // Odd -> fewer collisions
     table    = zip->table    = malloc(tablelen * sizeof(table[0]));
@@ -707,9 +732,14 @@ readCEN(jzfile *zip, jint knownTotal)
         if (i >= total) {
             /* This will only happen if the zip file has an incorrect
              * ENDTOT field, which usually means it contains more than
-             * 65535 entries. */
-            cenpos = readCEN(zip, countCENHeaders(cenbuf, cenend));
-            goto Finally;
+             * 65535 entries. Size the tables for the real number of
+             * headers and rehash the entries seen so far, rather than
+             * parsing the whole central directory a second time. */
+            total = i + countCENHeaders(cp, cenend);
+            if (growCEN(zip, i, total) != 0) goto Catch;
+            entries  = zip->entries;
+            table    = zip->table;
+            tablelen = zip->tablelen;
         }
 
         method = CENHOW(cp);
@@ -890,7 +920,7 @@ ZIP_Put_In_Cache0(const char *name, ZFILE zfd, char **pmsg, jlong lastModified,
     }
 
     zip->zfd = zfd;
-    if (readCEN(zip, -1) < 0) {
+    if (readCEN(zip) < 0) {
         /* An error occurred while trying to read the zip file */
         if (pmsg != 0) {
             /* Set the zip error message */
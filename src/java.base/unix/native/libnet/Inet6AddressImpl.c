@@ -223,8 +223,11 @@ Java_java_net_Inet6AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
 
     // try once, with our static buffer
     memset(&hints, 0, sizeof(hints));
-    hints.ai_flags = AI_CANONNAME;
     hints.ai_family = AF_UNSPEC;
+    // One entry per address is enough: without a socket type getaddrinfo
+    // returns a copy for each of SOCK_STREAM/DGRAM/RAW, which would only
+    // be dropped again below. The canonical name is never used.
+    hints.ai_socktype = SOCK_STREAM;
 
     error = getaddrinfo(hostname, NULL, &hints, &res);
 
@@ -31,11 +31,9 @@
 #include <assert.h>
 #include <sys/mman.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
-
-#ifdef _AIX
 #include <unistd.h>
-#endif
 
 /* Output type for mincore(2) */
 #ifdef __linux__
@@ -44,62 +42,55 @@ typedef unsigned char mincore_vec_t;
 typedef char mincore_vec_t;
 #endif
 
-#ifdef _AIX
-static long calculate_number_of_pages_in_range(void* address, size_t len, size_t pagesize) {
-    uintptr_t address_unaligned = (uintptr_t) address;
-    uintptr_t address_aligned = address_unaligned & (~(pagesize - 1));
-    size_t len2 = len + (address_unaligned - address_aligned);
-    long numPages = (len2 + pagesize - 1) / pagesize;
-    return numPages;
-}
-#endif
+/* Number of pages queried per mincore(2) call.  The residency vector for a
+ * chunk lives on the stack, so large mappings need no heap allocation and
+ * the scan stops at the first chunk with a page that is not resident. */
+#define MINCORE_CHUNK_PAGES 4096
 
 JNIEXPORT jboolean JNICALL
 Java_java_nio_MappedMemoryUtils_isLoaded0(JNIEnv *env, jobject obj, jlong address,
                                          jlong len, jint numPages)
 {
-    jboolean loaded = JNI_TRUE;
     int result = 0;
-    int i = 0;
-    void *a = (void *) jlong_to_ptr(address);
-    mincore_vec_t* vec = NULL;
-
-#ifdef _AIX
-    /* See JDK-8186665 */
-    size_t pagesize = (size_t)sysconf(_SC_PAGESIZE);
-    if ((long)pagesize == -1) {
-        return JNI_FALSE;
-    }
-    numPages = (jint) calculate_number_of_pages_in_range(a, len, pagesize);
-#endif
-
+    size_t i = 0;
+    uintptr_t a = (uintptr_t) jlong_to_ptr(address);
+    uintptr_t end = a + (size_t)len;
     /* Include space for one sentinel byte at the end of the buffer
      * to catch overflows. */
-    vec = (mincore_vec_t*) malloc(numPages + 1);
+    mincore_vec_t vec[MINCORE_CHUNK_PAGES + 1];
+    size_t pagesize = (size_t)sysconf(_SC_PAGESIZE);
 
-    if (vec == NULL) {
-        JNU_ThrowOutOfMemoryError(env, NULL);
+    if ((long)pagesize == -1) {
         return JNI_FALSE;
     }
+    /* See JDK-8186665: count pages from the containing page boundary. */
+    a &= ~(pagesize - 1);
 
-    vec[numPages] = '\x7f'; /* Write sentinel. */
-    result = mincore(a, (size_t)len, vec);
-    assert(vec[numPages] == '\x7f'); /* Check sentinel. */
+    while (a < end) {
+        size_t chunk_len = (size_t)(end - a);
+        size_t chunk_pages;
+        if (chunk_len > (size_t)MINCORE_CHUNK_PAGES * pagesize) {
+            chunk_len = (size_t)MINCORE_CHUNK_PAGES * pagesize;
+        }
+        chunk_pages = (chunk_len + pagesize - 1) / pagesize;
 
-    if (result == -1) {
-        JNU_ThrowIOExceptionWithLastError(env, "mincore failed");
-        free(vec);
-        return JNI_FALSE;
-    }
+        vec[chunk_pages] = '\x7f'; /* Write sentinel. */
+        result = mincore((void *)a, chunk_len, vec);
+        assert(vec[chunk_pages] == '\x7f'); /* Check sentinel. */
+
+        if (result == -1) {
+            JNU_ThrowIOExceptionWithLastError(env, "mincore failed");
+            return JNI_FALSE;
+        }
 
-    for (i=0; i<numPages; i++) {
-        if (vec[i] == 0) {
-            loaded = JNI_FALSE;
-            break;
+        for (i = 0; i < chunk_pages; i++) {
+            if (vec[i] == 0) {
+                return JNI_FALSE;
+            }
         }
+        a += chunk_len;
     }
-    free(vec);
-    return loaded;
+    return JNI_TRUE;
 }
 
 
@@ -31,6 +31,7 @@
 
 #if defined(__linux__)
 #include <sys/sendfile.h>
+#include <sys/syscall.h>
 #elif defined(_AIX)
 #include <string.h>
 #include <sys/socket.h>
@@ -169,7 +170,33 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+#if defined(SYS_copy_file_range)
+    /* For file to file transfers prefer copy_file_range(2), which lets the
+     * filesystem share extents (reflink) or copy on the server side.  It
+     * writes at the current position of dstFD, same as sendfile(2).  Fall
+     * back to sendfile when the kernel or filesystem cannot do it.  Procfs,
+     * sysfs and other pseudo files report a size of zero, so copy_file_range
+     * returns 0 for them; let sendfile decide whether that is end of file. */
+    struct stat64 st;
+    if (fstat64(dstFD, &st) == 0 && S_ISREG(st.st_mode)) {
+        n = syscall(SYS_copy_file_range, srcFD, &offset, dstFD, NULL,
+                    (size_t)count, 0);
+        if (n > 0 || (n == 0 && count == 0))
+            return n;
+        if (n < 0) {
+            if (errno == EINTR)
+                return IOS_INTERRUPTED;
+            if (errno != ENOSYS && errno != EXDEV && errno != EINVAL &&
+                errno != EOPNOTSUPP && errno != EBADF) {
+                JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+                return IOS_THROWN;
+            }
+        }
+        offset = (off64_t)position;
+    }
+#endif
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/stringTable.hpp"
+#include "memory/resourceArea.hpp"
+#include "microBenchmark.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "unittest.hpp"
+
+#define BENCH_STRING_COUNT 1024
+#define BENCH_STRING_LENGTH 32
+
+TEST_VM(StringTable, intern) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle s1(THREAD, StringTable::intern("string_table_test", THREAD));
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  oop s2 = StringTable::intern("string_table_test", THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  ASSERT_EQ(s1(), s2) << "interned strings should be the same object";
+}
+
+// Interns strings that are already in the table.
+class StringInternOp : public MicroBenchmark::Op {
+  char _names[BENCH_STRING_COUNT][BENCH_STRING_LENGTH];
+  JavaThread* _thread;
+ public:
+  StringInternOp(JavaThread* thread) : _thread(thread) {
+    JavaThread* THREAD = thread;
+    for (int i = 0; i < BENCH_STRING_COUNT; i++) {
+      os::snprintf(_names[i], BENCH_STRING_LENGTH, "bench_string_intern%d", i);
+      StringTable::intern(_names[i], THREAD);
+    }
+  }
+  void do_op(size_t i) {
+    JavaThread* THREAD = _thread;
+    HandleMark hm(THREAD);
+    StringTable::intern(_names[i % BENCH_STRING_COUNT], THREAD);
+  }
+};
+
+TEST_VM(StringTable, DISABLED_bench_intern) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  ResourceMark rm(THREAD);
+  StringInternOp op(THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  MicroBenchmark::run("StringTable::intern (lookup)", &op, 100000);
+}
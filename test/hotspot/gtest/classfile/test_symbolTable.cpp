@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "classfile/symbolTable.hpp"
+#include "microBenchmark.hpp"
 #include "threadHelper.inline.hpp"
 #include "unittest.hpp"
 
@@ -145,3 +146,53 @@ public:
 TEST_VM(SymbolTable, test_symbol_refcount_parallel) {
   mt_test_doer<DriverSymbolThread>();
 }
+
+#define BENCH_SYMBOL_COUNT 1024
+
+// Looks up symbols that are already in the table.
+class SymbolLookupOp : public MicroBenchmark::Op {
+  Symbol* _symbols[BENCH_SYMBOL_COUNT];
+  char _names[BENCH_SYMBOL_COUNT][SYM_NAME_LENGTH];
+ public:
+  SymbolLookupOp() {
+    for (int i = 0; i < BENCH_SYMBOL_COUNT; i++) {
+      os::snprintf(_names[i], SYM_NAME_LENGTH, "bench_symbol_lookup%d", i);
+      _symbols[i] = SymbolTable::new_symbol(_names[i]);
+    }
+  }
+  ~SymbolLookupOp() {
+    for (int i = 0; i < BENCH_SYMBOL_COUNT; i++) {
+      _symbols[i]->decrement_refcount();
+    }
+  }
+  void do_op(size_t i) {
+    TempNewSymbol sym = SymbolTable::new_symbol(_names[i % BENCH_SYMBOL_COUNT]);
+  }
+};
+
+// Creates symbols that are not in the table yet.
+class SymbolInsertOp : public MicroBenchmark::Op {
+  int _round;
+  char _name[SYM_NAME_LENGTH];
+ public:
+  SymbolInsertOp() : _round(0) {}
+  void setup_round() { _round++; }
+  void do_op(size_t i) {
+    os::snprintf(_name, SYM_NAME_LENGTH, "bench_symbol_new%d_" SIZE_FORMAT, _round, i);
+    TempNewSymbol sym = SymbolTable::new_symbol(_name);
+  }
+};
+
+TEST_VM(SymbolTable, DISABLED_bench_new_symbol_lookup) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  SymbolLookupOp op;
+  MicroBenchmark::run("SymbolTable::new_symbol (lookup)", &op, 100000);
+}
+
+TEST_VM(SymbolTable, DISABLED_bench_new_symbol_insert) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  SymbolInsertOp op;
+  MicroBenchmark::run("SymbolTable::new_symbol (insert)", &op, 10000);
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "compiler/compileBroker.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+TEST_VM(CompileBroker, cpu_budget_unlimited_by_default) {
+  AutoModifyRestore<uintx> fs(CompilerThreadsCPUPercentage, 100);
+  ASSERT_EQ(max_jint, CompileBroker::compiler_thread_cpu_budget());
+}
+
+TEST_VM(CompileBroker, cpu_budget_percentage) {
+  const int cpus = os::active_processor_count();
+  {
+    AutoModifyRestore<uintx> fs(CompilerThreadsCPUPercentage, 50);
+    ASSERT_EQ(MAX2(cpus * 50 / 100, 1), CompileBroker::compiler_thread_cpu_budget());
+  }
+  {
+    // At least one compiler thread is always allowed.
+    AutoModifyRestore<uintx> fs(CompilerThreadsCPUPercentage, 1);
+    ASSERT_EQ(MAX2(cpus / 100, 1), CompileBroker::compiler_thread_cpu_budget());
+  }
+}
@@ -134,3 +134,52 @@ TEST_VM(HeapRegion, apply_to_marked_object) {
   ThreadInVMfromNative invm(JavaThread::current());
   VMThread::execute(&op);
 }
+
+class VM_HeapRegionEvacFailureBoundsTest : public VM_GTestExecuteAtSafepoint {
+public:
+  void doit();
+};
+
+void VM_HeapRegionEvacFailureBoundsTest::doit() {
+  G1CollectedHeap* heap = G1CollectedHeap::heap();
+
+  // Using region 0 for testing.
+  HeapRegion* region = heap->heap_region_containing(heap->bottom_addr_for_region(0));
+
+  // Outside of evacuation no failures are recorded.
+  ASSERT_FALSE(region->evacuation_failed());
+  HeapWord* old_top = region->top();
+  HeapWord* bottom = region->bottom();
+  region->set_top(region->end());
+  EXPECT_TRUE(region->evac_failure_bottom() == NULL);
+  EXPECT_TRUE(region->evac_failure_top() == NULL);
+
+  // The bounds span the lowest start and highest end, regardless of the
+  // order the failures are noted in.
+  region->note_evacuation_failure(bottom + MARK_OFFSET_2, bottom + MARK_OFFSET_2 + MinObjAlignment);
+  EXPECT_EQ(bottom + MARK_OFFSET_2, region->evac_failure_bottom());
+  EXPECT_EQ(bottom + MARK_OFFSET_2 + MinObjAlignment, region->evac_failure_top());
+
+  region->note_evacuation_failure(bottom + MARK_OFFSET_3, bottom + MARK_OFFSET_3 + 2 * MinObjAlignment);
+  region->note_evacuation_failure(bottom + MARK_OFFSET_1, bottom + MARK_OFFSET_1 + MinObjAlignment);
+  region->note_evacuation_failure(bottom + MARK_OFFSET_2, bottom + MARK_OFFSET_2 + MinObjAlignment);
+  EXPECT_EQ(bottom + MARK_OFFSET_1, region->evac_failure_bottom());
+  EXPECT_EQ(bottom + MARK_OFFSET_3 + 2 * MinObjAlignment, region->evac_failure_top());
+
+  // Resetting the evacuation failed flag clears the bounds.
+  region->set_evacuation_failed(false);
+  EXPECT_TRUE(region->evac_failure_bottom() == NULL);
+  EXPECT_TRUE(region->evac_failure_top() == NULL);
+
+  region->set_top(old_top);
+}
+
+TEST_VM(HeapRegion, note_evacuation_failure) {
+  if (!UseG1GC) {
+    return;
+  }
+
+  VM_HeapRegionEvacFailureBoundsTest op;
+  ThreadInVMfromNative invm(JavaThread::current());
+  VMThread::execute(&op);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/sparsePRT.inline.hpp"
+#include "unittest.hpp"
+
+static const RegionIdx_t TestRegion = 17;
+
+// Cards of a region stay in the small entry table until it overflows, and are
+// then found in the regular table together with all previously added cards.
+TEST_VM(G1SparsePRT, promote_on_small_overflow) {
+  SparsePRT sprt;
+
+  int cards = SparsePRTEntry::cards_num();
+
+  for (int i = 0; i < cards; i++) {
+    ASSERT_EQ(SparsePRT::added, sprt.add_card(TestRegion, (CardIdx_t)i)) << "card " << i;
+    ASSERT_EQ(SparsePRT::found, sprt.add_card(TestRegion, (CardIdx_t)i)) << "card " << i;
+    ASSERT_EQ(i + 1, sprt.get_entry(TestRegion)->num_valid_cards());
+  }
+  ASSERT_EQ(SparsePRT::overflow, sprt.add_card(TestRegion, (CardIdx_t)cards));
+
+  SparsePRTEntry* e = sprt.get_entry(TestRegion);
+  ASSERT_TRUE(e != NULL);
+  for (int i = 0; i < cards; i++) {
+    ASSERT_TRUE(e->contains_card((CardIdx_t)i)) << "card " << i;
+    ASSERT_TRUE(sprt.contains_card(TestRegion, (CardIdx_t)i)) << "card " << i;
+  }
+  ASSERT_FALSE(sprt.contains_card(TestRegion, (CardIdx_t)cards));
+}
+
+// Entries of both tables are visible to iteration, deletion and clearing.
+TEST_VM(G1SparsePRT, delete_and_clear) {
+  SparsePRT sprt;
+
+  const RegionIdx_t small_region = 3;
+  ASSERT_EQ(SparsePRT::added, sprt.add_card(small_region, 0));
+  for (int i = 0; i < SparsePRTEntry::cards_num(); i++) {
+    ASSERT_EQ(SparsePRT::added, sprt.add_card(TestRegion, (CardIdx_t)i));
+  }
+
+  int num_entries = 0;
+  SparsePRTBucketIter iter(&sprt);
+  SparsePRTEntry* e;
+  while (iter.has_next(e)) {
+    ASSERT_TRUE(e->r_ind() == small_region || e->r_ind() == TestRegion);
+    num_entries++;
+  }
+  ASSERT_EQ(2, num_entries);
+
+  ASSERT_TRUE(sprt.delete_entry(small_region));
+  ASSERT_FALSE(sprt.delete_entry(small_region));
+  ASSERT_TRUE(sprt.get_entry(small_region) == NULL);
+  ASSERT_TRUE(sprt.get_entry(TestRegion) != NULL);
+
+  ASSERT_EQ(SparsePRT::added, sprt.add_card(small_region, 1));
+  sprt.clear();
+  ASSERT_TRUE(sprt.get_entry(small_region) == NULL);
+  ASSERT_TRUE(sprt.get_entry(TestRegion) == NULL);
+  ASSERT_FALSE(sprt.contains_card(TestRegion, 0));
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/timeHistogramCounters.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+class TimeHistogramCountersTest {
+ public:
+  static uint bucket_index(jlong micros) {
+    return TimeHistogramCounters::bucket_index(micros);
+  }
+  static jlong bucket(TimeHistogramCounters* h, uint i) {
+    return h->_buckets[i]->get_value();
+  }
+  static jlong count(TimeHistogramCounters* h) {
+    return h->_count->get_value();
+  }
+  static jlong sum(TimeHistogramCounters* h) {
+    return h->_sum->get_value();
+  }
+  static PerfData::Units sum_units(TimeHistogramCounters* h) {
+    return h->_sum->units();
+  }
+};
+
+TEST(TimeHistogramCounters, bucket_index) {
+  const uint last = TimeHistogramCounters::NumBuckets - 1;
+  const jlong first_limit = TimeHistogramCounters::FirstBucketLimitMicros;
+
+  EXPECT_EQ(0u, TimeHistogramCountersTest::bucket_index(0));
+  EXPECT_EQ(0u, TimeHistogramCountersTest::bucket_index(first_limit - 1));
+  EXPECT_EQ(1u, TimeHistogramCountersTest::bucket_index(first_limit));
+  EXPECT_EQ(1u, TimeHistogramCountersTest::bucket_index(2 * first_limit - 1));
+  EXPECT_EQ(2u, TimeHistogramCountersTest::bucket_index(2 * first_limit));
+  EXPECT_EQ(last - 1, TimeHistogramCountersTest::bucket_index((first_limit << (last - 1)) - 1));
+  EXPECT_EQ(last, TimeHistogramCountersTest::bucket_index(first_limit << (last - 1)));
+  EXPECT_EQ(last, TimeHistogramCountersTest::bucket_index(max_jlong));
+}
+
+TEST_VM(TimeHistogramCounters, record) {
+  if (!UsePerfData) {
+    return;
+  }
+  TimeHistogramCounters* h = new TimeHistogramCounters("gtest", "timeHistogram");
+
+  EXPECT_EQ(PerfData::U_Ticks, TimeHistogramCountersTest::sum_units(h));
+
+  h->record(0.05);   //   50us, bucket 0
+  h->record(0.2);    //  200us, bucket 1
+  h->record(0.25);   //  250us, bucket 1
+  h->record(10.0);   // 10ms, bucket 7 (8192us - 16383us)
+
+  EXPECT_EQ(4, TimeHistogramCountersTest::count(h));
+  EXPECT_EQ(1, TimeHistogramCountersTest::bucket(h, 0));
+  EXPECT_EQ(2, TimeHistogramCountersTest::bucket(h, 1));
+  EXPECT_EQ(1, TimeHistogramCountersTest::bucket(h, 7));
+
+  jlong bucket_total = 0;
+  for (uint i = 0; i < TimeHistogramCounters::NumBuckets; i++) {
+    bucket_total += TimeHistogramCountersTest::bucket(h, i);
+  }
+  EXPECT_EQ(TimeHistogramCountersTest::count(h), bucket_total);
+
+  // The sum is kept in ticks; allow for truncation of each sample.
+  double expected_ticks = 10.5 * os::elapsed_frequency() / MILLIUNITS;
+  EXPECT_NEAR(expected_ticks, (double)TimeHistogramCountersTest::sum(h), 4.0);
+}
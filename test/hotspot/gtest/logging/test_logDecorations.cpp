@@ -230,3 +230,27 @@ TEST(LogDecorations, identifiers) {
     EXPECT_EQ(ids[i].expected, strtol(reported, NULL, 10));
   }
 }
+
+// Test that a copy has the same decorations and does not refer to the original
+TEST_VM(LogDecorations, copy) {
+  LogDecorators decorator_selection;
+  ASSERT_TRUE(decorator_selection.parse("uptime,pid,tags"));
+  LogDecorations original(LogLevel::Info, tagset, decorator_selection);
+  LogDecorations copy(original);
+
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    if (decorator == LogDecorators::level_decorator) {
+      // The level decoration is not stored in the decorations buffer
+      continue;
+    }
+    const char* expected = original.decoration(decorator);
+    const char* copied = copy.decoration(decorator);
+    if (expected == NULL) {
+      EXPECT_TRUE(copied == NULL) << "Unexpected decoration " << LogDecorators::name(decorator);
+    } else {
+      EXPECT_STREQ(expected, copied);
+      EXPECT_NE(expected, copied) << "Copy should have its own decorations buffer";
+    }
+  }
+}
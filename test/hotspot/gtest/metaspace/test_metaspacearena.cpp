@@ -207,7 +207,7 @@ public:
     allocate_from_arena_with_tests(&dummy, word_size);
   }
 
-  void deallocate_with_tests(MetaWord* p, size_t word_size) {
+  void deallocate_with_tests(MetaWord* p, size_t word_size, bool expect_rollback = false) {
     size_t used = 0, committed = 0, capacity = 0;
     usage_numbers_with_test(&used, &committed, &capacity);
 
@@ -218,9 +218,14 @@ public:
     size_t used2 = 0, committed2 = 0, capacity2 = 0;
     usage_numbers_with_test(&used2, &committed2, &capacity2);
 
-    // Nothing should have changed. Deallocated blocks are added to the free block list
-    // which still counts as used.
-    ASSERT_EQ(used2, used);
+    if (expect_rollback) {
+      // The block was the last allocation from the current chunk and went back to it.
+      ASSERT_EQ(used2, used - word_size);
+    } else {
+      // Nothing should have changed. Deallocated blocks are added to the free block list
+      // which still counts as used.
+      ASSERT_EQ(used2, used);
+    }
     ASSERT_EQ(committed2, committed);
     ASSERT_EQ(capacity2, capacity);
   }
@@ -431,9 +436,13 @@ TEST_VM(metaspace, MetaspaceArena_deallocate) {
     MetaWord* p1 = NULL;
     helper.allocate_from_arena_with_tests_expect_success(&p1, s);
 
+    // Allocate behind p1, so that p1 is not rolled back into its chunk
+    MetaWord* blocker = NULL;
+    helper.allocate_from_arena_with_tests_expect_success(&blocker, s);
+
     size_t used1 = 0, capacity1 = 0;
     helper.usage_numbers_with_test(&used1, NULL, &capacity1);
-    ASSERT_EQ(used1, s);
+    ASSERT_EQ(used1, s * 2);
 
     helper.deallocate_with_tests(p1, s);
 
@@ -447,7 +456,7 @@ TEST_VM(metaspace, MetaspaceArena_deallocate) {
 
     size_t used3 = 0, capacity3 = 0;
     helper.usage_numbers_with_test(&used3, NULL, &capacity3);
-    ASSERT_EQ(used3, used2);
+    ASSERT_EQ(used3, used1);
     ASSERT_EQ(capacity3, capacity2);
 
     // Actually, we should get the very same allocation back
@@ -455,6 +464,39 @@ TEST_VM(metaspace, MetaspaceArena_deallocate) {
   }
 }
 
+// Test rollback: deallocating the most recent allocation from the current chunk gives
+// the space back to the chunk, and the next allocation is carved from the same place.
+TEST_VM(metaspace, MetaspaceArena_deallocate_rollback) {
+  if (Settings::use_allocation_guard()) {
+    return;
+  }
+  for (size_t s = 2; s <= MAX_CHUNK_WORD_SIZE; s *= 2) {
+    MetaspaceGtestContext context;
+    MetaspaceArenaTestHelper helper(context, Metaspace::StandardMetaspaceType, false);
+
+    MetaWord* p1 = NULL;
+    helper.allocate_from_arena_with_tests_expect_success(&p1, s);
+
+    size_t used1 = 0;
+    helper.usage_numbers_with_test(&used1, NULL, NULL);
+    ASSERT_EQ(used1, s);
+
+    helper.deallocate_with_tests(p1, s, true);
+
+    size_t used2 = 0;
+    helper.usage_numbers_with_test(&used2, NULL, NULL);
+    ASSERT_EQ(used2, (size_t)0);
+
+    MetaWord* p2 = NULL;
+    helper.allocate_from_arena_with_tests_expect_success(&p2, s);
+
+    size_t used3 = 0;
+    helper.usage_numbers_with_test(&used3, NULL, NULL);
+    ASSERT_EQ(used3, used1);
+    ASSERT_EQ(p1, p2);
+  }
+}
+
 static void test_recover_from_commit_limit_hit() {
 
   if (Settings::new_chunks_are_fully_committed()) {
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GTEST_MICROBENCHMARK_HPP
+#define GTEST_MICROBENCHMARK_HPP
+
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "unittest.hpp"
+
+// Support for microbenchmarks of VM internals.
+//
+// A microbenchmark is a gtest whose name starts with DISABLED_bench_, so that
+// it does not slow down the normal test runs. Benchmarks are run with
+//   gtestLauncher -jdk:<jdk> --gtest_also_run_disabled_tests --gtest_filter=*bench_*
+//
+// The operation is run for a number of warmup rounds, then for a number of
+// measured rounds. The median and best time per operation over the measured
+// rounds are printed, in a fixed format that scripts can compare between
+// builds:
+//   bench <name>: median <ns> ns/op, best <ns> ns/op (<rounds> x <ops> ops)
+class MicroBenchmark {
+ public:
+  static const int default_warmup_rounds = 5;
+  static const int default_rounds = 15;
+
+  // The operation to measure. do_op() gets the index of the op in the round.
+  class Op {
+   public:
+    virtual void do_op(size_t i) = 0;
+    // Called before each round, outside of the measured time.
+    virtual void setup_round() {}
+  };
+
+  // Runs the benchmark and returns the median time per op, in nanoseconds.
+  static double run(const char* name, Op* op, size_t ops_per_round,
+                    int warmup_rounds = default_warmup_rounds,
+                    int rounds = default_rounds) {
+    assert(rounds > 0 && rounds <= max_rounds, "invalid number of rounds");
+    for (int r = 0; r < warmup_rounds; r++) {
+      run_round(op, ops_per_round);
+    }
+    jlong times[max_rounds];
+    for (int r = 0; r < rounds; r++) {
+      times[r] = run_round(op, ops_per_round);
+    }
+    sort_times(times, rounds);
+    double median = (double)times[rounds / 2] / ops_per_round;
+    double best = (double)times[0] / ops_per_round;
+    tty->print_cr("bench %s: median %.2f ns/op, best %.2f ns/op (%d x " SIZE_FORMAT " ops)",
+                  name, median, best, rounds, ops_per_round);
+    return median;
+  }
+
+ private:
+  static const int max_rounds = 100;
+
+  static jlong run_round(Op* op, size_t ops_per_round) {
+    op->setup_round();
+    jlong start = os::javaTimeNanos();
+    for (size_t i = 0; i < ops_per_round; i++) {
+      op->do_op(i);
+    }
+    return os::javaTimeNanos() - start;
+  }
+
+  static void sort_times(jlong* times, int n) {
+    for (int i = 1; i < n; i++) {
+      jlong t = times[i];
+      int j = i;
+      while (j > 0 && times[j - 1] > t) {
+        times[j] = times[j - 1];
+        j--;
+      }
+      times[j] = t;
+    }
+  }
+};
+
+#endif // GTEST_MICROBENCHMARK_HPP
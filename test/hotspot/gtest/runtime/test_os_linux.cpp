@@ -30,6 +30,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/autoRestore.hpp"
 #include "unittest.hpp"
 
 namespace {
@@ -242,4 +243,33 @@ TEST_VM(os_linux, reserve_memory_special_shm) {
   }
 }
 
+TEST_VM(os_linux, pretouch_memory_thp) {
+  // With UseTransparentHugePages the range may be populated by the kernel in
+  // one call. Either way, every page of the range has to be resident afterwards.
+  AutoModifyRestore<bool> thp(UseTransparentHugePages, true);
+
+  const size_t page_size = os::vm_page_size();
+  const size_t size = 4 * M;
+  char* const base = os::reserve_memory(size);
+  ASSERT_TRUE(base != NULL);
+  ASSERT_TRUE(os::commit_memory(base, size, false));
+
+  os::pretouch_memory(base, base + size, page_size);
+
+  const size_t num_pages = size / page_size;
+  unsigned char* vec = NEW_C_HEAP_ARRAY(unsigned char, num_pages, mtTest);
+  ASSERT_EQ(0, ::mincore(base, size, vec));
+  for (size_t i = 0; i < num_pages; i++) {
+    EXPECT_TRUE((vec[i] & 1) != 0) << "page " << i << " not resident";
+  }
+  FREE_C_HEAP_ARRAY(unsigned char, vec);
+
+  // Pre-touching must not change the contents of committed memory.
+  for (char* p = base; p < base + size; p += page_size) {
+    EXPECT_EQ(0, *p);
+  }
+
+  ASSERT_TRUE(os::release_memory(base, size));
+}
+
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2020, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -22,7 +22,9 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/perfMemory.hpp"
+#include "threadHelper.inline.hpp"
 #include "unittest.hpp"
 
 class PerfMemoryTest : public ::testing::Test {
@@ -41,3 +43,64 @@ TEST_VM_F(PerfMemoryTest, destroy) {
   ASSERT_NE(PerfMemory::capacity(), (size_t)0) << "PerfMemory::_capacity should not be 0";
 }
 
+
+TEST_VM(PerfStripedCounter, single_thread) {
+  PerfStripedCounter* stripes = new PerfStripedCounter();
+  EXPECT_EQ(0, stripes->take_sample());
+
+  stripes->inc();
+  stripes->inc(41);
+  EXPECT_EQ(42, stripes->take_sample());
+  // Taking a sample does not reset the stripes.
+  EXPECT_EQ(42, stripes->take_sample());
+}
+
+TEST_VM(PerfStripedCounter, registered_counter) {
+  EXCEPTION_MARK;
+  PerfStripedCounter* stripes = new PerfStripedCounter();
+  PerfCounter* counter = PerfDataManager::create_counter(SUN_RT, "gtest.stripedCounter",
+                                                         PerfData::U_Events, stripes, THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  // The folded value counts the same thing as the stripes.
+  EXPECT_EQ(PerfData::U_Events, counter->units());
+  EXPECT_EQ(PerfData::V_Monotonic, counter->variability());
+}
+
+static PerfStripedCounter* _striped_counter = NULL;
+static const int StripedIncrementers = 8;
+static const int StripedIncrements = 100000;
+
+class StripedIncrementerThread : public JavaTestThread {
+public:
+  StripedIncrementerThread(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~StripedIncrementerThread() {}
+  void main_run() {
+    for (int i = 0; i < StripedIncrements; i++) {
+      _striped_counter->inc();
+    }
+  }
+};
+
+class StripedRunnerThread : public JavaTestThread {
+public:
+  StripedRunnerThread(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~StripedRunnerThread() {}
+  void main_run() {
+    Semaphore done;
+    for (int i = 0; i < StripedIncrementers; i++) {
+      StripedIncrementerThread* t = new StripedIncrementerThread(&done);
+      t->doit();
+    }
+    for (int i = 0; i < StripedIncrementers; i++) {
+      done.wait();
+    }
+  }
+};
+
+TEST_VM(PerfStripedCounter, concurrent_increments) {
+  _striped_counter = new PerfStripedCounter();
+  mt_test_doer<StripedRunnerThread>();
+  EXPECT_EQ((jlong)StripedIncrementers * StripedIncrements, _striped_counter->take_sample());
+  delete _striped_counter;
+  _striped_counter = NULL;
+}
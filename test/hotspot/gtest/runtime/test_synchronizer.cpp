@@ -22,7 +22,12 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/systemDictionary.hpp"
 #include "memory/allocation.hpp"
+#include "microBenchmark.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/vm_version.hpp"
 #include "unittest.hpp"
@@ -67,3 +72,44 @@ TEST_VM(SynchronizerTest, sanity) {
             << "sharing.";
   }
 }
+
+// Enters and exits the monitor of an uncontended object.
+class MonitorEnterExitOp : public MicroBenchmark::Op {
+  Handle _obj;
+  JavaThread* _thread;
+ public:
+  MonitorEnterExitOp(Handle obj, JavaThread* thread) : _obj(obj), _thread(thread) {}
+  void do_op(size_t i) {
+    ObjectLocker ol(_obj, _thread);
+  }
+};
+
+class IdentityHashOp : public MicroBenchmark::Op {
+  Handle _obj;
+  JavaThread* _thread;
+ public:
+  IdentityHashOp(Handle obj, JavaThread* thread) : _obj(obj), _thread(thread) {}
+  void do_op(size_t i) {
+    ObjectSynchronizer::FastHashCode(_thread, _obj());
+  }
+};
+
+TEST_VM(SynchronizerTest, DISABLED_bench_enter_exit) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle obj(THREAD, SystemDictionary::Object_klass()->allocate_instance(THREAD));
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  MonitorEnterExitOp op(obj, THREAD);
+  MicroBenchmark::run("ObjectSynchronizer::enter/exit", &op, 100000);
+}
+
+TEST_VM(SynchronizerTest, DISABLED_bench_identity_hash) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle obj(THREAD, SystemDictionary::Object_klass()->allocate_instance(THREAD));
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  IdentityHashOp op(obj, THREAD);
+  MicroBenchmark::run("ObjectSynchronizer::FastHashCode", &op, 100000);
+}
@@ -48,3 +48,45 @@ TEST(utf8, length) {
   UNICODE::as_utf8(str, 19, res, INT_MAX);
   ASSERT_EQ(strlen(res), (size_t) 3 * 19) << "string should end here";
 }
+
+TEST(utf8, ascii_fast_paths) {
+  char utf8[64];
+  jchar chars[40];
+  jbyte bytes[40];
+
+  // Long ASCII runs around a two byte and a three byte character
+  for (int i = 0; i < 40; i++) {
+    chars[i] = (jchar) ('a' + i % 26);
+    bytes[i] = (jbyte) ('a' + i % 26);
+  }
+  chars[17] = 0x00E9; // 2B in UTF-8
+  chars[30] = 0x0800; // 3B in UTF-8
+  bytes[17] = (jbyte) 0xE9;
+  bytes[30] = 0; // 2B in modified UTF-8
+
+  ASSERT_EQ(UNICODE::utf8_length(chars, 40), 40 + 1 + 2);
+  ASSERT_EQ(UNICODE::utf8_length(bytes, 40), 40 + 1 + 1);
+
+  UNICODE::as_utf8(chars, 40, utf8, sizeof(utf8));
+  ASSERT_EQ(strlen(utf8), (size_t) 43);
+
+  bool is_latin1;
+  bool has_multibyte;
+  ASSERT_EQ(UTF8::unicode_length(utf8, 43, is_latin1, has_multibyte), 40);
+  ASSERT_TRUE(has_multibyte);
+  ASSERT_FALSE(is_latin1);
+
+  jchar decoded[40];
+  UTF8::convert_to_unicode(utf8, decoded, 40);
+  for (int i = 0; i < 40; i++) {
+    ASSERT_EQ(decoded[i], chars[i]) << "at index " << i;
+  }
+
+  // Truncation inside the ASCII prefix
+  UNICODE::as_utf8(bytes, 40, utf8, 11);
+  ASSERT_EQ(strlen(utf8), (size_t) 10) << "string should be truncated here";
+  UNICODE::as_utf8(bytes, 40, utf8, sizeof(utf8));
+  ASSERT_EQ(strlen(utf8), (size_t) 42);
+  ASSERT_EQ(UTF8::unicode_length(utf8, 42, is_latin1, has_multibyte), 40);
+  ASSERT_TRUE(is_latin1);
+}
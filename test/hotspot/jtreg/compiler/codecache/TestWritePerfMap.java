@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary -XX:+WritePerfMap writes /tmp/perf-<pid>.map with entries for stubs and compiled methods
+ * @requires os.family == "linux"
+ * @requires vm.compiler1.enabled | vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+WritePerfMap compiler.codecache.TestWritePerfMap
+ */
+
+package compiler.codecache;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.List;
+import java.util.regex.Pattern;
+
+public class TestWritePerfMap {
+
+    // <start address> <size> <name>, both numbers in hex.
+    static final Pattern LINE = Pattern.compile("0x[0-9a-f]+ 0x[0-9a-f]+ \\S.*");
+
+    static int hot(int x) {
+        return x * 31 + 7;
+    }
+
+    public static void main(String[] args) throws Exception {
+        int sum = 0;
+        for (int i = 0; i < 20_000; i++) {
+            sum += hot(i);
+        }
+        System.out.println("sum = " + sum);
+
+        Path map = Paths.get("/tmp/perf-" + ProcessHandle.current().pid() + ".map");
+        try {
+            if (!Files.exists(map)) {
+                throw new RuntimeException(map + " was not written");
+            }
+            // The map is line buffered, so it can be read while the VM is running.
+            List<String> lines = Files.readAllLines(map);
+            boolean foundHot = false;
+            for (String line : lines) {
+                if (!LINE.matcher(line).matches()) {
+                    throw new RuntimeException("Malformed perf map line: " + line);
+                }
+                if (line.contains("compiler.codecache.TestWritePerfMap.hot(I)I")) {
+                    foundHot = true;
+                }
+            }
+            if (lines.size() < 2) {
+                throw new RuntimeException("Expected entries for stubs, found " + lines.size() + " lines");
+            }
+            if (!foundHot) {
+                throw new RuntimeException("No perf map entry for the compiled method TestWritePerfMap.hot");
+            }
+        } finally {
+            Files.deleteIfExists(map);
+        }
+    }
+}
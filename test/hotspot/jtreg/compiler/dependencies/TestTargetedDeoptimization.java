@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Loading a class deoptimizes only the nmethods whose class
+ *          hierarchy dependencies it invalidates.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-BackgroundCompilation -XX:-UseOnStackReplacement -XX:-TieredCompilation
+ *                   compiler.dependencies.TestTargetedDeoptimization
+ */
+
+package compiler.dependencies;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class TestTargetedDeoptimization {
+    private static final WhiteBox WHITE_BOX = WhiteBox.getWhiteBox();
+    private static final int COMP_LEVEL_FULL_OPTIMIZATION = 4;
+
+    static class Base {
+        int value() { return 1; }
+    }
+
+    // Only loaded through reflection, so that CHA sees Base as a leaf class
+    // until the test loads it.
+    static class Sub extends Base {
+        int value() { return 2; }
+    }
+
+    static int callValue(Base b) {
+        return b.value();
+    }
+
+    static int unrelated(int x) {
+        return x * 3 + 1;
+    }
+
+    private static void compile(Method m) {
+        WHITE_BOX.enqueueMethodForCompilation(m, COMP_LEVEL_FULL_OPTIMIZATION);
+        Asserts.assertTrue(WHITE_BOX.isMethodCompiled(m), m + " should be compiled");
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method callValue = TestTargetedDeoptimization.class.getDeclaredMethod("callValue", Base.class);
+        Method unrelated = TestTargetedDeoptimization.class.getDeclaredMethod("unrelated", int.class);
+
+        Base base = new Base();
+        for (int i = 0; i < 10_000; i++) {
+            callValue(base);
+            unrelated(i);
+        }
+        compile(callValue);
+        compile(unrelated);
+
+        Class<?> subClass = Class.forName(TestTargetedDeoptimization.class.getName() + "$Sub");
+        Base sub = (Base) subClass.getDeclaredConstructor().newInstance();
+
+        Asserts.assertFalse(WHITE_BOX.isMethodCompiled(callValue),
+                            "callValue depends on Base having no subclass and must be deoptimized");
+        Asserts.assertTrue(WHITE_BOX.isMethodCompiled(unrelated),
+                           "unrelated has no dependency on Base and must stay compiled");
+        Asserts.assertEQ(callValue(sub), 2);
+        Asserts.assertEQ(callValue(base), 1);
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary Field loads split through Phis of allocations give the same results,
+ *          and the merged allocations are eliminated.
+ * @requires vm.compiler2.enabled
+ * @modules java.management
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestReduceAllocationMerges::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+ReduceAllocationMerges
+ *                   compiler.escapeAnalysis.TestReduceAllocationMerges true
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestReduceAllocationMerges::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-ReduceAllocationMerges
+ *                   compiler.escapeAnalysis.TestReduceAllocationMerges false
+ */
+
+package compiler.escapeAnalysis;
+
+import java.lang.management.ManagementFactory;
+
+public class TestReduceAllocationMerges {
+    static final int ITERATIONS = 50_000;
+
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static int testTwoWay(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        return p.x * 31 + p.y;
+    }
+
+    static int testThreeWay(int sel, int a, int b) {
+        Point p;
+        if (sel == 0) {
+            p = new Point(a, b);
+        } else if (sel == 1) {
+            p = new Point(a + 1, b - 1);
+        } else {
+            p = new Point(b, a);
+        }
+        return p.x - p.y;
+    }
+
+    // The fields are written after the merge, which needs the allocation.
+    static int testStoreAfterMerge(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        p.x += 1;
+        return p.x * 31 + p.y;
+    }
+
+    static Point escaped;
+
+    // The merged object escapes, which needs the allocation.
+    static int testEscape(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        escaped = p;
+        return p.x;
+    }
+
+    static void check(String name, int expected, int actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + " gives " + actual + " instead of " + expected);
+        }
+    }
+
+    static void run() {
+        for (int i = 0; i < ITERATIONS; i++) {
+            boolean cond = (i & 1) == 0;
+            int a = i;
+            int b = i * 7;
+            check("testTwoWay", cond ? a * 31 + b : b * 31 + a, testTwoWay(cond, a, b));
+            int sel = i % 3;
+            int expected = (sel == 0) ? a - b : (sel == 1) ? (a + 1) - (b - 1) : b - a;
+            check("testThreeWay", expected, testThreeWay(sel, a, b));
+            check("testStoreAfterMerge", cond ? (a + 1) * 31 + b : (b + 1) * 31 + a,
+                  testStoreAfterMerge(cond, a, b));
+            check("testEscape", cond ? a : b, testEscape(cond, a, b));
+        }
+    }
+
+    static long allocatedBytes() {
+        com.sun.management.ThreadMXBean bean =
+            (com.sun.management.ThreadMXBean)ManagementFactory.getThreadMXBean();
+        return bean.getThreadAllocatedBytes(Thread.currentThread().getId());
+    }
+
+    public static void main(String[] args) {
+        boolean reduced = Boolean.parseBoolean(args[0]);
+        // Warm up, so that the test methods are compiled.
+        run();
+        run();
+        if (reduced) {
+            // Once compiled, the two-way and three-way merges do not allocate.
+            int sum = 0;
+            long before = allocatedBytes();
+            for (int i = 0; i < ITERATIONS; i++) {
+                sum += testTwoWay((i & 1) == 0, i, i + 1);
+                sum += testThreeWay(i % 3, i, i + 1);
+            }
+            long allocated = allocatedBytes() - before;
+            System.out.println("sum: " + sum + ", allocated: " + allocated);
+            if (allocated > ITERATIONS) {
+                throw new RuntimeException("Merged allocations not eliminated, allocated " + allocated + " bytes");
+            }
+        }
+    }
+}
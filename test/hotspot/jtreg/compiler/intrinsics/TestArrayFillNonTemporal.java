@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Arrays.fill through the x86 fill stubs with a small
+ *          ArrayFillNonTemporalThreshold fills exactly the requested range,
+ *          for byte, short and int arrays at unaligned offsets.
+ * @requires (os.arch == "x86_64" | os.arch == "amd64") & vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+OptimizeFill
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:ArrayFillNonTemporalThreshold=256
+ *                   compiler.intrinsics.TestArrayFillNonTemporal
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+OptimizeFill
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:ArrayFillNonTemporalThreshold=256
+ *                   -XX:UseAVX=2
+ *                   compiler.intrinsics.TestArrayFillNonTemporal
+ */
+
+package compiler.intrinsics;
+
+import java.util.Arrays;
+
+import jdk.test.lib.Asserts;
+
+public class TestArrayFillNonTemporal {
+    // Lengths below, around and well above the threshold, in bytes.
+    static final int[] LENGTHS = { 0, 1, 31, 63, 255, 256, 257, 300, 511, 1000, 4097, 10_001 };
+    static final int MAX_OFFSET = 33;
+    static final int ROUNDS = 20;
+
+    static void fillBytes(byte[] a, int from, int to, byte v) {
+        Arrays.fill(a, from, to, v);
+    }
+
+    static void fillShorts(short[] a, int from, int to, short v) {
+        Arrays.fill(a, from, to, v);
+    }
+
+    static void fillInts(int[] a, int from, int to, int v) {
+        Arrays.fill(a, from, to, v);
+    }
+
+    static void testBytes() {
+        for (int len : LENGTHS) {
+            for (int off = 0; off <= MAX_OFFSET; off++) {
+                byte[] a = new byte[off + len + MAX_OFFSET];
+                fillBytes(a, off, off + len, (byte)0x5a);
+                for (int i = 0; i < a.length; i++) {
+                    byte expected = (i >= off && i < off + len) ? (byte)0x5a : 0;
+                    Asserts.assertEQ(a[i], expected, "byte[" + i + "], offset " + off + ", length " + len);
+                }
+            }
+        }
+    }
+
+    static void testShorts() {
+        for (int len : LENGTHS) {
+            len = len / 2;
+            for (int off = 0; off <= MAX_OFFSET; off++) {
+                short[] a = new short[off + len + MAX_OFFSET];
+                fillShorts(a, off, off + len, (short)0x5a5b);
+                for (int i = 0; i < a.length; i++) {
+                    short expected = (i >= off && i < off + len) ? (short)0x5a5b : 0;
+                    Asserts.assertEQ(a[i], expected, "short[" + i + "], offset " + off + ", length " + len);
+                }
+            }
+        }
+    }
+
+    static void testInts() {
+        for (int len : LENGTHS) {
+            len = len / 4;
+            for (int off = 0; off <= MAX_OFFSET; off++) {
+                int[] a = new int[off + len + MAX_OFFSET];
+                fillInts(a, off, off + len, 0x5a5b5c5d);
+                for (int i = 0; i < a.length; i++) {
+                    int expected = (i >= off && i < off + len) ? 0x5a5b5c5d : 0;
+                    Asserts.assertEQ(a[i], expected, "int[" + i + "], offset " + off + ", length " + len);
+                }
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        // The first rounds get the fill loops compiled to stub calls.
+        for (int round = 0; round < ROUNDS; round++) {
+            testBytes();
+            testShorts();
+            testInts();
+        }
+    }
+}
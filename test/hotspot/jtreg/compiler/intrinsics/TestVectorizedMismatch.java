@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Arrays.mismatch and Arrays.equals give the right results with the
+ *          vectorizedMismatch intrinsic, for every element size, every
+ *          length up to several vectors, and every mismatch position.
+ * @requires vm.compiler1.enabled | vm.compiler2.enabled
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedMismatchIntrinsic
+ *                   -XX:TieredStopAtLevel=1
+ *                   compiler.intrinsics.TestVectorizedMismatch
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedMismatchIntrinsic
+ *                   -XX:-TieredCompilation
+ *                   compiler.intrinsics.TestVectorizedMismatch
+ */
+
+/**
+ * @test
+ * @summary The same with the SVE path of the aarch64 stub.
+ * @requires os.arch == "aarch64" & vm.cpu.features ~= ".*sve.*"
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedMismatchIntrinsic
+ *                   -XX:UseSVE=1 -XX:TieredStopAtLevel=1
+ *                   compiler.intrinsics.TestVectorizedMismatch
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedMismatchIntrinsic
+ *                   -XX:UseSVE=1 -XX:-TieredCompilation
+ *                   compiler.intrinsics.TestVectorizedMismatch
+ */
+
+package compiler.intrinsics;
+
+import java.util.Arrays;
+
+import jdk.test.lib.Asserts;
+
+public class TestVectorizedMismatch {
+    // 300 bytes is more than one 2048 bit SVE vector plus every tail length.
+    static final int MAX_BYTES = 300;
+    static final int ROUNDS = 3;
+
+    static void check(String type, int len, int from, int expected, int mismatch, boolean equals) {
+        Asserts.assertEQ(mismatch, expected,
+                         type + "[] mismatch, length " + len + ", offset " + from);
+        Asserts.assertEQ(equals, expected < 0,
+                         type + "[] equals, length " + len + ", offset " + from);
+    }
+
+    // Mismatch at every position, or none (pos == len).
+    static void testBytes() {
+        for (int len = 0; len <= MAX_BYTES; len++) {
+            for (int from = 0; from < 8 && from <= len; from++) {
+                byte[] a = new byte[len];
+                for (int i = 0; i < len; i++) {
+                    a[i] = (byte)(i * 7 + 1);
+                }
+                for (int pos = from; pos <= len; pos++) {
+                    byte[] b = a.clone();
+                    if (pos < len) {
+                        b[pos]++;
+                    }
+                    int expected = pos < len ? pos - from : -1;
+                    check("byte", len, from, expected,
+                          Arrays.mismatch(a, from, len, b, from, len),
+                          Arrays.equals(a, from, len, b, from, len));
+                }
+            }
+        }
+    }
+
+    static void testChars() {
+        for (int len = 0; len <= MAX_BYTES / 2; len++) {
+            for (int from = 0; from < 4 && from <= len; from++) {
+                char[] a = new char[len];
+                short[] sa = new short[len];
+                for (int i = 0; i < len; i++) {
+                    a[i] = (char)(i * 7 + 1);
+                    sa[i] = (short)(i * 7 + 1);
+                }
+                for (int pos = from; pos <= len; pos++) {
+                    char[] b = a.clone();
+                    short[] sb = sa.clone();
+                    if (pos < len) {
+                        b[pos]++;
+                        sb[pos]--;
+                    }
+                    int expected = pos < len ? pos - from : -1;
+                    check("char", len, from, expected,
+                          Arrays.mismatch(a, from, len, b, from, len),
+                          Arrays.equals(a, from, len, b, from, len));
+                    check("short", len, from, expected,
+                          Arrays.mismatch(sa, from, len, sb, from, len),
+                          Arrays.equals(sa, from, len, sb, from, len));
+                }
+            }
+        }
+    }
+
+    static void testInts() {
+        for (int len = 0; len <= MAX_BYTES / 4; len++) {
+            for (int from = 0; from < 2 && from <= len; from++) {
+                int[] a = new int[len];
+                float[] fa = new float[len];
+                for (int i = 0; i < len; i++) {
+                    a[i] = i * 7 + 1;
+                    fa[i] = i * 7 + 1;
+                }
+                for (int pos = from; pos <= len; pos++) {
+                    int[] b = a.clone();
+                    float[] fb = fa.clone();
+                    if (pos < len) {
+                        b[pos]++;
+                        fb[pos] += 0.5f;
+                    }
+                    int expected = pos < len ? pos - from : -1;
+                    check("int", len, from, expected,
+                          Arrays.mismatch(a, from, len, b, from, len),
+                          Arrays.equals(a, from, len, b, from, len));
+                    check("float", len, from, expected,
+                          Arrays.mismatch(fa, from, len, fb, from, len),
+                          Arrays.equals(fa, from, len, fb, from, len));
+                }
+            }
+        }
+    }
+
+    static void testLongs() {
+        for (int len = 0; len <= MAX_BYTES / 8; len++) {
+            long[] a = new long[len];
+            double[] da = new double[len];
+            for (int i = 0; i < len; i++) {
+                a[i] = i * 7L + 1;
+                da[i] = i * 7 + 1;
+            }
+            for (int pos = 0; pos <= len; pos++) {
+                long[] b = a.clone();
+                double[] db = da.clone();
+                if (pos < len) {
+                    // Differ only in the highest byte.
+                    b[pos] ^= 1L << 60;
+                    db[pos] = -db[pos];
+                }
+                int expected = pos < len ? pos : -1;
+                check("long", len, 0, expected, Arrays.mismatch(a, b), Arrays.equals(a, b));
+                check("double", len, 0, expected, Arrays.mismatch(da, db), Arrays.equals(da, db));
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        // Later rounds run with the callers compiled.
+        for (int round = 0; round < ROUNDS; round++) {
+            testBytes();
+            testChars();
+            testInts();
+            testLongs();
+        }
+    }
+}
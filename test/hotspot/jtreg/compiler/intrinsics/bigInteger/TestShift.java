@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary The BigInteger shiftLeft/shiftRight worker intrinsics, with and
+ *          without UseSIMDForBigIntegerShiftIntrinsics, give the same
+ *          results as the interpreter for all lengths and shift counts.
+ * @requires os.arch == "aarch64" & vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver/timeout=600 compiler.intrinsics.bigInteger.TestShift
+ */
+
+package compiler.intrinsics.bigInteger;
+
+import java.math.BigInteger;
+import java.util.Random;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestShift {
+
+    public static void main(String[] args) throws Exception {
+        String reference = run("-Xint");
+        String[][] configs = {
+            { "-XX:-TieredCompilation", "-Xbatch", "-XX:+UseSIMDForBigIntegerShiftIntrinsics" },
+            { "-XX:-TieredCompilation", "-Xbatch", "-XX:-UseSIMDForBigIntegerShiftIntrinsics" },
+        };
+        for (String[] config : configs) {
+            String result = run(config);
+            String[] expected = reference.split("\n");
+            String[] actual = result.split("\n");
+            Asserts.assertEQ(actual.length, expected.length, "number of results with " + String.join(" ", config));
+            for (int i = 0; i < expected.length; i++) {
+                Asserts.assertEQ(actual[i], expected[i], "with " + String.join(" ", config));
+            }
+        }
+    }
+
+    private static String run(String... flags) throws Exception {
+        String[] cmd = new String[flags.length + 1];
+        System.arraycopy(flags, 0, cmd, 0, flags.length);
+        cmd[flags.length] = Workload.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(cmd).start());
+        output.shouldHaveExitValue(0);
+        return output.getStdout();
+    }
+
+    static class Workload {
+        // Covers lengths below, at and above the vector width, with every
+        // tail length, in words of 32 bits.
+        static final int MAX_WORDS = 40;
+        static final int[] SHIFTS = { 1, 2, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 127, 1000 };
+        static final int WARMUP = 20_000;
+
+        static BigInteger shiftLeft(BigInteger x, int n) {
+            return x.shiftLeft(n);
+        }
+
+        static BigInteger shiftRight(BigInteger x, int n) {
+            return x.shiftRight(n);
+        }
+
+        public static void main(String[] args) {
+            Random random = new Random(42);
+            BigInteger[] values = new BigInteger[2 * MAX_WORDS];
+            for (int words = 1; words <= MAX_WORDS; words++) {
+                BigInteger x = new BigInteger(words * 32, random).setBit(words * 32 - 1);
+                values[2 * (words - 1)] = x;
+                values[2 * (words - 1) + 1] = x.negate();
+            }
+
+            // Get the shifts compiled before computing the results.
+            for (int i = 0; i < WARMUP; i++) {
+                BigInteger x = values[i % values.length];
+                int n = SHIFTS[i % SHIFTS.length];
+                shiftLeft(x, n);
+                shiftRight(x, n);
+            }
+
+            StringBuilder sb = new StringBuilder();
+            for (BigInteger x : values) {
+                for (int n : SHIFTS) {
+                    sb.append(x.bitLength()).append(' ').append(x.signum()).append(' ').append(n)
+                      .append(" << ").append(shiftLeft(x, n).toString(16))
+                      .append(" >> ").append(shiftRight(x, n).toString(16)).append('\n');
+                }
+            }
+            System.out.print(sb);
+        }
+    }
+}
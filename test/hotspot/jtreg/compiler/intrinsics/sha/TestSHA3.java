@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary The SHA3-224/256/384/512 intrinsics give the same digests as the
+ *          Java implementation in the interpreter, for messages of one and of
+ *          many blocks, hashed in one update or in pieces.
+ * @requires (os.arch == "x86_64" | os.arch == "amd64") & vm.compiler2.enabled & vm.flagless
+ * @requires vm.cpu.features ~= ".*avx512vl.*"
+ * @library /test/lib
+ * @run driver compiler.intrinsics.sha.TestSHA3
+ */
+
+package compiler.intrinsics.sha;
+
+import java.security.MessageDigest;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSHA3 {
+
+    public static void main(String[] args) throws Exception {
+        // The interpreter always runs the Java implementation.
+        String reference = run("-Xint");
+        String intrinsic = run("-XX:-TieredCompilation", "-Xbatch",
+                               "-XX:+UnlockDiagnosticVMOptions", "-XX:+UseSHA3Intrinsics");
+        String[] expected = reference.split("\n");
+        String[] actual = intrinsic.split("\n");
+        Asserts.assertEQ(actual.length, expected.length, "number of digests");
+        for (int i = 0; i < expected.length; i++) {
+            Asserts.assertEQ(actual[i], expected[i]);
+        }
+    }
+
+    private static String run(String... flags) throws Exception {
+        String[] cmd = new String[flags.length + 1];
+        System.arraycopy(flags, 0, cmd, 0, flags.length);
+        cmd[flags.length] = Workload.class.getName();
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(cmd).start());
+        output.shouldHaveExitValue(0);
+        return output.getStdout();
+    }
+
+    static class Workload {
+        static final String[] ALGORITHMS = { "SHA3-224", "SHA3-256", "SHA3-384", "SHA3-512" };
+        // The block sizes are 144, 136, 104 and 72 bytes, so this covers
+        // empty, partial, single and many block messages for all of them.
+        static final int[] LENGTHS = { 0, 1, 71, 72, 73, 103, 104, 105, 135, 136, 137, 143, 144, 145,
+                                       288, 1000, 4096 };
+        static final int WARMUP = 10_000;
+
+        static String hex(byte[] bytes) {
+            StringBuilder sb = new StringBuilder();
+            for (byte b : bytes) {
+                sb.append(String.format("%02x", b));
+            }
+            return sb.toString();
+        }
+
+        public static void main(String[] args) throws Exception {
+            byte[] data = new byte[4096];
+            for (int i = 0; i < data.length; i++) {
+                data[i] = (byte)(i * 31 + 7);
+            }
+
+            // Get implCompress and implCompressMultiBlock compiled.
+            for (String algorithm : ALGORITHMS) {
+                MessageDigest md = MessageDigest.getInstance(algorithm);
+                for (int i = 0; i < WARMUP; i++) {
+                    md.update(data, 0, 1000);
+                    md.digest();
+                }
+            }
+
+            StringBuilder sb = new StringBuilder();
+            for (String algorithm : ALGORITHMS) {
+                MessageDigest md = MessageDigest.getInstance(algorithm);
+                for (int len : LENGTHS) {
+                    // All at once, which hashes whole blocks in one call.
+                    md.update(data, 0, len);
+                    sb.append(algorithm).append(' ').append(len).append(" whole ")
+                      .append(hex(md.digest())).append('\n');
+
+                    // In odd pieces, which hashes one block at a time.
+                    for (int pos = 0; pos < len; pos += 13) {
+                        md.update(data, pos, Math.min(13, len - pos));
+                    }
+                    sb.append(algorithm).append(' ').append(len).append(" pieces ")
+                      .append(hex(md.digest())).append('\n');
+                }
+            }
+            System.out.print(sb);
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary Int and long conditional moves vectorized as a compare and blend
+ *          must select the same elements as the scalar code.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestIntegralCMove::ref*
+ *                   compiler.loopopts.superword.TestIntegralCMove
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UseVectorCmov
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestIntegralCMove::ref*
+ *                   compiler.loopopts.superword.TestIntegralCMove
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Arrays;
+
+public class TestIntegralCMove {
+    static final int N = 1000;
+    static final int ITERATIONS = 20_000;
+
+    static void selectLess(int[] r, int[] a, int[] b, int[] x, int[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] < b[i]) ? x[i] : y[i];
+        }
+    }
+
+    static void refSelectLess(int[] r, int[] a, int[] b, int[] x, int[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] < b[i]) ? x[i] : y[i];
+        }
+    }
+
+    // Compare against a loop invariant, which is promoted to a vector
+    static void selectEqual(int[] r, int[] a, int c, int[] x, int[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] == c) ? x[i] : y[i];
+        }
+    }
+
+    static void refSelectEqual(int[] r, int[] a, int c, int[] x, int[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] == c) ? x[i] : y[i];
+        }
+    }
+
+    static void selectGreaterEqual(long[] r, long[] a, long[] b, long[] x, long[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] >= b[i]) ? x[i] : y[i];
+        }
+    }
+
+    static void refSelectGreaterEqual(long[] r, long[] a, long[] b, long[] x, long[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] >= b[i]) ? x[i] : y[i];
+        }
+    }
+
+    static void selectNotEqual(long[] r, long[] a, long[] b, long[] x, long[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] != b[i]) ? x[i] : y[i];
+        }
+    }
+
+    static void refSelectNotEqual(long[] r, long[] a, long[] b, long[] x, long[] y) {
+        for (int i = 0; i < N; i++) {
+            r[i] = (a[i] != b[i]) ? x[i] : y[i];
+        }
+    }
+
+    static int[] intInit(int seed) {
+        int[] a = new int[N];
+        for (int i = 0; i < N; i++) {
+            a[i] = (i * seed) % 17 - 8;
+        }
+        return a;
+    }
+
+    static long[] longInit(int seed) {
+        long[] a = new long[N];
+        for (int i = 0; i < N; i++) {
+            // Differ in the upper half only for some elements
+            a[i] = ((long)((i * seed) % 5) << 32) + (i % 3);
+        }
+        return a;
+    }
+
+    static void check(String name, int iteration, Object expected, Object actual) {
+        boolean equal = (expected instanceof int[]) ? Arrays.equals((int[])expected, (int[])actual)
+                                                    : Arrays.equals((long[])expected, (long[])actual);
+        if (!equal) {
+            throw new RuntimeException(name + " gives a wrong result in iteration " + iteration);
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] a = intInit(3), b = intInit(5), x = intInit(7), y = intInit(11);
+        long[] la = longInit(3), lb = longInit(5), lx = longInit(7), ly = longInit(11);
+        for (int it = 0; it < ITERATIONS; it++) {
+            int[] r1 = new int[N], r2 = new int[N];
+            selectLess(r1, a, b, x, y);
+            refSelectLess(r2, a, b, x, y);
+            check("selectLess", it, r2, r1);
+            selectEqual(r1, a, it % 17 - 8, x, y);
+            refSelectEqual(r2, a, it % 17 - 8, x, y);
+            check("selectEqual", it, r2, r1);
+
+            long[] lr1 = new long[N], lr2 = new long[N];
+            selectGreaterEqual(lr1, la, lb, lx, ly);
+            refSelectGreaterEqual(lr2, la, lb, lx, ly);
+            check("selectGreaterEqual", it, lr2, lr1);
+            selectNotEqual(lr1, la, lb, lx, ly);
+            refSelectNotEqual(lr2, la, lb, lx, ly);
+            check("selectNotEqual", it, lr2, lr1);
+        }
+    }
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary Reductions accumulated in vector lanes across the main loop must
+ *          give the scalar results.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestLaneReduction::ref*
+ *                   compiler.loopopts.superword.TestLaneReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+SuperWordReductions -XX:LoopUnrollLimit=250
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestLaneReduction::ref*
+ *                   compiler.loopopts.superword.TestLaneReduction
+ */
+
+package compiler.loopopts.superword;
+
+public class TestLaneReduction {
+    static final int N = 1003; // not a multiple of any vector length
+    static final int ITERATIONS = 20_000;
+
+    static int intSum(int init, int[] a) {
+        int r = init;
+        for (int i = 0; i < N; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static int refIntSum(int init, int[] a) {
+        int r = init;
+        for (int i = 0; i < N; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    // The accumulators start at values other than the identity of the
+    // operation, which must only be applied once, after the loop.
+    static int intMul(int init, int[] a) {
+        int r = init;
+        for (int i = 0; i < N; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static int refIntMul(int init, int[] a) {
+        int r = init;
+        for (int i = 0; i < N; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static long longAddMul(long[] a) {
+        long s = 42;
+        long p = 3;
+        for (int i = 0; i < N; i++) {
+            s += a[i];
+            p *= a[i];
+        }
+        return s + p;
+    }
+
+    static long refLongAddMul(long[] a) {
+        long s = 42;
+        long p = 3;
+        for (int i = 0; i < N; i++) {
+            s += a[i];
+            p *= a[i];
+        }
+        return s + p;
+    }
+
+    static int intXorMax(int[] a, int[] b) {
+        int x = 0;
+        int m = Integer.MIN_VALUE;
+        for (int i = 0; i < N; i++) {
+            x ^= a[i] * b[i];
+            m = Math.max(m, a[i] - b[i]);
+        }
+        return x + m;
+    }
+
+    static int refIntXorMax(int[] a, int[] b) {
+        int x = 0;
+        int m = Integer.MIN_VALUE;
+        for (int i = 0; i < N; i++) {
+            x ^= a[i] * b[i];
+            m = Math.max(m, a[i] - b[i]);
+        }
+        return x + m;
+    }
+
+    static long longMulAndOr(long[] a) {
+        long p = 1;
+        long and = -1;
+        long or = 0;
+        for (int i = 0; i < N; i++) {
+            p *= a[i];
+            and &= a[i];
+            or |= a[i];
+        }
+        return p + and + or;
+    }
+
+    static long refLongMulAndOr(long[] a) {
+        long p = 1;
+        long and = -1;
+        long or = 0;
+        for (int i = 0; i < N; i++) {
+            p *= a[i];
+            and &= a[i];
+            or |= a[i];
+        }
+        return p + and + or;
+    }
+
+    static long longMin(long[] a) {
+        long m = Long.MAX_VALUE;
+        for (int i = 0; i < N; i++) {
+            m = Math.min(m, a[i]);
+        }
+        return m;
+    }
+
+    static long refLongMin(long[] a) {
+        long m = Long.MAX_VALUE;
+        for (int i = 0; i < N; i++) {
+            m = Math.min(m, a[i]);
+        }
+        return m;
+    }
+
+    static float floatMinMax(float[] a) {
+        float min = Float.POSITIVE_INFINITY;
+        float max = Float.NEGATIVE_INFINITY;
+        for (int i = 0; i < N; i++) {
+            min = Math.min(min, a[i]);
+            max = Math.max(max, a[i]);
+        }
+        return min + max;
+    }
+
+    static float refFloatMinMax(float[] a) {
+        float min = Float.POSITIVE_INFINITY;
+        float max = Float.NEGATIVE_INFINITY;
+        for (int i = 0; i < N; i++) {
+            min = Math.min(min, a[i]);
+            max = Math.max(max, a[i]);
+        }
+        return min + max;
+    }
+
+    static double doubleMax(double[] a) {
+        double m = Double.NEGATIVE_INFINITY;
+        for (int i = 0; i < N; i++) {
+            m = Math.max(m, a[i]);
+        }
+        return m;
+    }
+
+    static double refDoubleMax(double[] a) {
+        double m = Double.NEGATIVE_INFINITY;
+        for (int i = 0; i < N; i++) {
+            m = Math.max(m, a[i]);
+        }
+        return m;
+    }
+
+    // Floating point sums are not reassociated, so the result is bit exact.
+    static double doubleSum(double[] a) {
+        double r = 0;
+        for (int i = 0; i < N; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static double refDoubleSum(double[] a) {
+        double r = 0;
+        for (int i = 0; i < N; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static void check(String name, int iteration, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + " gives " + actual + " instead of " + expected +
+                                       " in iteration " + iteration);
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[N];
+        int[] b = new int[N];
+        int[] m = new int[N];
+        long[] la = new long[N];
+        float[] fa = new float[N];
+        double[] da = new double[N];
+        for (int i = 0; i < N; i++) {
+            a[i] = i * 31 - 5000;
+            b[i] = (i * 17) % 101;
+            m[i] = (i % 5) * 2 + 1;
+            la[i] = (i % 7 == 0) ? 3 : ~(1L << (i % 64));
+            fa[i] = (i % 11 == 0) ? -0.0f : (i - 500) * 0.25f;
+            da[i] = (i - 700) / 3.0;
+        }
+        double[] ds = da.clone();
+        da[N / 2] = Double.NaN;
+        for (int it = 0; it < ITERATIONS; it++) {
+            check("intSum", it, refIntSum(it, a), intSum(it, a));
+            check("intMul", it, refIntMul(it | 1, m), intMul(it | 1, m));
+            check("longAddMul", it, refLongAddMul(la), longAddMul(la));
+            check("intXorMax", it, refIntXorMax(a, b), intXorMax(a, b));
+            check("longMulAndOr", it, refLongMulAndOr(la), longMulAndOr(la));
+            check("longMin", it, refLongMin(la), longMin(la));
+            check("floatMinMax", it, Float.floatToRawIntBits(refFloatMinMax(fa)),
+                                     Float.floatToRawIntBits(floatMinMax(fa)));
+            check("doubleMax", it, Double.doubleToRawLongBits(refDoubleMax(da)),
+                                   Double.doubleToRawLongBits(doubleMax(da)));
+            check("doubleSum", it, Double.doubleToRawLongBits(refDoubleSum(ds)),
+                                   Double.doubleToRawLongBits(doubleSum(ds)));
+        }
+    }
+}
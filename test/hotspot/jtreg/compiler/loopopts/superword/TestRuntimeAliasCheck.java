@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary SuperWord loops versioned on a runtime alias check must give the
+ *          scalar results both when the arrays are different and when they
+ *          are the same array.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestRuntimeAliasCheck::ref*
+ *                   compiler.loopopts.superword.TestRuntimeAliasCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestRuntimeAliasCheck::ref*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+SuperWordRTDepCheck
+ *                   compiler.loopopts.superword.TestRuntimeAliasCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestRuntimeAliasCheck::ref*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+SuperWordRTDepCheck -XX:-UseCountedLoopSafepoints
+ *                   compiler.loopopts.superword.TestRuntimeAliasCheck
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Arrays;
+
+public class TestRuntimeAliasCheck {
+    static final int N = 1000;
+    static final int ITERATIONS = 20_000;
+
+    // a[i + 1] = b[i]: a forward dependence if a == b
+    static void shiftUp(int[] a, int[] b) {
+        for (int i = 0; i < N - 1; i++) {
+            a[i + 1] = b[i];
+        }
+    }
+
+    static void refShiftUp(int[] a, int[] b) {
+        for (int i = 0; i < N - 1; i++) {
+            a[i + 1] = b[i];
+        }
+    }
+
+    // a[i] = b[i + 1] + 1: an anti dependence if a == b
+    static void shiftDown(int[] a, int[] b) {
+        for (int i = 0; i < N - 1; i++) {
+            a[i] = b[i + 1] + 1;
+        }
+    }
+
+    static void refShiftDown(int[] a, int[] b) {
+        for (int i = 0; i < N - 1; i++) {
+            a[i] = b[i + 1] + 1;
+        }
+    }
+
+    // Two stores and a load at different distances
+    static void mixed(long[] a, long[] b, long[] c) {
+        for (int i = 0; i < N - 4; i++) {
+            a[i + 3] = b[i] * 3;
+            c[i] = a[i + 1] + b[i + 2];
+        }
+    }
+
+    static void refMixed(long[] a, long[] b, long[] c) {
+        for (int i = 0; i < N - 4; i++) {
+            a[i + 3] = b[i] * 3;
+            c[i] = a[i + 1] + b[i + 2];
+        }
+    }
+
+    static int[] intInit() {
+        int[] a = new int[N];
+        for (int i = 0; i < N; i++) {
+            a[i] = i * 7 - 300;
+        }
+        return a;
+    }
+
+    static long[] longInit(int seed) {
+        long[] a = new long[N];
+        for (int i = 0; i < N; i++) {
+            a[i] = (long)i * seed + 11;
+        }
+        return a;
+    }
+
+    static void check(String name, int iteration, Object expected, Object actual) {
+        boolean equal = (expected instanceof int[]) ? Arrays.equals((int[])expected, (int[])actual)
+                                                    : Arrays.equals((long[])expected, (long[])actual);
+        if (!equal) {
+            throw new RuntimeException(name + " gives a wrong result in iteration " + iteration);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int it = 0; it < ITERATIONS; it++) {
+            // Different arrays
+            int[] a1 = intInit(), b1 = intInit();
+            int[] a2 = intInit(), b2 = intInit();
+            shiftUp(a1, b1);
+            refShiftUp(a2, b2);
+            check("shiftUp", it, a2, a1);
+            shiftDown(a1, b1);
+            refShiftDown(a2, b2);
+            check("shiftDown", it, a2, a1);
+
+            // The same array
+            int[] s1 = intInit(), s2 = intInit();
+            shiftUp(s1, s1);
+            refShiftUp(s2, s2);
+            check("shiftUp aliased", it, s2, s1);
+            s1 = intInit();
+            s2 = intInit();
+            shiftDown(s1, s1);
+            refShiftDown(s2, s2);
+            check("shiftDown aliased", it, s2, s1);
+
+            long[] la1 = longInit(3), lb1 = longInit(5), lc1 = longInit(9);
+            long[] la2 = longInit(3), lb2 = longInit(5), lc2 = longInit(9);
+            mixed(la1, lb1, lc1);
+            refMixed(la2, lb2, lc2);
+            check("mixed", it, la2, la1);
+            check("mixed", it, lc2, lc1);
+
+            // All combinations of aliasing arrays
+            la1 = longInit(3);
+            la2 = longInit(3);
+            mixed(la1, la1, la1);
+            refMixed(la2, la2, la2);
+            check("mixed a == b == c", it, la2, la1);
+            la1 = longInit(3); lc1 = longInit(9);
+            la2 = longInit(3); lc2 = longInit(9);
+            mixed(la1, la1, lc1);
+            refMixed(la2, la2, lc2);
+            check("mixed a == b", it, la2, la1);
+            check("mixed a == b", it, lc2, lc1);
+            la1 = longInit(3); lb1 = longInit(5);
+            la2 = longInit(3); lb2 = longInit(5);
+            mixed(la1, lb1, la1);
+            refMixed(la2, lb2, la2);
+            check("mixed a == c", it, la2, la1);
+            lb1 = longInit(5); lc1 = longInit(9);
+            lb2 = longInit(5); lc2 = longInit(9);
+            mixed(lc1, lb1, lb1);
+            refMixed(lc2, lb2, lb2);
+            check("mixed b == c", it, lb2, lb1);
+            check("mixed b == c", it, lc2, lc1);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary With SuperWordRTDepCheck, a copy loop between two int[]
+ *          parameters is vectorized behind a runtime alias check, and
+ *          without it the loop stays scalar.
+ * @requires vm.compiler2.enabled & vm.debug & vm.flagless
+ * @requires os.arch == "x86_64" | os.arch == "amd64" | os.arch == "aarch64"
+ * @library /test/lib
+ * @run driver compiler.loopopts.superword.TestRuntimeAliasCheckIR
+ */
+
+package compiler.loopopts.superword;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestRuntimeAliasCheckIR {
+
+    public static void main(String[] args) throws Exception {
+        // The kit adds the alias check to the versioned loop and SuperWord
+        // creates vector nodes for it.
+        OutputAnalyzer output = run(true);
+        output.shouldHaveExitValue(0);
+        output.shouldContain("CountedLoopReserveKit::add_condition");
+        output.shouldContain("new Vector node: ");
+
+        // Without the flag the possible overlap keeps the loop scalar.
+        output = run(false);
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("CountedLoopReserveKit::add_condition");
+        output.shouldNotContain("new Vector node: ");
+    }
+
+    private static OutputAnalyzer run(boolean rtDepCheck) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+UnlockDiagnosticVMOptions",
+            (rtDepCheck ? "-XX:+" : "-XX:-") + "SuperWordRTDepCheck",
+            "-XX:+TraceLoopOpts",
+            "-XX:+TraceNewVectors",
+            "-XX:CompileCommand=compileonly," + Kernel.class.getName() + "::shiftCopy",
+            Kernel.class.getName());
+        return new OutputAnalyzer(pb.start());
+    }
+
+    static class Kernel {
+        static final int N = 1000;
+
+        // a and b may be the same array, and then each iteration reads
+        // what the previous one stored.
+        static void shiftCopy(int[] a, int[] b) {
+            for (int i = 0; i < N - 2; i++) {
+                a[i + 1] = b[i];
+            }
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[N];
+            int[] b = new int[N];
+            for (int i = 0; i < 20_000; i++) {
+                shiftCopy(a, b);
+            }
+        }
+    }
+}
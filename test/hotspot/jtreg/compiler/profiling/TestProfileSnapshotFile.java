@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Profile snapshots written at exit are loaded by the next run
+ * @library /test/lib
+ * @requires vm.flagless
+ * @run driver compiler.profiling.TestProfileSnapshotFile
+ */
+
+package compiler.profiling;
+
+import java.io.File;
+import java.nio.file.Files;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestProfileSnapshotFile {
+
+    public static void main(String[] args) throws Exception {
+        File file = new File("profile_snapshot.txt");
+        Files.deleteIfExists(file.toPath());
+
+        // The first run finds no snapshot and writes one at exit.
+        OutputAnalyzer output = run(file, true);
+        output.shouldHaveExitValue(0);
+        output.shouldContain("No profile snapshot " + file.getPath() + " to load");
+        output.shouldMatch("Wrote [1-9][0-9]* methods to profile snapshot");
+        String snapshot = new String(Files.readAllBytes(file.toPath()));
+        Asserts.assertTrue(snapshot.contains("method " + Workload.class.getName().replace('.', '/') + " hot (I)I "),
+                           "Workload.hot(I)I not in snapshot");
+
+        output = run(file, false);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Loaded [1-9][0-9]* methods from profile snapshot " + file.getPath());
+
+        // Malformed lines are skipped.
+        Files.write(file.toPath(), (snapshot + "method garbage\n").getBytes());
+        output = run(file, false);
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Ignored 1 malformed lines in profile snapshot");
+    }
+
+    private static OutputAnalyzer run(File file, boolean dump) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:ProfileSnapshotFile=" + file.getPath(),
+            "-XX:" + (dump ? "+" : "-") + "DumpProfileSnapshotAtExit",
+            "-Xlog:jit=info",
+            Workload.class.getName());
+        return new OutputAnalyzer(pb.start());
+    }
+
+    public static class Workload {
+        static int hot(int x) {
+            return x * 31 + 7;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println("sum: " + sum);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Tier 3 code with Tier3ProfileSampleFreqLog samples each switch
+ *          with its own counter and scales the profile counts.
+ * @requires vm.compiler1.enabled & vm.flagless
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver compiler.profiling.TestSampledSwitchProfile
+ */
+
+package compiler.profiling;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestSampledSwitchProfile {
+    static final int ITERATIONS = 8000;
+
+    public static void main(String[] args) throws Exception {
+        for (int freqLog = 0; freqLog <= 3; freqLog++) {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-Xbootclasspath/a:.",
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+WhiteBoxAPI",
+                "-XX:TieredStopAtLevel=3",
+                "-XX:-BackgroundCompilation",
+                "-XX:+PrintMethodData",
+                "-XX:Tier3ProfileSampleFreqLog=" + freqLog,
+                Workload.class.getName());
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+
+            // Each switch runs ITERATIONS times in tier 3 code, always taking
+            // the same case. Sampling one in 2^freqLog executions and scaling
+            // each update by 2^freqLog gives exactly the unsampled count.
+            checkProfile(output.getStdout(), "tableSwitch", freqLog);
+            checkProfile(output.getStdout(), "lookupSwitch", freqLog);
+        }
+    }
+
+    private static void checkProfile(String stdout, String method, int freqLog) {
+        String header = Workload.class.getName() + "::" + method + "(I)I";
+        int start = stdout.indexOf(header);
+        Asserts.assertGTE(start, 0, "no method data printed for " + header);
+        int end = stdout.indexOf("-----", start);
+        String mdo = stdout.substring(start, end < 0 ? stdout.length() : end);
+        Asserts.assertTrue(mdo.contains("MultiBranchData"), "no switch profile in " + mdo);
+        Asserts.assertTrue(mdo.contains("default_count(0)"), "unexpected default count in " + mdo);
+        Asserts.assertTrue(mdo.contains(" count(" + ITERATIONS + ")"),
+                           "case count should be " + ITERATIONS + " with Tier3ProfileSampleFreqLog=" + freqLog + ": " + mdo);
+    }
+
+    static class Workload {
+        private static final WhiteBox WHITE_BOX = WhiteBox.getWhiteBox();
+        private static final int COMP_LEVEL_FULL_PROFILE = 3;
+
+        static int tableSwitch(int k) {
+            switch (k) {
+                case 0:  return 10;
+                case 1:  return 11;
+                case 2:  return 12;
+                case 3:  return 13;
+                default: return -1;
+            }
+        }
+
+        static int lookupSwitch(int k) {
+            switch (k) {
+                case 10:     return 1;
+                case 1000:   return 2;
+                case 100000: return 3;
+                default:     return -1;
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            // Compile both methods before their first execution, so that the
+            // interpreter does not add to the profile.
+            Method table = Workload.class.getDeclaredMethod("tableSwitch", int.class);
+            Method lookup = Workload.class.getDeclaredMethod("lookupSwitch", int.class);
+            WHITE_BOX.enqueueMethodForCompilation(table, COMP_LEVEL_FULL_PROFILE);
+            WHITE_BOX.enqueueMethodForCompilation(lookup, COMP_LEVEL_FULL_PROFILE);
+            Asserts.assertEQ(WHITE_BOX.getMethodCompilationLevel(table), COMP_LEVEL_FULL_PROFILE);
+            Asserts.assertEQ(WHITE_BOX.getMethodCompilationLevel(lookup), COMP_LEVEL_FULL_PROFILE);
+
+            for (int i = 0; i < ITERATIONS; i++) {
+                Asserts.assertEQ(tableSwitch(1), 11);
+                Asserts.assertEQ(lookupSwitch(1000), 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test TestErgoNativeMemoryReserve
+ * @summary ErgoNativeMemoryReserve is held back from the memory that the
+ *          ergonomic heap size is calculated from.
+ * @requires vm.gc.Serial & vm.flagless
+ * @library /test/lib
+ * @run driver gc.TestErgoNativeMemoryReserve
+ */
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestErgoNativeMemoryReserve {
+
+    private static final long M = 1024 * 1024;
+
+    public static void main(String[] args) throws Exception {
+        // Half of MaxRAM without a reserve.
+        Asserts.assertEQ(maxHeapSize(null), 512 * M);
+
+        // Half of what is left after the reserve.
+        Asserts.assertEQ(maxHeapSize("-XX:ErgoNativeMemoryReserve=512m"), 256 * M);
+
+        // A reserve that leaves no memory is ignored.
+        OutputAnalyzer output = run("-XX:ErgoNativeMemoryReserve=1g");
+        output.shouldContain("ErgoNativeMemoryReserve (1024M) is not less than available memory (1024M), ignoring it");
+        Asserts.assertEQ(maxHeapSize(output), 512 * M);
+    }
+
+    private static long maxHeapSize(String reserve) throws Exception {
+        return maxHeapSize(run(reserve));
+    }
+
+    private static long maxHeapSize(OutputAnalyzer output) {
+        return Long.parseLong(output.firstMatch("MaxHeapSize.+=\\s+(\\d+)", 1));
+    }
+
+    private static OutputAnalyzer run(String reserve) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseSerialGC",
+            "-XX:MaxRAM=1g",
+            "-XX:MaxRAMPercentage=50",
+            reserve == null ? "-XX:ErgoNativeMemoryReserve=0" : reserve,
+            "-XX:+PrintFlagsFinal",
+            "-version");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestClassUnloadingCompiledCalls
+ * @summary Stress class unloading by concurrent mark while compiled code keeps
+ *          calling through inline caches into classes of short-lived loaders.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:+ExplicitGCInvokesConcurrent -Xmx64m
+ *                   gc.g1.TestClassUnloadingCompiledCalls
+ * @run main/othervm -XX:+UseG1GC -XX:+ExplicitGCInvokesConcurrent -Xmx64m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+G1ConcurrentMetaspacePurge
+ *                   gc.g1.TestClassUnloadingCompiledCalls
+ * @run main/othervm -XX:+UseG1GC -XX:+ExplicitGCInvokesConcurrent -Xmx64m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+G1ConcurrentMetaspacePurge
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC
+ *                   gc.g1.TestClassUnloadingCompiledCalls
+ */
+
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
+
+public class TestClassUnloadingCompiledCalls {
+    public interface Callee {
+        int call(int x);
+    }
+
+    // Loaded once per ChildLoader, so every instance brings its own class.
+    public static class Impl implements Callee {
+        public int call(int x) {
+            return x + 1;
+        }
+    }
+
+    static class ChildLoader extends ClassLoader {
+        private final byte[] implBytes;
+
+        ChildLoader(byte[] implBytes) {
+            super(TestClassUnloadingCompiledCalls.class.getClassLoader());
+            this.implBytes = implBytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (name.equals(Impl.class.getName())) {
+                synchronized (getClassLoadingLock(name)) {
+                    Class<?> c = findLoadedClass(name);
+                    if (c == null) {
+                        c = defineClass(name, implBytes, 0, implBytes.length);
+                    }
+                    return c;
+                }
+            }
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    static final int ITERATIONS = 200;
+    static final int LIVE_CALLEES = 4;
+    static final int CALLS = 20_000;
+
+    static volatile Callee[] live = new Callee[LIVE_CALLEES];
+    static volatile boolean done;
+    static volatile Throwable failure;
+
+    // Hot call site whose inline cache keeps switching between the classes
+    // of live and unloaded loaders.
+    static int invoke(Callee c, int x) {
+        return c.call(x);
+    }
+
+    static int callAll(Callee c) {
+        int sum = 0;
+        for (int i = 0; i < CALLS; i++) {
+            sum += invoke(c, i) - i;
+        }
+        return sum;
+    }
+
+    static byte[] implBytes() throws Exception {
+        String resource = Impl.class.getName().replace('.', '/') + ".class";
+        try (InputStream in = ClassLoader.getSystemResourceAsStream(resource)) {
+            ByteArrayOutputStream out = new ByteArrayOutputStream();
+            byte[] buf = new byte[4096];
+            int n;
+            while ((n = in.read(buf)) > 0) {
+                out.write(buf, 0, n);
+            }
+            return out.toByteArray();
+        }
+    }
+
+    static Callee newCallee(byte[] bytes) throws Exception {
+        Class<?> c = new ChildLoader(bytes).loadClass(Impl.class.getName());
+        return (Callee) c.getDeclaredConstructor().newInstance();
+    }
+
+    public static void main(String[] args) throws Exception {
+        byte[] bytes = implBytes();
+        for (int i = 0; i < LIVE_CALLEES; i++) {
+            live[i] = newCallee(bytes);
+        }
+
+        Thread caller = new Thread(() -> {
+            while (!done) {
+                Callee[] callees = live;
+                for (Callee c : callees) {
+                    if (callAll(c) != CALLS) {
+                        failure = new RuntimeException("Wrong result from " + c);
+                        return;
+                    }
+                }
+            }
+        });
+        caller.start();
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            Callee[] next = live.clone();
+            next[i % LIVE_CALLEES] = newCallee(bytes);
+            live = next;
+            if (callAll(next[i % LIVE_CALLEES]) != CALLS) {
+                throw new RuntimeException("Wrong result in iteration " + i);
+            }
+            if (i % 10 == 0) {
+                // Starts a concurrent cycle that unloads the dropped loaders.
+                System.gc();
+            }
+        }
+
+        done = true;
+        caller.join();
+        if (failure != null) {
+            throw new RuntimeException("Caller thread failed", failure);
+        }
+    }
+}
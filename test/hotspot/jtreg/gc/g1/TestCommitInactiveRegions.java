@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestCommitInactiveRegions
+ * @summary Expanding the heap into regions that were removed by shrinking but
+ *          not uncommitted yet must give them cleared auxiliary data.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -XX:G1HeapRegionSize=1M -Xms8M -Xmx256M
+ *                   -XX:MinHeapFreeRatio=5 -XX:MaxHeapFreeRatio=10 -XX:-ExplicitGCInvokesConcurrent
+ *                   -XX:G1ConcRefinementServiceIntervalMillis=3600000
+ *                   -XX:+VerifyBeforeGC -XX:+VerifyAfterGC -Xlog:gc+heap=debug
+ *                   gc.g1.TestCommitInactiveRegions
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class TestCommitInactiveRegions {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int M = 1024 * 1024;
+    private static final int NUM_OBJECTS = 128;
+
+    private static ArrayList<byte[]> fill() {
+        ArrayList<byte[]> objects = new ArrayList<>();
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            // Half a region each, so that the objects are not humongous.
+            byte[] b = new byte[M / 2 - 1024];
+            b[0] = (byte)i;
+            b[b.length - 1] = (byte)i;
+            objects.add(b);
+        }
+        return objects;
+    }
+
+    private static void check(ArrayList<byte[]> objects) {
+        for (int i = 0; i < objects.size(); i++) {
+            byte[] b = objects.get(i);
+            Asserts.assertEQ(b[0], (byte)i);
+            Asserts.assertEQ(b[b.length - 1], (byte)i);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int round = 0; round < 3; round++) {
+            ArrayList<byte[]> objects = fill();
+            WB.fullGC();
+            long expanded = Runtime.getRuntime().totalMemory();
+            check(objects);
+
+            // Shrink the heap. The service thread sleeps for an hour, so the
+            // removed regions stay inactive with their memory still committed.
+            objects = null;
+            WB.fullGC();
+            long shrunk = Runtime.getRuntime().totalMemory();
+            Asserts.assertLT(shrunk, expanded, "heap should have shrunk");
+
+            // Expand again into the inactive regions, and run a concurrent
+            // cycle over them that relies on clean mark bitmaps.
+            objects = fill();
+            WB.g1StartConcMarkCycle();
+            while (WB.g1InConcurrentMark()) {
+                Thread.sleep(100);
+            }
+            WB.youngGC();
+            check(objects);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArray
+ * @summary Humongous Object[] arrays referencing old objects are eagerly
+ *          reclaimed at young GC, and the remembered set entries they leave
+ *          behind on the old regions do no harm once their regions are reused.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArray
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestEagerReclaimHumongousObjArray {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-Xmn16M",
+            "-XX:G1HeapRegionSize=1M",
+            "-XX:+VerifyBeforeGC",
+            "-XX:+VerifyAfterGC",
+            "-Xlog:gc,gc+humongous=debug",
+            Workload.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        // "type array 0" identifies reclaimed object arrays.
+        Pattern p = Pattern.compile("Dead humongous region \\d+ .* type array 0");
+        Matcher m = p.matcher(output.getStdout());
+        int found = 0;
+        while (m.find()) {
+            found++;
+        }
+        Asserts.assertGTE(found, Workload.ROUNDS / 2,
+                          "Only " + found + " humongous object arrays were eagerly reclaimed");
+    }
+
+    static class Workload {
+        static final int ROUNDS = 20;
+        static final int NUM_TARGETS = 64 * 1024;
+        // Large enough to be humongous with 1M regions.
+        static final int ARRAY_LENGTH = 512 * 1024;
+
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static Integer[] targets = new Integer[NUM_TARGETS];
+
+        public static void main(String[] args) {
+            for (int i = 0; i < NUM_TARGETS; i++) {
+                targets[i] = new Integer(i);
+            }
+            // Move the targets into old regions.
+            WB.fullGC();
+
+            for (int round = 0; round < ROUNDS; round++) {
+                // Eager reclaim of object arrays is disabled during marking.
+                while (WB.g1InConcurrentMark()) {
+                    Thread.onSpinWait();
+                }
+
+                // The references to old objects add remembered set entries
+                // for the cards of this array to the old regions.
+                Object[] large = new Object[ARRAY_LENGTH];
+                Asserts.assertTrue(WB.g1IsHumongous(large), "array should be humongous");
+                for (int i = 0; i < ARRAY_LENGTH; i++) {
+                    large[i] = targets[i % NUM_TARGETS];
+                }
+                large = null;
+                WB.youngGC();
+
+                // Reuse the reclaimed regions for new humongous and old
+                // objects, so that the stale entries cover other objects.
+                byte[][] fill = new byte[4][];
+                for (int i = 0; i < fill.length; i++) {
+                    fill[i] = new byte[2 * 1024 * 1024];
+                }
+                WB.youngGC();
+                WB.youngGC();
+
+                if (round % 5 == 4) {
+                    // Scan the old regions, including their stale entries,
+                    // in a concurrent cycle and the mixed GCs after it.
+                    WB.g1StartConcMarkCycle();
+                    while (WB.g1InConcurrentMark()) {
+                        Thread.onSpinWait();
+                    }
+                    WB.youngGC();
+                    WB.youngGC();
+                }
+                Asserts.assertEQ(fill[0].length, 2 * 1024 * 1024);
+            }
+
+            for (int i = 0; i < NUM_TARGETS; i++) {
+                Asserts.assertEQ(targets[i].intValue(), i);
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestEvacuationFailureRemoval
+ * @requires vm.gc.G1 & vm.debug
+ * @summary Verify the heap after removing self-forwarding pointers of objects
+ * that failed evacuation, for failures spread over all parts of the regions.
+ * @library /test/lib /
+ * @run main/othervm -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m
+ * -XX:+G1EvacuationFailureALot -XX:G1EvacuationFailureALotCount=100
+ * -XX:G1EvacuationFailureALotInterval=1
+ * -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC -Xlog:gc
+ * gc.g1.TestEvacuationFailureRemoval
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestEvacuationFailureRemoval {
+
+    public static volatile Object sink;
+
+    public static void main(String[] args) {
+        List<Object[]> live = new ArrayList<>();
+        for (int i = 0; i < 200_000; i++) {
+            // Mix retained objects of varying size with garbage, so that
+            // objects failing evacuation are interleaved with dead ones.
+            Object[] o = new Object[i % 64];
+            if (i % 7 == 0) {
+                if (o.length > 0 && !live.isEmpty()) {
+                    o[0] = live.get(live.size() - 1);
+                }
+                live.add(o);
+                if (live.size() > 20_000) {
+                    live.subList(0, 10_000).clear();
+                }
+            } else {
+                sink = o;
+            }
+        }
+        for (Object[] o : live) {
+            if (o.length > 0 && o[0] != null && !(o[0] instanceof Object[])) {
+                throw new RuntimeException("Corrupted reference");
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestFullGCSkipDenseRegions
+ * @summary G1 full gc leaves the objects of regions that are live above the
+ *          MarkSweepDeadRatio threshold in place, and still compacts sparse
+ *          regions below them.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -XX:G1HeapRegionSize=1M -Xms256M -Xmx256M
+ *                   -XX:ParallelGCThreads=1 -XX:-ExplicitGCInvokesConcurrent
+ *                   -XX:MarkSweepDeadRatio=10 -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -Xlog:gc gc.g1.TestFullGCSkipDenseRegions
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.Asserts;
+import sun.hotspot.WhiteBox;
+
+public class TestFullGCSkipDenseRegions {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    // About 16 regions worth of objects each.
+    private static final int NUM_OBJECTS = 16 * 1024;
+    private static final int OBJECT_LENGTH = 1000;
+
+    private static ArrayList<byte[]> allocate(int tag) {
+        ArrayList<byte[]> list = new ArrayList<>(NUM_OBJECTS);
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            byte[] b = new byte[OBJECT_LENGTH];
+            b[0] = (byte)tag;
+            b[OBJECT_LENGTH - 1] = (byte)i;
+            list.add(b);
+        }
+        return list;
+    }
+
+    private static void check(ArrayList<byte[]> list, int tag, int step) {
+        for (int i = 0; i < NUM_OBJECTS; i += step) {
+            byte[] b = list.get(i);
+            Asserts.assertEQ(b[0], (byte)tag);
+            Asserts.assertEQ(b[OBJECT_LENGTH - 1], (byte)i);
+        }
+    }
+
+    public static void main(String[] args) {
+        // With a single worker, the full gc compacts the sparse objects
+        // first and the dense objects behind them.
+        ArrayList<byte[]> sparse = allocate(1);
+        ArrayList<byte[]> dense = allocate(2);
+        System.gc();
+
+        // Leave only every tenth sparse object alive, which frees most of
+        // the regions in front of the dense ones.
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            if (i % 10 != 0) {
+                sparse.set(i, null);
+            }
+        }
+
+        // The first and last quarter of the dense objects may share their
+        // regions with other objects or free space. Those in the middle are
+        // in regions that are completely live.
+        int first = NUM_OBJECTS / 4;
+        int last = NUM_OBJECTS * 3 / 4;
+        long[] denseAddresses = new long[last - first];
+        for (int i = first; i < last; i++) {
+            denseAddresses[i - first] = WB.getObjectAddress(dense.get(i));
+        }
+        long sparseAddress = WB.getObjectAddress(sparse.get(NUM_OBJECTS / 2));
+
+        System.gc();
+
+        for (int i = first; i < last; i++) {
+            Asserts.assertEQ(WB.getObjectAddress(dense.get(i)), denseAddresses[i - first],
+                             "object " + i + " of a dense region has been moved");
+        }
+        Asserts.assertNE(WB.getObjectAddress(sparse.get(NUM_OBJECTS / 2)), sparseAddress,
+                         "objects of sparse regions should have been compacted");
+
+        check(sparse, 1, 10);
+        check(dense, 2, 1);
+    }
+}
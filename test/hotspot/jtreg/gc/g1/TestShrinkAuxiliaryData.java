@@ -242,12 +242,25 @@ public class TestShrinkAuxiliaryData {
             deallocate();
             System.gc();
 
-            muFree = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
-            muAuxDataFree = WhiteBox.getWhiteBox().g1AuxiliaryMemoryUsage();
-
-            numUsedRegions = WhiteBox.getWhiteBox().g1NumMaxRegions()
-                    - WhiteBox.getWhiteBox().g1NumFreeRegions();
-            auxFree = (float)muAuxDataFree.getUsed() / numUsedRegions;
+            // The pause only removes the regions from the heap, the service
+            // thread uncommits their memory afterwards. Wait for it.
+            long deadline = System.currentTimeMillis() + UNCOMMIT_TIMEOUT_MS;
+            do {
+                muFree = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
+                muAuxDataFree = WhiteBox.getWhiteBox().g1AuxiliaryMemoryUsage();
+
+                numUsedRegions = WhiteBox.getWhiteBox().g1NumMaxRegions()
+                        - WhiteBox.getWhiteBox().g1NumFreeRegions();
+                auxFree = (float)muAuxDataFree.getUsed() / numUsedRegions;
+                if (muFree.getCommitted() >= muFull.getCommitted() || auxFree <= auxFull) {
+                    break;
+                }
+                try {
+                    Thread.sleep(100);
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            } while (System.currentTimeMillis() < deadline);
 
             System.out.format("Free aux data ratio= %f, regions max= %d, used= %d\n",
                     auxFree, WhiteBox.getWhiteBox().g1NumMaxRegions(), numUsedRegions
@@ -320,6 +333,7 @@ public class TestShrinkAuxiliaryData {
             return REGIONS_TO_ALLOCATE * REGION_SIZE;
         }
 
+        private static final long UNCOMMIT_TIMEOUT_MS = 10_000;
         private static final int REGIONS_TO_ALLOCATE = 100;
         private static final int NUM_OBJECTS_PER_REGION = 10;
         private static final int NUM_LINKS = 20; // how many links create for each object
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestSoftMaxHeapSize
+ * @requires vm.gc.G1
+ * @summary Verify that G1 shrinks the heap toward a lowered SoftMaxHeapSize
+ * at full collections and does not grow past it at young collections.
+ * @library /test/lib /
+ * @modules java.management
+ * @run main/othervm -XX:+UseG1GC -XX:G1HeapRegionSize=1M -Xms16m -Xmx512m
+ * -XX:MinHeapFreeRatio=0 -XX:MaxHeapFreeRatio=100 -XX:-ExplicitGCInvokesConcurrent
+ * -Xlog:gc+heap=debug gc.g1.TestSoftMaxHeapSize
+ */
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.List;
+import static jdk.test.lib.Asserts.*;
+
+public class TestSoftMaxHeapSize {
+
+    private static final long M = 1024 * 1024;
+    private static final long SOFT_MAX = 64 * M;
+
+    public static volatile Object sink;
+
+    public static void main(String[] args) throws Exception {
+        // Grow the heap well beyond the soft maximum.
+        List<byte[]> live = new ArrayList<>();
+        for (int i = 0; i < 2000; i++) {
+            live.add(new byte[100 * 1024]);
+        }
+        long grown = Runtime.getRuntime().totalMemory();
+        assertGreaterThan(grown, 2 * SOFT_MAX, "Heap did not grow");
+
+        // With MaxHeapFreeRatio=100 a full collection only shrinks the heap
+        // because of the soft maximum.
+        live = null;
+        HotSpotDiagnosticMXBean diagnostic = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        diagnostic.setVMOption("SoftMaxHeapSize", Long.toString(SOFT_MAX));
+        System.gc();
+        long shrunk = Runtime.getRuntime().totalMemory();
+        assertLessThanOrEqual(shrunk, SOFT_MAX, "Full collection did not shrink the heap toward SoftMaxHeapSize");
+
+        // Young collections with short-lived objects only must not grow the
+        // heap past the soft maximum.
+        for (int i = 0; i < 100_000; i++) {
+            sink = new byte[10 * 1024];
+        }
+        long churned = Runtime.getRuntime().totalMemory();
+        assertLessThanOrEqual(churned, SOFT_MAX, "Young collections grew the heap past SoftMaxHeapSize");
+    }
+}
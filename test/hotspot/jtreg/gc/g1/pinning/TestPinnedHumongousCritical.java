@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1.pinning;
+
+/*
+ * @test TestPinnedHumongousCritical
+ * @requires vm.gc.G1
+ * @summary A JNI critical region on a humongous array does not hold off
+ * a full collection, and the array is not moved or reclaimed.
+ * @run main/native/othervm -XX:+UseG1GC -XX:G1HeapRegionSize=1M -Xmx256m
+ * -XX:-ExplicitGCInvokesConcurrent -Xlog:gc gc.g1.pinning.TestPinnedHumongousCritical
+ */
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+
+public class TestPinnedHumongousCritical {
+
+    static {
+        System.loadLibrary("TestPinnedHumongousCritical");
+    }
+
+    // Fills array with a pattern inside a critical region that lasts until
+    // release() is called.
+    private static native void holdCritical(byte[] array);
+    private static native boolean isHolding();
+    private static native void release();
+
+    private static long collectionCount() {
+        long count = 0;
+        for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += gc.getCollectionCount();
+        }
+        return count;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Larger than a region, so it is allocated as a humongous object.
+        byte[] humongous = new byte[4 * 1024 * 1024];
+        Thread holder = new Thread(() -> holdCritical(humongous));
+        holder.start();
+        while (!isHolding()) {
+            Thread.sleep(10);
+        }
+
+        // With the GCLocker held this would wait until the critical region ends.
+        long before = collectionCount();
+        System.gc();
+        if (collectionCount() == before) {
+            throw new RuntimeException("No collection while in the critical region");
+        }
+        if (!isHolding()) {
+            throw new RuntimeException("Critical region ended before the collection");
+        }
+
+        release();
+        holder.join();
+
+        for (int i = 0; i < humongous.length; i++) {
+            if (humongous[i] != (byte)i) {
+                throw new RuntimeException("Unexpected value " + humongous[i] + " at index " + i);
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+
+static volatile int holding = 0;
+static volatile int release_critical = 0;
+
+JNIEXPORT void JNICALL Java_gc_g1_pinning_TestPinnedHumongousCritical_holdCritical
+  (JNIEnv *env, jclass cls, jbyteArray array)
+{
+    jsize length = (*env)->GetArrayLength(env, array);
+    jbyte *elements = (*env)->GetPrimitiveArrayCritical(env, array, 0);
+    jsize i;
+
+    if (elements == NULL) {
+        return;
+    }
+    holding = 1;
+
+    while (!release_critical) /* empty */;
+
+    // Written after the collection, so a moved array would not see the pattern.
+    for (i = 0; i < length; i++) {
+        elements[i] = (jbyte)i;
+    }
+    holding = 0;
+    (*env)->ReleasePrimitiveArrayCritical(env, array, elements, 0);
+}
+
+JNIEXPORT jboolean JNICALL Java_gc_g1_pinning_TestPinnedHumongousCritical_isHolding
+  (JNIEnv *env, jclass cls)
+{
+    return holding ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL Java_gc_g1_pinning_TestPinnedHumongousCritical_release
+  (JNIEnv *env, jclass cls)
+{
+    release_critical = 1;
+}
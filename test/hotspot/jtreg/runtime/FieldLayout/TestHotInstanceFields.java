@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Fields listed in HotInstanceFields are laid out before the other fields of their class
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:HotInstanceFields=TestHotInstanceFields$Fields.hot1,TestHotInstanceFields$Fields.hot2,TestHotInstanceFields$Fields.hotRef
+ *                   TestHotInstanceFields
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:-UseCompressedOops
+ *                   -XX:HotInstanceFields=TestHotInstanceFields$Fields.hot1,TestHotInstanceFields$Fields.hot2,TestHotInstanceFields$Fields.hotRef
+ *                   TestHotInstanceFields
+ */
+
+import jdk.internal.misc.Unsafe;
+
+public class TestHotInstanceFields {
+
+    // The cold fields are all longs, so none of them can be moved into
+    // an alignment gap in front of the hot fields.
+    static class Fields {
+        long cold1;
+        long cold2;
+        long cold3;
+        long cold4;
+        long hot1;
+        long hot2;
+        Object hotRef;
+    }
+
+    static final String[] HOT = { "hot1", "hot2", "hotRef" };
+    static final String[] COLD = { "cold1", "cold2", "cold3", "cold4" };
+
+    public static void main(String[] args) throws Exception {
+        Unsafe unsafe = Unsafe.getUnsafe();
+
+        long maxHot = Long.MIN_VALUE;
+        for (String name : HOT) {
+            maxHot = Math.max(maxHot, unsafe.objectFieldOffset(Fields.class, name));
+        }
+        long minCold = Long.MAX_VALUE;
+        for (String name : COLD) {
+            minCold = Math.min(minCold, unsafe.objectFieldOffset(Fields.class, name));
+        }
+        if (maxHot >= minCold) {
+            throw new RuntimeException("Hot field at offset " + maxHot +
+                                       " is not before all cold fields, first cold field at " + minCold);
+        }
+
+        // The hot reference must still be covered by the oop maps.
+        Fields[] holder = new Fields[] { new Fields() };
+        holder[0].hotRef = new int[] { 42 };
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+        }
+        if (((int[])holder[0].hotRef)[0] != 42) {
+            throw new RuntimeException("Hot reference field was not updated by the GC");
+        }
+        System.out.println("Hot field offsets end at " + maxHot + ", cold fields start at " + minCold);
+    }
+}
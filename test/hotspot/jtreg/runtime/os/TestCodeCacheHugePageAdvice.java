@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With UseTransparentHugePagesForCodeCache, the code cache memory
+ *          committed at startup is advised for transparent huge pages.
+ * @requires os.family == "linux" & vm.flagless
+ * @library /test/lib
+ * @run driver runtime.os.TestCodeCacheHugePageAdvice
+ */
+
+package runtime.os;
+
+import java.io.File;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jtreg.SkippedException;
+
+public class TestCodeCacheHugePageAdvice {
+
+    public static void main(String[] args) throws Exception {
+        if (!new File("/sys/kernel/mm/transparent_hugepage/enabled").exists()) {
+            throw new SkippedException("Kernel without transparent huge page support");
+        }
+
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseTransparentHugePagesForCodeCache",
+            "-XX:+SegmentedCodeCache",
+            "-Xlog:pagesize",
+            PrintSmaps.class.getName()).start());
+        output.shouldHaveExitValue(0);
+        String stdout = output.getStdout();
+
+        // The bases of the code heaps, as logged when they are reserved.
+        Pattern heap = Pattern.compile("CodeHeap '([^']+)':\\s+min=\\S+ max=\\S+ base=0x([0-9a-f]+)");
+        Matcher m = heap.matcher(stdout);
+        int checked = 0;
+        while (m.find()) {
+            String name = m.group(1);
+            long base = Long.parseUnsignedLong(m.group(2), 16);
+            String flags = vmFlagsOf(stdout, base);
+            Asserts.assertNotNull(flags, "No mapping for code heap '" + name + "' in smaps");
+            Asserts.assertTrue(flags.contains(" hg"),
+                               "Committed start of code heap '" + name + "' is not advised for huge pages: " + flags);
+            checked++;
+        }
+        Asserts.assertGT(checked, 0, "No code heaps found in the log");
+    }
+
+    // Returns the VmFlags line of the smaps entry containing address.
+    private static String vmFlagsOf(String smaps, long address) {
+        Pattern range = Pattern.compile("^([0-9a-f]+)-([0-9a-f]+) ");
+        boolean inRange = false;
+        for (String line : smaps.split("\n")) {
+            Matcher m = range.matcher(line);
+            if (m.find()) {
+                long start = Long.parseUnsignedLong(m.group(1), 16);
+                long end = Long.parseUnsignedLong(m.group(2), 16);
+                inRange = Long.compareUnsigned(start, address) <= 0 && Long.compareUnsigned(address, end) < 0;
+            } else if (inRange && line.startsWith("VmFlags:")) {
+                return line;
+            }
+        }
+        return null;
+    }
+
+    static class PrintSmaps {
+        public static void main(String[] args) throws Exception {
+            for (String line : Files.readAllLines(Paths.get("/proc/self/smaps"))) {
+                System.out.println(line);
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With PooledJavaThreads, new Java threads run on the native threads
+ *          of terminated ones and start out with a fresh Java thread state.
+ * @requires os.family == "linux" & vm.flagless
+ * @library /test/lib
+ * @run driver runtime.os.TestPooledJavaThreads
+ */
+
+package runtime.os;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPooledJavaThreads {
+
+    private static final String POOLED = "Thread started on pooled native thread";
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:PooledJavaThreads=4",
+            "-Xlog:os+thread=info",
+            StartThreads.class.getName()).start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain(POOLED);
+
+        // Pooling is off by default.
+        output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(
+            "-Xlog:os+thread=info",
+            StartThreads.class.getName()).start());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain(POOLED);
+    }
+
+    static class StartThreads {
+        static final ThreadLocal<String> owner = new ThreadLocal<>();
+
+        public static void main(String[] args) throws Exception {
+            for (int i = 0; i < 100; i++) {
+                String name = "Pooled-" + i;
+                // Alternate with threads with an explicit stack size, which are not pooled.
+                long stackSize = (i % 10 == 9) ? 512 * 1024 : 0;
+                Throwable[] failure = new Throwable[1];
+                Thread t = new Thread(null, () -> {
+                    try {
+                        check(name);
+                    } catch (Throwable e) {
+                        failure[0] = e;
+                    }
+                }, name, stackSize);
+                t.start();
+                t.join();
+                if (failure[0] != null) {
+                    throw new RuntimeException("Thread " + name + " failed", failure[0]);
+                }
+            }
+        }
+
+        static void check(String name) {
+            Thread current = Thread.currentThread();
+            if (!current.getName().equals(name)) {
+                throw new RuntimeException("Unexpected current thread " + current.getName());
+            }
+            if (owner.get() != null) {
+                throw new RuntimeException("Thread local of " + owner.get() + " is visible");
+            }
+            owner.set(name);
+            // Use some stack to check the stack guard zones of the new Java thread.
+            if (depth(0) < 1000) {
+                throw new RuntimeException("Stack too small");
+            }
+        }
+
+        static int depth(int n) {
+            return n < 1000 ? depth(n + 1) : n;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Safepoint VM operations requested while another one is being
+ *          executed are evaluated in the same safepoint and all complete.
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver runtime.vmthread.CoalescedVMOperationsTest
+ */
+
+package runtime.vmthread;
+
+import java.util.Map;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class CoalescedVMOperationsTest {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(
+            "-Xlog:vmthread=debug",
+            RequestOperations.class.getName()).start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Adding pending VM operation: ThreadDump");
+        output.shouldContain("Evaluating coalesced safepoint VM operation: ThreadDump");
+    }
+
+    static class RequestOperations {
+        static final int THREADS = 16;
+        static final int ITERATIONS = 200;
+
+        public static void main(String[] args) throws Exception {
+            Thread[] threads = new Thread[THREADS];
+            Throwable[] failures = new Throwable[THREADS];
+            for (int i = 0; i < THREADS; i++) {
+                final int index = i;
+                threads[i] = new Thread(() -> {
+                    try {
+                        for (int j = 0; j < ITERATIONS; j++) {
+                            // Each call requests a VM_ThreadDump safepoint operation.
+                            Map<Thread, StackTraceElement[]> traces = Thread.getAllStackTraces();
+                            if (!traces.containsKey(Thread.currentThread())) {
+                                throw new RuntimeException("Current thread missing from thread dump");
+                            }
+                        }
+                    } catch (Throwable t) {
+                        failures[index] = t;
+                    }
+                });
+                threads[i].start();
+            }
+            for (int i = 0; i < THREADS; i++) {
+                threads[i].join();
+                if (failures[i] != null) {
+                    throw new RuntimeException("Thread " + i + " failed", failures[i]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test ProfileSnapshotTest
+ * @summary Test of diagnostic command Compiler.profile_snapshot
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm ProfileSnapshotTest
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.util.List;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class ProfileSnapshotTest {
+
+    static int hot(int x) {
+        return x * 31 + 7;
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        int sum = 0;
+        for (int i = 0; i < 10_000; i++) {
+            sum += hot(i);
+        }
+        System.out.println("sum: " + sum);
+
+        File file = new File("profile_snapshot_dcmd.txt");
+        OutputAnalyzer output = executor.execute("Compiler.profile_snapshot " + file.getAbsolutePath());
+        output.shouldContain("Profile snapshot written to");
+
+        List<String> lines = Files.readAllLines(file.toPath());
+        Asserts.assertFalse(lines.isEmpty(), "Snapshot is empty");
+        Asserts.assertEquals(lines.get(0), "# profile snapshot version 1");
+        boolean found = false;
+        for (String line : lines.subList(1, lines.size())) {
+            String[] parts = line.split(" ");
+            Asserts.assertEquals(parts.length, 6, "Malformed line: " + line);
+            Asserts.assertEquals(parts[0], "method", "Malformed line: " + line);
+            if (parts[1].equals("ProfileSnapshotTest") && parts[2].equals("hot") && parts[3].equals("(I)I")) {
+                found = true;
+                Asserts.assertGT(Integer.parseInt(parts[4]) + Integer.parseInt(parts[5]), 0,
+                                 "Counters of hot method not recorded: " + line);
+            }
+        }
+        Asserts.assertTrue(found, "ProfileSnapshotTest.hot(I)I not in snapshot");
+
+        output = executor.execute("Compiler.profile_snapshot " + new File("no_such_dir", "snapshot.txt").getPath());
+        output.shouldContain("Unable to open");
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
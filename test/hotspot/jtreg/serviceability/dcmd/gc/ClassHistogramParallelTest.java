@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test ClassHistogramParallelTest
+ * @summary Test of diagnostic command GC.class_histogram -parallel
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC -XX:ParallelGCThreads=4 ClassHistogramParallelTest
+ */
+
+import java.util.regex.Pattern;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class ClassHistogramParallelTest {
+
+    static class Marker {
+        final int[] payload = new int[16];
+    }
+
+    static final int NUM_MARKERS = 10_000;
+    static Marker[] markers;
+
+    public void run(CommandExecutor executor) throws Exception {
+        markers = new Marker[NUM_MARKERS];
+        for (int i = 0; i < NUM_MARKERS; i++) {
+            markers[i] = new Marker();
+        }
+
+        // Every thread count must find each instance exactly once.
+        String markerLine = "(?m)^\\s*\\d+:\\s+" + NUM_MARKERS + "\\s+\\d+\\s+" +
+                            Pattern.quote(Marker.class.getName()) + "\\s*$";
+        for (String parallel : new String[] { "", " -parallel=0", " -parallel=1", " -parallel=4" }) {
+            OutputAnalyzer output = executor.execute("GC.class_histogram" + parallel);
+            output.shouldMatch(markerLine);
+        }
+
+        OutputAnalyzer output = executor.execute("GC.class_histogram -parallel=-1");
+        output.shouldContain("Parallel thread number out of range (>=0): -1");
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test HeapDumpMaxPrimitiveArrayLengthTest
+ * @summary Test that HeapDumpMaxPrimitiveArrayLength truncates primitive arrays
+ *          but not object arrays in heap dumps
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UnlockDiagnosticVMOptions -XX:HeapDumpMaxPrimitiveArrayLength=8 HeapDumpMaxPrimitiveArrayLengthTest
+ */
+
+import java.io.BufferedInputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.util.Enumeration;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.hprof.model.JavaClass;
+import jdk.test.lib.hprof.model.JavaHeapObject;
+import jdk.test.lib.hprof.model.JavaObjectArray;
+import jdk.test.lib.hprof.model.JavaValueArray;
+import jdk.test.lib.hprof.model.Snapshot;
+import jdk.test.lib.hprof.parser.HprofReader;
+import jdk.test.lib.hprof.parser.PositionDataInputStream;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpMaxPrimitiveArrayLengthTest {
+
+    static final int MAX_LENGTH = 8;
+    static final int ARRAY_LENGTH = 12345;
+
+    static long[] longs;
+    static Object[] objects;
+
+    private static Snapshot readDump(File dump) throws Exception {
+        try (PositionDataInputStream in = new PositionDataInputStream(
+                new BufferedInputStream(new FileInputStream(dump)))) {
+            int magic = in.readInt();
+            Asserts.assertTrue(HprofReader.verifyMagicNumber(magic), "Unrecognized magic number: " + magic);
+            Snapshot snapshot = new HprofReader(dump.getPath(), in, 0, false, 0).read();
+            snapshot.resolve(true);
+            return snapshot;
+        }
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        longs = new long[ARRAY_LENGTH];
+        objects = new Object[ARRAY_LENGTH];
+        for (int i = 0; i < ARRAY_LENGTH; i++) {
+            objects[i] = Integer.valueOf(i);
+        }
+
+        File dump = new File("heapdump_truncated.hprof");
+        try {
+            OutputAnalyzer output = executor.execute("GC.heap_dump " + dump.getAbsolutePath());
+            output.shouldContain("Heap dump file created");
+
+            Snapshot snapshot = readDump(dump);
+
+            // Primitive arrays are cut at MAX_LENGTH.
+            boolean foundTruncated = false;
+            JavaClass longArray = snapshot.findClass("[J");
+            Asserts.assertNotNull(longArray, "long[] class not in dump");
+            Enumeration<JavaHeapObject> longArrays = longArray.getInstances(false);
+            while (longArrays.hasMoreElements()) {
+                JavaValueArray array = (JavaValueArray) longArrays.nextElement();
+                Asserts.assertLessThanOrEqual(array.getLength(), MAX_LENGTH, "Primitive array not truncated");
+                if (array.getLength() == MAX_LENGTH) {
+                    foundTruncated = true;
+                }
+            }
+            Asserts.assertTrue(foundTruncated, "Truncated long[] not found in dump");
+
+            // Object arrays are written in full.
+            boolean foundObjects = false;
+            JavaClass objectArray = snapshot.findClass("[Ljava.lang.Object;");
+            Asserts.assertNotNull(objectArray, "Object[] class not in dump");
+            Enumeration<JavaHeapObject> objectArrays = objectArray.getInstances(false);
+            while (objectArrays.hasMoreElements()) {
+                JavaObjectArray array = (JavaObjectArray) objectArrays.nextElement();
+                if (array.getElements().length == ARRAY_LENGTH) {
+                    foundObjects = true;
+                }
+            }
+            Asserts.assertTrue(foundObjects, "Object[] of length " + ARRAY_LENGTH + " not found in dump");
+        } finally {
+            dump.delete();
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
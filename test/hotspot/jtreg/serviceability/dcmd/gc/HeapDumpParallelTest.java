@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test HeapDumpParallelTest
+ * @summary Test of diagnostic command GC.heap_dump -parallel
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC -XX:ParallelGCThreads=4 HeapDumpParallelTest
+ */
+
+import java.io.BufferedInputStream;
+import java.io.File;
+import java.io.FileInputStream;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.hprof.model.JavaClass;
+import jdk.test.lib.hprof.model.Snapshot;
+import jdk.test.lib.hprof.parser.HprofReader;
+import jdk.test.lib.hprof.parser.PositionDataInputStream;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpParallelTest {
+
+    static class Marker {
+        final int[] payload = new int[16];
+    }
+
+    static final int NUM_MARKERS = 10_000;
+    static Marker[] markers;
+
+    private static Snapshot readDump(File dump) throws Exception {
+        try (PositionDataInputStream in = new PositionDataInputStream(
+                new BufferedInputStream(new FileInputStream(dump)))) {
+            int magic = in.readInt();
+            Asserts.assertTrue(HprofReader.verifyMagicNumber(magic), "Unrecognized magic number: " + magic);
+            Snapshot snapshot = new HprofReader(dump.getPath(), in, 0, false, 0).read();
+            snapshot.resolve(true);
+            return snapshot;
+        }
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        markers = new Marker[NUM_MARKERS];
+        for (int i = 0; i < NUM_MARKERS; i++) {
+            markers[i] = new Marker();
+        }
+
+        File dump = new File("heapdump_parallel.hprof");
+        try {
+            OutputAnalyzer output = executor.execute("GC.heap_dump -parallel=4 " + dump.getAbsolutePath());
+            output.shouldContain("Heap dump file created");
+
+            // Segments written by the dump threads interleave; every object must
+            // still appear exactly once.
+            Snapshot snapshot = readDump(dump);
+            JavaClass marker = snapshot.findClass(Marker.class.getName());
+            Asserts.assertNotNull(marker, "Marker class not in dump");
+            Asserts.assertEquals(marker.getInstancesCount(false), NUM_MARKERS, "Marker instances in dump");
+        } finally {
+            dump.delete();
+        }
+
+        OutputAnalyzer output = executor.execute("GC.heap_dump -parallel=0 " + dump.getAbsolutePath());
+        output.shouldContain("Invalid number of parallel dump threads: 0");
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Verify file to file transfers with FileChannel.transferTo,
+ *          including targets opened for append
+ * @key randomness
+ * @run main TransferToFile
+ */
+
+import java.io.IOException;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Random;
+
+import static java.nio.file.StandardOpenOption.*;
+
+public class TransferToFile {
+
+    private static final Random RAND = new Random();
+
+    public static void main(String[] args) throws IOException {
+        byte[] data = new byte[1024 * 1024 + 17];
+        RAND.nextBytes(data);
+        Path source = Files.createTempFile(Path.of("."), "source", null);
+        Files.write(source, data);
+
+        try (FileChannel src = FileChannel.open(source, READ)) {
+            // Whole file.
+            testTransfer(src, 0, data.length, data);
+            // Unaligned range in the middle.
+            testTransfer(src, 4099, 65537, data);
+            // Count beyond the end of the source.
+            testTransfer(src, data.length - 100, 1000, data);
+            // Position at the end of the source.
+            testTransfer(src, data.length, 10, data);
+            // Append to a target with existing content.
+            testAppend(src, data);
+        } finally {
+            Files.delete(source);
+        }
+    }
+
+    private static void testTransfer(FileChannel src, long position, long count, byte[] data)
+        throws IOException {
+        Path target = Files.createTempFile(Path.of("."), "target", null);
+        try (FileChannel dst = FileChannel.open(target, WRITE)) {
+            // Transfers write at the current position of the target.
+            dst.position(3);
+            src.position(11);
+            long expected = Math.max(0, Math.min(count, data.length - position));
+            long n = transferFully(src, position, count, dst, expected);
+            check(n == expected, "Transferred " + n + " bytes, expected " + expected);
+            check(src.position() == 11, "Source position changed to " + src.position());
+            check(dst.position() == 3 + expected, "Target position is " + dst.position());
+
+            byte[] copied = Files.readAllBytes(target);
+            check(copied.length == 3 + expected, "Target size is " + copied.length);
+            check(Arrays.equals(copied, 3, copied.length,
+                                data, (int)position, (int)(position + expected)),
+                  "Target content differs from source range at " + position);
+        } finally {
+            Files.delete(target);
+        }
+    }
+
+    private static void testAppend(FileChannel src, byte[] data) throws IOException {
+        Path target = Files.createTempFile(Path.of("."), "target", null);
+        byte[] prefix = "prefix".getBytes();
+        Files.write(target, prefix);
+        try (FileChannel dst = FileChannel.open(target, WRITE, APPEND)) {
+            long n = transferFully(src, 0, data.length, dst, data.length);
+            check(n == data.length, "Appended " + n + " bytes");
+
+            byte[] copied = Files.readAllBytes(target);
+            check(copied.length == prefix.length + data.length, "Target size is " + copied.length);
+            check(Arrays.equals(copied, 0, prefix.length, prefix, 0, prefix.length),
+                  "Existing content was overwritten");
+            check(Arrays.equals(copied, prefix.length, copied.length, data, 0, data.length),
+                  "Appended content differs from source");
+        } finally {
+            Files.delete(target);
+        }
+    }
+
+    // transferTo may transfer fewer bytes than requested.
+    private static long transferFully(FileChannel src, long position, long count,
+                                      FileChannel dst, long expected) throws IOException {
+        long total = 0;
+        while (total < expected) {
+            long n = src.transferTo(position + total, count - total, dst);
+            if (n <= 0) {
+                break;
+            }
+            total += n;
+        }
+        return total;
+    }
+
+    private static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+
+package jdk.jfr.event.gc.detailed;
+
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.jfr.EventNames;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @key jfr
+ * @requires vm.hasJFR
+ * @requires vm.gc == "G1" | vm.gc == null
+ * @library /test/lib
+ * @run main/othervm -XX:+UseG1GC -Xmx32m -XX:G1HeapRegionSize=1m jdk.jfr.event.gc.detailed.TestG1HeapRegionInformationEvent
+ */
+public class TestG1HeapRegionInformationEvent {
+    private final static String EVENT_NAME = EventNames.PREFIX + "G1HeapRegionInformation";
+
+    public static Object[] retained;
+
+    public static void main(String[] args) throws Throwable {
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME).with("period", "endChunk");
+            recording.start();
+            // Retain some objects so that regions have live data.
+            retained = new Object[10_000];
+            for (int i = 0; i < retained.length; i++) {
+                retained[i] = new byte[100];
+            }
+            System.gc();
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Events.hasEvents(events);
+            long totalLive = 0;
+            for (RecordedEvent event : events) {
+                long used = Events.assertField(event, "used").atLeast(0L).getValue();
+                long live = Events.assertField(event, "liveBytes").atLeast(0L).atMost(used).getValue();
+                Events.assertField(event, "remSetCards").atLeast(0L);
+                if (event.getString("type").equals("Free")) {
+                    Asserts.assertEquals(live, 0L, "Free region with live bytes: " + event);
+                }
+                totalLive += live;
+            }
+            Asserts.assertGreaterThan(totalLive, 0L, "No live bytes reported");
+        }
+    }
+}
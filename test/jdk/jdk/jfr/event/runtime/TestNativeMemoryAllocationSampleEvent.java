@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.jfr.consumer.RecordedStackTrace;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.jfr.EventNames;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm -XX:NativeAllocationSampleInterval=1 jdk.jfr.event.runtime.TestNativeMemoryAllocationSampleEvent
+ */
+public class TestNativeMemoryAllocationSampleEvent {
+    private final static String EVENT_NAME = EventNames.PREFIX + "NativeMemoryAllocationSample";
+
+    public static void main(String[] args) throws Throwable {
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME).withStackTrace();
+            recording.start();
+            // Starting a thread allocates its JavaThread with os::malloc inside the VM.
+            for (int i = 0; i < 100; i++) {
+                Thread t = new Thread(() -> {});
+                t.start();
+                t.join();
+            }
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Events.hasEvents(events);
+            String mainThread = Thread.currentThread().getName();
+            boolean foundStart = false;
+            for (RecordedEvent event : events) {
+                System.out.println("Event:" + event);
+                Events.assertField(event, "type").notEmpty();
+                Events.assertField(event, "address").notEqual(0L);
+                Events.assertField(event, "allocationSize").atLeast(1L);
+                long size = Events.assertField(event, "allocationSize").getValue();
+                Events.assertField(event, "weight").atLeast(size);
+                Asserts.assertNotNull(event.getThread(), "Event should have a thread");
+                // Samples of compiler threads and the VMThread have no Java stack.
+                if (mainThread.equals(event.getThread().getJavaName())) {
+                    RecordedStackTrace stackTrace = event.getStackTrace();
+                    Asserts.assertNotNull(stackTrace, "Event should have a stack trace");
+                    // The sample is committed when the thread leaves the VM entry
+                    // that allocated, so the top frame is the native method.
+                    RecordedFrame top = stackTrace.getFrames().get(0);
+                    if (top.getMethod().getName().equals("start0")) {
+                        foundStart = true;
+                    }
+                }
+            }
+            Asserts.assertTrue(foundStart, "No sample with Thread.start0 as the top frame");
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.jfr.EventNames;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm -XX:NativeMemoryTracking=summary jdk.jfr.event.runtime.TestNativeMemoryUsageEvents
+ */
+public class TestNativeMemoryUsageEvents {
+    private final static String EVENT_NAME = EventNames.PREFIX + "NativeMemoryUsage";
+
+    public static void main(String[] args) throws Throwable {
+        try (Recording recording = new Recording()) {
+            // Sent at the start and at the end of the recording.
+            recording.enable(EVENT_NAME);
+            recording.start();
+            for (int i = 0; i < 100; i++) {
+                Thread t = new Thread(() -> {});
+                t.start();
+                t.join();
+            }
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Events.hasEvents(events);
+            Map<String, List<RecordedEvent>> byType = new HashMap<>();
+            for (RecordedEvent event : events) {
+                System.out.println("Event:" + event);
+                String type = Events.assertField(event, "type").notEmpty().getValue();
+                byType.computeIfAbsent(type, k -> new ArrayList<>()).add(event);
+            }
+            for (Map.Entry<String, List<RecordedEvent>> entry : byType.entrySet()) {
+                List<RecordedEvent> samples = entry.getValue();
+                samples.sort(Comparator.comparing(RecordedEvent::getEndTime));
+                // Nothing was sampled before the first event, so it has no change to report.
+                long first = samples.get(0).getLong("committedDelta");
+                Asserts.assertEquals(first, 0L, "First committedDelta for " + entry.getKey());
+                for (int i = 1; i < samples.size(); i++) {
+                    long delta = samples.get(i).getLong("committedDelta");
+                    long change = samples.get(i).getLong("committed") - samples.get(i - 1).getLong("committed");
+                    Asserts.assertEquals(delta, change, "committedDelta for " + entry.getKey());
+                }
+            }
+        }
+    }
+}
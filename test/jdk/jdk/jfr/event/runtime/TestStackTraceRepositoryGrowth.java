@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.jfr.Event;
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @summary Many threads record many distinct stack traces, so that the stack
+ *          trace table grows while lock-free lookups run. Every event must
+ *          still get its own stack trace.
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm jdk.jfr.event.runtime.TestStackTraceRepositoryGrowth
+ */
+public class TestStackTraceRepositoryGrowth {
+
+    // 2^13 distinct call paths, more than the initial table size.
+    private final static int LEVELS = 13;
+    private final static int PATHS = 1 << LEVELS;
+    private final static int THREADS = 4;
+
+    static class PathEvent extends Event {
+        int path;
+    }
+
+    // The bits of path, from the lowest, choose a() or b() at each level.
+    static void descend(int level, int path) {
+        if (level == LEVELS) {
+            PathEvent event = new PathEvent();
+            event.path = path;
+            event.commit();
+        } else if ((path & (1 << level)) == 0) {
+            a(level + 1, path);
+        } else {
+            b(level + 1, path);
+        }
+    }
+
+    static void a(int level, int path) {
+        descend(level, path);
+    }
+
+    static void b(int level, int path) {
+        descend(level, path);
+    }
+
+    public static void main(String[] args) throws Throwable {
+        try (Recording recording = new Recording()) {
+            recording.enable(PathEvent.class).withStackTrace();
+            recording.start();
+            List<Thread> threads = new ArrayList<>();
+            for (int t = 0; t < THREADS; t++) {
+                Thread thread = new Thread(() -> {
+                    for (int path = 0; path < PATHS; path++) {
+                        descend(0, path);
+                    }
+                });
+                threads.add(thread);
+                thread.start();
+            }
+            for (Thread thread : threads) {
+                thread.join();
+            }
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Asserts.assertEquals(events.size(), THREADS * PATHS, "Number of events");
+            for (RecordedEvent event : events) {
+                int path = event.getInt("path");
+                Asserts.assertNotNull(event.getStackTrace(), "Event without stack trace");
+                // The frames of a() and b(), from the top of the stack, give
+                // the bits of the path from the highest level down.
+                int fromStack = 0;
+                int level = LEVELS;
+                for (RecordedFrame frame : event.getStackTrace().getFrames()) {
+                    String name = frame.getMethod().getName();
+                    if (name.equals("a") || name.equals("b")) {
+                        level--;
+                        if (name.equals("b")) {
+                            fromStack |= 1 << level;
+                        }
+                    }
+                }
+                Asserts.assertEquals(level, 0, "Wrong depth of stack trace for path " + path);
+                Asserts.assertEquals(fromStack, path, "Stack trace of another path");
+            }
+        }
+    }
+}
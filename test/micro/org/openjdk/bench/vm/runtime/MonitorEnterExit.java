@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Group;
+import org.openjdk.jmh.annotations.GroupThreads;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the ObjectSynchronizer paths: uncontended and recursive locking,
+ * contended locking of an inflated monitor, wait/notify and identity hashes.
+ * Biased locking is disabled, so that the fast paths do not hide the
+ * runtime code.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 10, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-XX:-UseBiasedLocking"})
+public class MonitorEnterExit {
+
+    @State(Scope.Thread)
+    public static class ThreadLocalLock {
+        Object lock;
+
+        @Setup
+        public void setup() {
+            lock = new Object();
+        }
+    }
+
+    @State(Scope.Group)
+    public static class SharedLock {
+        final Object lock = new Object();
+        int counter;
+    }
+
+    @Benchmark
+    public void uncontended(ThreadLocalLock s, Blackhole bh) {
+        synchronized (s.lock) {
+            bh.consume(s);
+        }
+    }
+
+    @Benchmark
+    public void recursive(ThreadLocalLock s, Blackhole bh) {
+        synchronized (s.lock) {
+            synchronized (s.lock) {
+                bh.consume(s);
+            }
+        }
+    }
+
+    @Benchmark
+    public void notifyOwned(ThreadLocalLock s) {
+        // notify() inflates the monitor.
+        synchronized (s.lock) {
+            s.lock.notify();
+        }
+    }
+
+    @Benchmark
+    public int identityHashCode(ThreadLocalLock s) {
+        return System.identityHashCode(s.lock);
+    }
+
+    @Benchmark
+    @Group("contended")
+    @GroupThreads(4)
+    public int contended(SharedLock s) {
+        synchronized (s.lock) {
+            return ++s.counter;
+        }
+    }
+}